@@ -0,0 +1,27 @@
+#ifndef INC_APP_H_
+#define INC_APP_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Starts the CANopen node: creates the Object Dictionary, restores the
+ *        stored parameters, starts NMT (boot-up message) and registers the
+ *        CiA 402 callbacks.
+ *
+ * Everything below this point reaches the hardware only through can.h,
+ * systick.h and tmc5160.h, so the same code runs on the STM32F407 and in the
+ * host simulator (Host/Sim).
+ *
+ * @param t Cycle count at which the previous boot phase ended
+ *          (see boot_time_record()).
+ */
+void app_init(uint32_t t);
+
+/**
+ * @brief One pass of the super-loop: configures the TMC5160 on the first call,
+ *        processes received CAN frames and Lely timers, updates the statusword,
+ *        samples the recorder and sends the periodic TPDO.
+ */
+void app_poll(void);
+
+#endif /* INC_APP_H_ */
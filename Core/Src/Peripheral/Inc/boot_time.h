@@ -0,0 +1,53 @@
+#ifndef PERIPHERAL_INC_BOOT_TIME_H_
+#define PERIPHERAL_INC_BOOT_TIME_H_
+
+#include <lely/co/dev.h>
+#include <stdint.h>
+
+// Object Dictionary entry publishing the measurements
+#define BOOT_TIME_OBJ           0x2105 // RECORD (read only): phase durations in microseconds
+
+// Measured phases, in the order of the sub-indices of 0x2105 (phase + 1)
+typedef enum {
+    BOOT_PHASE_CLOCK,       // rcc_system_clock_config(): HSE start-up and PLL lock
+    BOOT_PHASE_PERIPHERALS, // SysTick, SPI and CAN set-up
+    BOOT_PHASE_OD,          // co_dev_create_from_sdev()
+    BOOT_PHASE_RESTORE,     // nvparam_init(): stored parameters into the OD
+    BOOT_PHASE_NMT,         // co_nmt_create() and the reset that sends the boot-up message
+    BOOT_PHASE_BOOTUP,      // Sum of the phases above: reset to boot-up message (not recorded directly)
+    BOOT_PHASE_DRIVE,       // Deferred TMC5160 configuration, after the boot-up message
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+/**
+ * @brief Starts the DWT cycle counter. Call first thing in main().
+ * @return The current cycle count, to pass to the first boot_time_record().
+ */
+uint32_t boot_time_start(void);
+
+/**
+ * @brief Returns the current value of the cycle counter.
+ */
+uint32_t boot_time_cycles(void);
+
+/**
+ * @brief Converts a difference of cycle counts at the CPU clock (after the
+ *        clock phase) to microseconds.
+ */
+uint32_t boot_time_cycles_to_us(uint32_t cycles);
+
+/**
+ * @brief Records the duration of a phase that began at cycle count 'start'.
+ * @return The current cycle count, so phases can be chained:
+ *         t = boot_time_record(BOOT_PHASE_CLOCK, t);
+ */
+uint32_t boot_time_record(boot_phase_t phase, uint32_t start);
+
+/**
+ * @brief Publishes the phases recorded so far in object 0x2105; later
+ *        records are published as they happen.
+ * @param dev The CANopen device holding the Object Dictionary.
+ */
+void boot_time_init(co_dev_t *dev);
+
+#endif /* PERIPHERAL_INC_BOOT_TIME_H_ */
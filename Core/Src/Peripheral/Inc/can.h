@@ -5,6 +5,10 @@
 #include <stddef.h> // For size_t
 #include <stdbool.h>
 
+// Identifiers whose receptions are counted by the receive interrupt
+#define CAN_WATCH_COUNT     4
+#define CAN_WATCH_NONE      0xFFFFFFFFu
+
 /**
  * @brief Initializes the CAN1 peripheral and its GPIOs (PB8, PB9).
  *
@@ -28,4 +32,29 @@ size_t can_recv(struct can_msg *msgs, size_t n);
  */
 size_t can_send(const struct can_msg *msg);
 
+/**
+ * @brief Sets the identifier of the SYNC message (0x1005), whose reception
+ *        time is recorded by the receive interrupt.
+ */
+void can_set_sync_id(uint32_t id);
+
+/**
+ * @brief Returns the cycle count (boot_time_cycles()) at the reception of
+ *        the last SYNC message, before it waited in the ring buffer.
+ */
+uint32_t can_sync_cycles(void);
+
+/**
+ * @brief Has the receive interrupt count the frames with identifier 'id'
+ *        (CAN_WATCH_NONE: none) in 'slot' (< CAN_WATCH_COUNT), e.g. the
+ *        heartbeats of a consumed node.
+ */
+void can_watch(unsigned int slot, uint32_t id);
+
+/**
+ * @brief Returns the frames counted in 'slot' and sets 'cycles' to the
+ *        cycle count (boot_time_cycles()) at the reception of the last one.
+ */
+uint32_t can_watch_count(unsigned int slot, uint32_t *cycles);
+
 #endif /* PERIPHERAL_INC_CAN_H_ */
@@ -0,0 +1,31 @@
+#ifndef PERIPHERAL_INC_CONCISE_DCF_H_
+#define PERIPHERAL_INC_CONCISE_DCF_H_
+
+#include <lely/co/dev.h>
+
+// Object Dictionary entry receiving the configuration blob
+#define CONCISE_DCF_OBJ         0x2104 // DOMAIN (write only): concise DCF, CiA 306 format
+
+/**
+ * @brief Registers the download callback of the concise DCF domain (0x2104).
+ *
+ * The master writes a whole configuration in one (block) SDO download instead
+ * of one SDO per sub-object. The blob has the concise DCF layout:
+ *
+ *   u32 number of entries, then per entry: u16 index, u8 sub-index,
+ *   u32 data size, data (little-endian)
+ *
+ * The complete blob is buffered and checked first (objects exist, are
+ * writable parameters of the parameter storage, basic types with matching
+ * size). Process data and commands such as 0x6040, 0x6060 or 0x1010 abort
+ * the transfer with CO_SDO_AC_NO_WRITE before any entry is applied. Only then are the entries
+ * applied in order through the regular download indications, so PDO
+ * parameters are validated and taken over exactly as with separate SDO
+ * writes. If an entry is refused, the entries already applied are reverted
+ * in reverse order and the transfer is aborted with that entry's abort code.
+ *
+ * @param dev The CANopen device holding the Object Dictionary.
+ */
+void concise_dcf_init(co_dev_t *dev);
+
+#endif /* PERIPHERAL_INC_CONCISE_DCF_H_ */
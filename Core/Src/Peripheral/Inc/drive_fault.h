@@ -0,0 +1,50 @@
+#ifndef PERIPHERAL_INC_DRIVE_FAULT_H_
+#define PERIPHERAL_INC_DRIVE_FAULT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Errors of one axis, reported by EMCY with a CiA 402 error code.
+ *        Faults start the fault reaction and stay until a fault reset;
+ *        warnings are reported as long as their flag is set.
+ */
+enum drive_error {
+    DRIVE_ERROR_OVERTEMPERATURE,        // DRV_STATUS ot
+    DRIVE_ERROR_SHORT_TO_GROUND,        // DRV_STATUS s2ga, s2gb
+    DRIVE_ERROR_SHORT_TO_SUPPLY,        // DRV_STATUS s2vsa, s2vsb
+    DRIVE_ERROR_POWER_STAGE,            // GSTAT drv_err without a flag telling why
+    DRIVE_ERROR_UNDERVOLTAGE,           // GSTAT uv_cp
+    DRIVE_ERROR_FOLLOWING_ERROR,        // 0x6065/0x6066
+    DRIVE_ERROR_TEMPERATURE_WARNING,    // DRV_STATUS otpw
+    DRIVE_ERROR_OPEN_LOAD,              // DRV_STATUS ola, olb while moving
+    DRIVE_ERROR_COUNT,
+};
+
+#define DRIVE_ERROR_BIT(error)  (1u << (error))
+#define DRIVE_ERROR_WARNINGS    (DRIVE_ERROR_BIT(DRIVE_ERROR_TEMPERATURE_WARNING) | \
+                                 DRIVE_ERROR_BIT(DRIVE_ERROR_OPEN_LOAD))
+
+/**
+ * @brief Emergency error code and the error register (0x1001) bits of
+ *        one error.
+ */
+struct drive_error_code {
+    uint16_t code;
+    uint8_t error_register;
+};
+
+/**
+ * @brief Error code of 'error' (< DRIVE_ERROR_COUNT).
+ */
+const struct drive_error_code *drive_error_code(enum drive_error error);
+
+/**
+ * @brief Errors (DRIVE_ERROR_BIT()s) the TMC5160 reports in GSTAT and
+ *        DRV_STATUS. A driver error is classified by the DRV_STATUS flag
+ *        latched with it; open load only counts while the motor moves
+ *        (stst clear), overtemperature includes its pre-warning.
+ */
+uint32_t drive_error_decode(uint32_t gstat, uint32_t drv_status);
+
+#endif /* PERIPHERAL_INC_DRIVE_FAULT_H_ */
@@ -0,0 +1,64 @@
+#ifndef PERIPHERAL_INC_ENCODER_H_
+#define PERIPHERAL_INC_ENCODER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Following error window (0x6065) that disables the monitoring
+#define FOLLOWING_ERROR_WINDOW_OFF      0xFFFFFFFFu
+
+/**
+ * @brief Encoder on the motor shaft (0x2002).
+ */
+struct encoder_config {
+    uint32_t resolution;       // 0x2002:01 encoder counts per revolution (quadrature), 0 = no encoder
+    uint32_t motor_resolution; // 0x2002:02 usteps per revolution
+    bool inverted;             // 0x2002:03 encoder counts against the motor direction
+};
+
+/**
+ * @brief TMC5160 encoder registers for an encoder_config.
+ */
+struct encoder_regs {
+    uint32_t encmode;   // ENCMODE: A/B quadrature, no N channel, fraction format
+    int32_t enc_const;  // ENC_CONST: usteps per count, 16-bit integer and 16-bit fraction
+};
+
+/**
+ * @brief Computes ENCMODE and ENC_CONST so that X_ENC counts in usteps,
+ *        the unit of XACTUAL.
+ *
+ * The factor motor_resolution / resolution is given in binary (1/65536)
+ * or decimal (1/10000) fraction, whichever is exact, so X_ENC does not
+ * drift from XACTUAL over many revolutions. Common resolutions are exact
+ * in one of the two (51200 / 4000 = 12.8 in decimal, 51200 / 4096 = 12.5
+ * in binary); otherwise the binary factor is rounded to the nearest.
+ *
+ * @return false if there is no encoder or the factor exceeds +/-32767.
+ */
+bool encoder_compute(struct encoder_regs *regs, const struct encoder_config *config);
+
+/**
+ * @brief Following error monitoring (0x6065, 0x6066).
+ */
+struct following_error {
+    uint32_t window;   // 0x6065 in usteps, FOLLOWING_ERROR_WINDOW_OFF = off
+    uint32_t timeout;  // 0x6066 in ms
+    bool is_outside;   // |error| > window since 'since'
+    uint32_t since;
+};
+
+/**
+ * @brief Restarts the timeout, e.g. when the power stage is enabled.
+ */
+void following_error_reset(struct following_error *fe);
+
+/**
+ * @brief Takes a following error (position demand - actual position).
+ * @param now Time in ms.
+ * @return true once |error| has been above the window for at least the
+ *         timeout without interruption.
+ */
+bool following_error_update(struct following_error *fe, int32_t error, uint32_t now);
+
+#endif /* PERIPHERAL_INC_ENCODER_H_ */
@@ -0,0 +1,73 @@
+#ifndef PERIPHERAL_INC_FACTOR_GROUP_H_
+#define PERIPHERAL_INC_FACTOR_GROUP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Exact rational scaling y = x * num / den, rounded to the nearest
+ *        integer (halves away from zero). The fraction is kept reduced, and
+ *        the division by 'den' is a multiplication by its precomputed
+ *        reciprocal, so factor_scale() takes integer multiplies and shifts
+ *        only.
+ */
+struct factor {
+    uint64_t num;
+    uint64_t den;
+    uint64_t reciprocal; // floor((2^128 - 1) / (den << shift)) - 2^64
+    uint8_t shift;       // Leading zeros of 'den'
+};
+
+/**
+ * @brief Factor group of one axis (0x608F, 0x6091, 0x6092): every value on
+ *        the bus is in user units, positions, velocities per second and
+ *        accelerations per second squared. The drive works in usteps and
+ *        TMC5160 units:
+ *        usteps = user * encoder increments * gear motor revolutions
+ *                 * feed shaft revolutions
+ *                 / (motor revolutions * gear shaft revolutions * feed),
+ *        VMAX = usteps/s * 2^24 / fCLK, AMAX = usteps/s^2 * 2^41 / fCLK^2.
+ */
+struct factor_group {
+    struct factor position;     // User position units to usteps
+    struct factor position_inv; // usteps to user position units
+    struct factor velocity;     // User velocity units to VMAX
+    struct factor velocity_inv; // VACTUAL to user velocity units
+    struct factor acceleration; // User acceleration units to AMAX/DMAX
+};
+
+/**
+ * @brief Values of the factor objects, all at least 1.
+ */
+struct factor_group_config {
+    uint32_t encoder_increments;        // 0x608F:01, usteps per 'motor_revolutions'
+    uint32_t motor_revolutions;         // 0x608F:02
+    uint32_t gear_motor_revolutions;    // 0x6091:01
+    uint32_t gear_shaft_revolutions;    // 0x6091:02
+    uint32_t feed;                      // 0x6092:01, user units per 'feed_shaft_revolutions'
+    uint32_t feed_shaft_revolutions;    // 0x6092:02
+};
+
+/**
+ * @brief Computes the factors of 'config' (not on the hot path).
+ * @return false if a value is 0 or a reduced fraction does not fit 64 bits;
+ *         'group' is left unchanged then.
+ */
+bool factor_group_compute(struct factor_group *group, const struct factor_group_config *config);
+
+/**
+ * @brief Sets 'f' to num / den (den >= 1), reduced.
+ */
+void factor_init(struct factor *f, uint64_t num, uint64_t den);
+
+/**
+ * @brief x * num / den rounded, saturated to the int32_t range.
+ */
+int32_t factor_scale(const struct factor *f, int32_t x);
+
+/**
+ * @brief x * num / den rounded, saturated to the uint32_t range.
+ */
+uint32_t factor_scale_u32(const struct factor *f, uint32_t x);
+
+#endif /* PERIPHERAL_INC_FACTOR_GROUP_H_ */
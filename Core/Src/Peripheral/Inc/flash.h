@@ -0,0 +1,38 @@
+#ifndef PERIPHERAL_INC_FLASH_H_
+#define PERIPHERAL_INC_FLASH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Sectors reserved for parameter storage (see the linker scripts)
+#define FLASH_SECTOR_10_ADDR    0x080C0000 // 128 KB
+#define FLASH_SECTOR_11_ADDR    0x080E0000 // 128 KB
+#define FLASH_SECTOR_128K_SIZE  0x00020000
+
+/**
+ * @brief Erases one flash sector (0..11) to 0xFF.
+ *
+ * Blocks until the erase is finished (typ. 1 s for a 128 KB sector). The code
+ * runs from the same bank, so the CPU and all interrupts stall meanwhile.
+ *
+ * @param sector Sector number as in the reference manual (RM0090, 3.3).
+ * @return 0 on success, -1 on a flash error.
+ */
+int flash_erase_sector(uint32_t sector);
+
+/**
+ * @brief Programs 32-bit words (x32 parallelism, 2.7-3.6 V supply).
+ * @param address Word-aligned destination address in flash.
+ * @param data    Words to program.
+ * @param words   Number of words.
+ * @return 0 on success, -1 on a flash error.
+ */
+int flash_program(uintptr_t address, const uint32_t *data, size_t words);
+
+/**
+ * @brief Whether a flash operation is in progress (FLASH_SR BSY).
+ */
+bool flash_is_busy(void);
+
+#endif /* PERIPHERAL_INC_FLASH_H_ */
@@ -0,0 +1,48 @@
+#ifndef PERIPHERAL_INC_GEARING_H_
+#define PERIPHERAL_INC_GEARING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Gear ratio (0x2005:02): follower usteps per master count, in 1/65536
+#define GEARING_RATIO_SHIFT     16
+#define GEARING_RATIO_ONE       (1 << GEARING_RATIO_SHIFT)
+
+/**
+ * @brief Electronic gearing of one axis to the position of another node.
+ *        The master position is unwrapped into 64 bits, so a master counter
+ *        that wraps around keeps the follower going the same way, and the
+ *        demand position is computed from it afresh on every update: the
+ *        rounding never adds up however long the master runs.
+ */
+struct gearing {
+    bool is_started;    // A master position has been taken since gearing_reset()
+    int32_t last_master;
+    uint64_t master;    // Unwrapped master position, two's complement
+    int32_t target;     // Demand position of the last update
+};
+
+/**
+ * @brief Forgets the master position: the next one is taken as it is.
+ */
+void gearing_reset(struct gearing *g);
+
+/**
+ * @brief Takes a master position and computes the demand position
+ *        offset + ratio × master, rounded to the nearest ustep, modulo 2^32
+ *        like the TMC5160 position counter.
+ * @param ratio  Follower usteps per master count, in 1/65536 (negative
+ *               turns the other way).
+ * @param offset Follower position at master position 0, usteps.
+ * @return The demand position, also kept in 'target'.
+ */
+int32_t gearing_follow(struct gearing *g, int32_t master, int32_t ratio, int32_t offset);
+
+/**
+ * @brief Gearing error: demand position minus the actual position.
+ */
+static inline int32_t gearing_error(const struct gearing *g, int32_t actual) {
+    return (int32_t)((uint32_t)g->target - (uint32_t)actual);
+}
+
+#endif /* PERIPHERAL_INC_GEARING_H_ */
@@ -0,0 +1,48 @@
+#ifndef PERIPHERAL_INC_HEARTBEAT_H_
+#define PERIPHERAL_INC_HEARTBEAT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Consumer heartbeat time entries (0x1016:01..04)
+#define HEARTBEAT_CONSUMER_COUNT    4
+
+/**
+ * @brief Monitoring of the heartbeat of one node (an entry of 0x1016) on a
+ *        microsecond clock, checked from the motion tick. It starts with
+ *        the first heartbeat received; the heartbeat time expires once per
+ *        loss and the next heartbeat ends the loss.
+ */
+struct heartbeat_consumer {
+    uint8_t node_id;        // 0: entry not used
+    uint32_t time_us;       // Consumer heartbeat time
+    uint32_t received;      // Receptions counted at the last check
+    uint32_t last_us;       // Clock at the last heartbeat
+    bool is_started;        // A heartbeat has been received
+    bool is_expired;
+};
+
+/**
+ * @brief Takes a 0x1016 entry: node-ID in bits 16-23, time in ms in bits
+ *        0-15; node-ID 0 or above 127, or time 0, leave the entry unused.
+ * @param received Receptions counted so far: only later ones are heartbeats.
+ */
+void heartbeat_consumer_configure(struct heartbeat_consumer *c, uint32_t entry, uint32_t received);
+
+/**
+ * @brief Checks the heartbeat at 'now_us' (motion tick).
+ * @param received    Heartbeats received so far, counted by the caller.
+ * @param received_us Clock at the last of them.
+ * @return true when the heartbeat time has just expired.
+ */
+bool heartbeat_consumer_check(struct heartbeat_consumer *c, uint32_t received, uint32_t received_us,
+                              uint32_t now_us);
+
+/**
+ * @brief Time from the expiry of the heartbeat time to 'now_us'.
+ */
+static inline uint32_t heartbeat_consumer_overdue_us(const struct heartbeat_consumer *c, uint32_t now_us) {
+    return now_us - (c->last_us + c->time_us);
+}
+
+#endif /* PERIPHERAL_INC_HEARTBEAT_H_ */
@@ -0,0 +1,139 @@
+#ifndef PERIPHERAL_INC_HOMING_H_
+#define PERIPHERAL_INC_HOMING_H_
+
+#include "tmc5160.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Homing methods (0x6098)
+#define HOMING_METHOD_STALL_POSITIVE    -2 // Hard stop in positive direction, StallGuard2
+#define HOMING_METHOD_STALL_NEGATIVE    -1 // Hard stop in negative direction, StallGuard2
+#define HOMING_METHOD_SWITCH_NEGATIVE   17 // Negative limit switch (REFL), home at its release edge
+#define HOMING_METHOD_SWITCH_POSITIVE   18 // Positive limit switch (REFR), home at its release edge
+#define HOMING_METHOD_CURRENT_POSITION  35 // Current position (obsolete number of 37)
+#define HOMING_METHOD_CURRENT_POSITION_37 37
+
+// homing_load() in steps of HOMING_LOAD_DATAGRAMS register writes at most,
+// as does homing_load_stop()
+#define HOMING_LOAD_STEPS       2
+#define HOMING_LOAD_DATAGRAMS   6
+
+// Reference switch polarity (0x2001:02)
+#define HOMING_SWITCH_REFL_ACTIVE_LOW   (1u << 0)
+#define HOMING_SWITCH_REFR_ACTIVE_LOW   (1u << 1)
+
+enum homing_status {
+    HOMING_IDLE,        // Not started or interrupted
+    HOMING_IN_PROGRESS,
+    HOMING_ATTAINED,
+    HOMING_ERROR,       // Unsupported method
+};
+
+/**
+ * @brief Parameters of one homing run, taken from the Object Dictionary
+ *        when it is started.
+ */
+struct homing_config {
+    int8_t method;           // 0x6098
+    uint32_t fast;           // 0x6099:01, VMAX units: search for the switch or hard stop
+    uint32_t slow;           // 0x6099:02, VMAX units: leaving the switch
+    uint32_t accel;          // 0x609A, AMAX units
+    int32_t offset;          // 0x607C: position of the home position after homing
+    int8_t sgt;              // 0x2001:01 StallGuard2 threshold
+    uint8_t switch_polarity; // 0x2001:02
+    uint32_t gconf;          // GCONF of normal operation, restored afterwards
+};
+
+enum homing_phase {
+    HOMING_PHASE_NONE,
+    HOMING_PHASE_SEARCH,   // Velocity mode towards the switch or hard stop
+    HOMING_PHASE_RELEASE,  // Slowly off the switch until its release edge is latched
+    HOMING_PHASE_RETURN,   // Positioning back to the latched release edge
+    HOMING_PHASE_STOP,     // Interrupted: decelerating to standstill
+};
+
+/**
+ * @brief Homing of one axis. Set up with homing_init().
+ */
+struct homing {
+    struct tmc5160 *drv;
+    struct homing_config config;
+    enum homing_status status;
+    enum homing_phase phase;
+    int32_t latch;   // XLATCH of the release edge
+    uint16_t sg_min; // Lowest SG_RESULT at search speed
+};
+
+/**
+ * @brief Binds a homing instance to the TMC5160 of its axis; status HOMING_IDLE.
+ */
+void homing_init(struct homing *homing, struct tmc5160 *drv);
+
+/**
+ * @brief Starts homing with 'config'. The current position methods
+ *        complete at once; the others move the motor in velocity mode
+ *        and are advanced by homing_poll().
+ *
+ * Only the status and phase change here: homing_load() writes the
+ * registers (e.g. from the motion tick) before homing_poll() runs. The
+ * ramp generator registers (VMAX, V1, AMAX, DMAX, D1, RAMPMODE) are
+ * overwritten; the caller writes its motion profile again afterwards.
+ *
+ * @return false for an unsupported method (status HOMING_ERROR); there is
+ *         nothing to load then.
+ */
+bool homing_start(struct homing *homing, const struct homing_config *config);
+
+/**
+ * @brief Writes the TMC5160 registers of the run homing_start() began, in
+ *        steps 0 to HOMING_LOAD_STEPS - 1: the home position for the
+ *        current position methods; the switch and StallGuard2 settings,
+ *        then the ramp and the search for the others.
+ */
+void homing_load(struct homing *homing, unsigned int step);
+
+/**
+ * @brief Advances a homing run. Call it from the main loop.
+ */
+void homing_poll(struct homing *homing);
+
+/**
+ * @brief Interrupts a homing run: the status becomes HOMING_IDLE and
+ *        homing_poll() holds the position in positioning mode once the
+ *        motor is at rest.
+ * @return true if the motor is to be stopped with homing_load_stop().
+ */
+bool homing_abort(struct homing *homing);
+
+/**
+ * @brief Writes the stop of an interrupted run: decelerates with 'decel'
+ *        (AMAX units) in velocity mode.
+ */
+void homing_load_stop(struct homing *homing, uint32_t decel);
+
+/**
+ * @brief Back to HOMING_IDLE when no homing run is moving the motor,
+ *        e.g. when homing mode is entered again.
+ */
+void homing_reset(struct homing *homing);
+
+/**
+ * @brief Status for the statusword bits 10, 12 and 13 of homing mode.
+ */
+enum homing_status homing_get_status(const struct homing *homing);
+
+/**
+ * @brief Whether homing owns the ramp generator: a run or the stop of an
+ *        interrupted run is still in progress.
+ */
+bool homing_is_moving(const struct homing *homing);
+
+/**
+ * @brief Lowest StallGuard2 value (DRV_STATUS SG_RESULT) seen at search
+ *        speed in the last StallGuard homing run, for tuning SGT.
+ *        0x3FF if none was measured.
+ */
+uint16_t homing_sg_result(const struct homing *homing);
+
+#endif /* PERIPHERAL_INC_HOMING_H_ */
@@ -0,0 +1,137 @@
+#ifndef PERIPHERAL_INC_INTERPOLATION_H_
+#define PERIPHERAL_INC_INTERPOLATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Interpolation points one axis can buffer (0x60C4:01, power of two)
+#define INTERPOLATION_BUFFER_DEPTH  1024
+
+// Buffered points the look-ahead examines per step at most
+#define INTERPOLATION_SCAN_MAX      64
+
+// Interpolation time index (0x60C2:02): period = value * 10^index s
+#define INTERPOLATION_INDEX_MIN     -6
+#define INTERPOLATION_INDEX_MAX     -3
+
+/**
+ * @brief Point storage of one axis, kept apart from struct interpolation so
+ *        it can be placed in the CCM RAM.
+ */
+struct interpolation_buffer {
+    int32_t points[INTERPOLATION_BUFFER_DEPTH];
+};
+
+/**
+ * @brief Ramp generator registers for one interpolation step.
+ */
+struct interpolation_step {
+    int32_t xtarget; // End of the monotonic run the point belongs to
+    uint32_t vmax;   // Speed that covers the segment in one period
+};
+
+/**
+ * @brief Interpolated Position buffer of one axis: a single-producer,
+ *        single-consumer ring. The main loop pushes points and starts and
+ *        stops the consumption; the motion timer interrupt consumes one point
+ *        per interpolation period with interpolation_tick(). Set up with
+ *        interpolation_init().
+ */
+struct interpolation {
+    int32_t *points;
+    uint32_t size;              // 0x60C4:02: points accepted at most
+    volatile uint32_t head;     // Free-running; written by the producer only
+    volatile uint32_t tail;     // Free-running; written by the consumer only
+    volatile bool is_accepting; // 0x60C4:06: access to the buffer enabled
+    volatile bool is_enabled;   // Consumption running (controlword bit 4)
+
+    // Consumer state, owned by interpolation_tick() while enabled
+    int32_t position;           // Last consumed point
+    uint32_t period_us;
+    uint32_t ticks_per_point;
+    uint32_t ticks;
+    bool is_running;            // Points are being consumed without a gap
+    volatile uint32_t underruns;
+
+    // Look-ahead: end of the monotonic run ahead of the consumer
+    uint32_t scan_index;        // Next point to examine
+    int32_t scan_position;      // Last point of the run found so far
+    int8_t scan_dir;
+    bool is_run_closed;         // The run ends at scan_position
+};
+
+/**
+ * @brief Binds an empty buffer with access enabled and the full size;
+ *        consumption disabled.
+ */
+void interpolation_init(struct interpolation *ip, struct interpolation_buffer *buffer);
+
+/**
+ * @brief Interpolation period in microseconds from the time period value and
+ *        index (0x60C2), 0 for an index out of range.
+ */
+uint32_t interpolation_period_us(uint8_t value, int8_t index);
+
+/**
+ * @brief Appends a point (main loop).
+ * @return false if access is disabled or 'size' points are buffered.
+ */
+bool interpolation_push(struct interpolation *ip, int32_t point);
+
+/**
+ * @brief Number of buffered points.
+ */
+size_t interpolation_count(const struct interpolation *ip);
+
+/**
+ * @brief Points that can still be pushed.
+ */
+size_t interpolation_space(const struct interpolation *ip);
+
+/**
+ * @brief Enables or disables access to the buffer (0x60C4:06). Disabling
+ *        drops the buffered points; consumption must be stopped then.
+ */
+void interpolation_set_access(struct interpolation *ip, bool enable);
+
+/**
+ * @brief Sets the buffer size (0x60C4:02) and drops the buffered points.
+ *        Consumption must be stopped.
+ * @return false for a size of 0 or over INTERPOLATION_BUFFER_DEPTH.
+ */
+bool interpolation_set_size(struct interpolation *ip, uint32_t size);
+
+/**
+ * @brief Starts consuming one point every 'period_us', rounded to a multiple
+ *        of the timer tick 'tick_us', from the motor standing at 'position'.
+ *        The first point is taken at the next tick.
+ */
+void interpolation_start(struct interpolation *ip, int32_t position, uint32_t period_us, uint32_t tick_us);
+
+/**
+ * @brief Stops consuming (main loop). Once this returns the interrupt no
+ *        longer touches the consumer state.
+ */
+void interpolation_stop(struct interpolation *ip);
+
+/**
+ * @brief One timer tick (interrupt). At each interpolation period the next
+ *        point is taken and 'step' filled. Running out of points counts one
+ *        underrun; the motor then stops at the last point.
+ * @return true if 'step' is to be written to the TMC5160.
+ */
+bool interpolation_tick(struct interpolation *ip, struct interpolation_step *step);
+
+/**
+ * @brief Last consumed point: where the motor stops after interpolation_stop().
+ */
+static inline int32_t interpolation_position(const struct interpolation *ip) {
+    return ip->position;
+}
+
+static inline uint32_t interpolation_underruns(const struct interpolation *ip) {
+    return ip->underruns;
+}
+
+#endif /* PERIPHERAL_INC_INTERPOLATION_H_ */
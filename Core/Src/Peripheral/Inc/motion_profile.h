@@ -0,0 +1,91 @@
+#ifndef PERIPHERAL_INC_MOTION_PROFILE_H_
+#define PERIPHERAL_INC_MOTION_PROFILE_H_
+
+#include <stdint.h>
+
+// Motion profile type (0x6086)
+#define MOTION_PROFILE_LINEAR           0 // Trapezoidal ramp: AMAX/DMAX only, V1 = 0
+#define MOTION_PROFILE_JERK_LIMITED     3 // S-curve approximation; 1 and 2 are handled the same
+
+/**
+ * @brief Ramp generator registers of a motion profile, in TMC5160 units.
+ */
+struct tmc5160_ramp {
+    uint32_t vmax;  // VMAX
+    uint32_t v1;    // V1, 0 disables the A1/D1 phases
+    uint32_t a1;    // A1, between VSTART and V1
+    uint32_t amax;  // AMAX, between V1 and VMAX
+    uint32_t dmax;  // DMAX, between VMAX and V1
+    uint32_t d1;    // D1, between V1 and VSTOP
+};
+
+/**
+ * @brief Computes the six-point ramp for a motion profile.
+ *
+ * A linear profile accelerates with 'accel' from standstill. The S-curve
+ * approximation splits every ramp in two: half the acceleration up to V1,
+ * where an ideal jerk-limited ramp would reach full acceleration
+ * (V1 = a^2 / (2 * jerk), for the larger of 'accel' and 'decel'), then the
+ * full acceleration. The acceleration steps are halved, the time spent
+ * below V1 is that of the ideal ramp.
+ *
+ * @param ramp  Receives the registers, clamped to their widths.
+ * @param type  0x6086 motion profile type.
+ * @param vmax  Velocity in VMAX units.
+ * @param accel Acceleration in AMAX units.
+ * @param decel Deceleration in DMAX units.
+ * @param jerk  Jerk limit in usteps/s^3 (0x60A4:01), 0 = no limit (linear).
+ */
+void motion_profile_compute(struct tmc5160_ramp *ramp, int16_t type, uint32_t vmax,
+                            uint32_t accel, uint32_t decel, uint32_t jerk);
+
+/**
+ * @brief Distance in usteps the ramp needs to stop from 'speed' (VMAX units):
+ *        (v^2 - V1^2) / (256 * DMAX) + V1^2 / (256 * D1) above V1.
+ */
+uint32_t motion_profile_brake_distance(const struct tmc5160_ramp *ramp, uint32_t speed);
+
+/**
+ * @brief Linear stopping ramp: AMAX = DMAX = D1 = 'decel', V1 = 0.
+ *        Used for halt, quick stop and the fault reaction.
+ */
+void motion_profile_stop_ramp(struct tmc5160_ramp *ramp, uint32_t vmax, uint32_t decel);
+
+/**
+ * @brief XTARGET that stops the motor with the ramp of
+ *        motion_profile_stop_ramp() as soon as it is written.
+ *
+ * The braking distance v^2 / (256 * decel) is rounded up and extended by
+ * 'lead_clocks' of travel, the time between reading XACTUAL/VACTUAL and
+ * writing XTARGET, at the highest speed the motor can reach meanwhile.
+ * A target short of the braking distance would make the ramp overshoot
+ * and come back.
+ *
+ * @param xactual     XACTUAL when the stop was decided.
+ * @param vactual     VACTUAL at that time (sign-extended).
+ * @param decel       Stopping deceleration in DMAX units.
+ * @param lead_clocks fCLK periods until XTARGET is written.
+ */
+int32_t motion_profile_stop_position(int32_t xactual, int32_t vactual, uint32_t decel,
+                                     uint32_t lead_clocks);
+
+/**
+ * @brief Velocity of Cyclic Synchronous Velocity mode: target velocity
+ *        (0x60FF) plus velocity offset (0x60B1), in VMAX units with the
+ *        sign of the direction, saturated at the largest VMAX.
+ */
+int32_t motion_profile_csv_velocity(int32_t target, int32_t offset);
+
+/**
+ * @brief AMAX of Cyclic Synchronous Velocity mode: the smallest that takes
+ *        the velocity from 'from' to 'to' (VMAX units, signed) within one
+ *        SYNC period, so each set-point is reached as the next one comes
+ *        in. The velocity changes by AMAX every 2^17 clocks, hence
+ *        AMAX = |to - from| * 2^17 / (fCLK * period), rounded up.
+ *
+ * @param period_us SYNC period in microseconds, 0 if not known yet (the
+ *                  largest AMAX).
+ */
+uint32_t motion_profile_csv_accel(int32_t from, int32_t to, uint32_t period_us);
+
+#endif /* PERIPHERAL_INC_MOTION_PROFILE_H_ */
@@ -0,0 +1,137 @@
+#ifndef PERIPHERAL_INC_MOTION_QUEUE_H_
+#define PERIPHERAL_INC_MOTION_QUEUE_H_
+
+#include "spi.h" // SPI1_DAISY_CHAIN_LENGTH
+#include "tmc5160.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Commands that can wait for the motion tick (power of two)
+#define MOTION_QUEUE_DEPTH      64
+
+// Commands one motion tick executes at most, bounding its duration
+#define MOTION_QUEUE_TICK_MAX   16
+
+// SPI1 time of one datagram (40 bits at 1.3125 MHz with the chip select
+// and byte gaps); a daisy chain frame carries one for every chained chip
+#define MOTION_TICK_DATAGRAM_NS (31000u * (SPI1_DAISY_CHAIN_LENGTH ? SPI1_DAISY_CHAIN_LENGTH : 1u))
+
+// Share of the tick period its SPI accesses may take: the rest is left to
+// SysTick and the main loop
+#define MOTION_TICK_SPI_LOAD_PERCENT    75
+
+// Datagrams of the sample of one axis: four registers, pipelined
+#define MOTION_TICK_SAMPLE_DATAGRAMS    5
+
+// Datagrams of the largest command (STOP, CONFIGURE, a homing CALL)
+#define MOTION_COMMAND_DATAGRAMS_MAX    6
+
+// Datagrams of one write to 'chips' TMC5160s: one frame in a daisy chain
+#define MOTION_BATCH_DATAGRAMS(chips)   (SPI1_DAISY_CHAIN_LENGTH ? 1u : (unsigned int)(chips))
+
+enum motion_command_type {
+    MOTION_COMMAND_WRITE, // 'address' = 'value'
+    MOTION_COMMAND_COPY,  // 'address' = the register 'value' (e.g. XTARGET = XACTUAL)
+    MOTION_COMMAND_STOP,  // XTARGET where a linear ramp of 'value' (DMAX units) stops the motor
+    MOTION_COMMAND_ENABLE,    // Power stage on ('value' != 0) or off: CHOPCONF with or without TOFF
+    MOTION_COMMAND_CONFIGURE, // Driver settings of drv->config (GCONF, CHOPCONF, currents, ...)
+    MOTION_COMMAND_CALL,  // 'call'('context', 'value'): the accesses of a module, e.g. a homing start
+    MOTION_COMMAND_MARK,  // No access: records its latency once the commands before it are done
+};
+
+/**
+ * @brief One TMC5160 access posted by the main loop, stamped with the cycle
+ *        count it was posted at (or the event it serves, e.g. a SYNC).
+ */
+struct motion_command {
+    struct tmc5160 *drv; // NULL for MOTION_COMMAND_MARK
+    uint32_t posted;
+    int32_t value;
+    uint8_t type;
+    uint8_t address;
+    uint8_t datagrams; // MOTION_COMMAND_CALL: most datagrams 'call' sends, up to MOTION_COMMAND_DATAGRAMS_MAX
+    void (*call)(void *context, int32_t value); // MOTION_COMMAND_CALL
+    void *context;
+};
+
+/**
+ * @brief Commands from the main loop (single producer) to the motion timer
+ *        interrupt (single consumer), which executes them in order. Writes
+ *        of one register to several chips in a row go out as one batch.
+ *        Zero-initialized it is empty; 'cycles' must be set before use.
+ */
+struct motion_queue {
+    struct motion_command entries[MOTION_QUEUE_DEPTH];
+    volatile uint32_t head; // Free-running; written by the producer only
+    volatile uint32_t tail; // Free-running; written by the consumer only
+    uint32_t (*cycles)(void);
+    volatile uint32_t discarded; // Chip selects (bit 'cs') whose commands are dropped unexecuted
+
+    // Statistics in cycles of 'cycles', kept by the consumer
+    volatile uint32_t executed;
+    volatile uint32_t max_latency;  // Posting to the end of the access, worst command
+    volatile uint32_t marks;        // MOTION_COMMAND_MARKs executed
+    volatile uint32_t mark_latency; // Latency of the last one
+};
+
+/**
+ * @brief Appends a command (main loop).
+ * @param index Set to the position of the command for motion_queue_is_done();
+ *              may be NULL.
+ * @return false if the queue is full.
+ */
+bool motion_queue_post(struct motion_queue *q, const struct motion_command *cmd, uint32_t *index);
+
+/**
+ * @brief Whether the command posted at 'index' has been executed.
+ */
+bool motion_queue_is_done(const struct motion_queue *q, uint32_t index);
+
+/**
+ * @brief Whether every posted command has been executed.
+ */
+static inline bool motion_queue_is_empty(const struct motion_queue *q) {
+    return q->head == q->tail;
+}
+
+/**
+ * @brief Executes up to MOTION_QUEUE_TICK_MAX commands and 'budget'
+ *        datagrams (motion tick, or the main loop with the motion tick
+ *        masked). The first command that does not fit waits for the next
+ *        call; one larger than the whole budget runs alone.
+ * @return The number of commands executed.
+ */
+unsigned int motion_queue_execute(struct motion_queue *q, unsigned int budget);
+
+/**
+ * @brief Datagrams a command sends to its TMC5160 (0 for a mark).
+ */
+unsigned int motion_command_datagrams(const struct motion_command *cmd);
+
+/**
+ * @brief Datagrams a motion tick of 'period_us' has left for commands once
+ *        'axes' fitted axes have been served: two interpolation writes to
+ *        all of them and the sample of one.
+ */
+unsigned int motion_tick_budget(uint32_t period_us, unsigned int axes);
+
+/**
+ * @brief Shortest tick period whose budget holds the largest command with
+ *        'axes' fitted axes.
+ */
+uint32_t motion_tick_min_period_us(unsigned int axes);
+
+/**
+ * @brief Executes one command at once, outside the queue (motion tick, or
+ *        the main loop with the motion tick masked). Not for marks.
+ */
+void motion_command_execute(const struct motion_command *cmd);
+
+/**
+ * @brief Restarts the statistics (motion tick, or the main loop with the
+ *        motion tick masked).
+ */
+void motion_queue_reset_stats(struct motion_queue *q);
+
+#endif /* PERIPHERAL_INC_MOTION_QUEUE_H_ */
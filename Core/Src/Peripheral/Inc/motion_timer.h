@@ -0,0 +1,36 @@
+#ifndef PERIPHERAL_INC_MOTION_TIMER_H_
+#define PERIPHERAL_INC_MOTION_TIMER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tick of the motion timer (TIM7): default and range of 0x2107:01
+#define MOTION_TIMER_PERIOD_US      250
+#define MOTION_TIMER_PERIOD_MIN_US  250
+#define MOTION_TIMER_PERIOD_MAX_US  2000
+
+// Below CAN RX (5), so received frames are never held up by a tick, and
+// above SysTick
+#define MOTION_TIMER_IRQ_PRIORITY   6
+
+/**
+ * @brief Starts TIM7 with an update interrupt every 'period_us'
+ *        (MOTION_TIMER_PERIOD_MIN_US to MOTION_TIMER_PERIOD_MAX_US, else
+ *        MOTION_TIMER_PERIOD_US), each calling 'handler' in interrupt context.
+ *
+ * TIM7 runs from the 84 MHz APB1 timer clock, prescaled to 1 MHz.
+ */
+void motion_timer_start(uint32_t period_us, void (*handler)(void));
+
+/**
+ * @brief Changes the tick period from the next update on.
+ * @return false for a period out of range (nothing changed).
+ */
+bool motion_timer_set_period(uint32_t period_us);
+
+/**
+ * @brief The tick period in effect, in microseconds.
+ */
+uint32_t motion_timer_period_us(void);
+
+#endif /* PERIPHERAL_INC_MOTION_TIMER_H_ */
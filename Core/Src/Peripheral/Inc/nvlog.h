@@ -0,0 +1,93 @@
+#ifndef PERIPHERAL_INC_NVLOG_H_
+#define PERIPHERAL_INC_NVLOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Log-structured key/value store in two flash sectors.
+ *
+ * The active sector starts with a header slot and holds 12-byte records
+ * (key, value, CRC) appended in batches: BEGIN, values..., COMMIT. A batch
+ * only counts once its COMMIT is in flash, so an interrupted store leaves the
+ * previous values in effect. Only values that changed are appended; when the
+ * sector is full, the complete set is written to the other sector (compaction)
+ * and its header is programmed last; the higher sequence number makes it the
+ * active one. The old sector becomes the spare, erased by nvlog_erase_spare()
+ * whenever the caller can afford the stall, or by the next compaction at the
+ * latest. Both sectors are thus erased equally often and only once per
+ * sector-full of stores.
+ *
+ * No hardware or CANopen dependency: the flash is accessed through
+ * struct nvlog_flash, so the format can be tested on the host.
+ */
+
+#define NVLOG_SECTORS           2
+#define NVLOG_SLOT_SIZE         12         // Bytes per record
+#define NVLOG_KEY_MAX           0x00FFFFFF // Keys are 24 bit
+#define NVLOG_MAX_ENTRIES       640        // Largest set accepted by nvlog_store()
+
+struct nvlog_flash {
+    const uint8_t *base[NVLOG_SECTORS]; // Memory-mapped start of each sector
+    uint32_t size;                      // Bytes per sector
+    // Erases sector 0 or 1 to all 0xFF. Returns 0 on success.
+    int (*erase)(unsigned int sector);
+    // Programs 'words' 32-bit words at 'dst' (word aligned). Returns 0 on success.
+    int (*program)(const uint8_t *dst, const uint32_t *src, size_t words);
+};
+
+struct nvlog {
+    const struct nvlog_flash *flash;
+    int active;    // Sector holding the log, -1 while none does
+    uint32_t seq;  // Sequence number of the active sector
+    uint32_t end;  // First free slot of the active sector
+    bool is_spare_erased; // The sector the next compaction writes is known to be blank
+};
+
+struct nvlog_entry {
+    uint32_t key;
+    uint32_t value;
+};
+
+/**
+ * @brief Called for each stored value, newest first. Older values of a key
+ *        already seen must be ignored by the caller.
+ * @return 0 to continue, anything else to stop the scan.
+ */
+typedef int nvlog_visit_t(uint32_t key, uint32_t value, void *data);
+
+/**
+ * @brief Selects the active sector and finds the end of the log.
+ *
+ * Reads the two header slots and binary-searches the first free slot, so no
+ * record is scanned here and nothing is written to flash.
+ */
+void nvlog_mount(struct nvlog *log, const struct nvlog_flash *flash);
+
+/**
+ * @brief Visits all committed values with one backward scan of the log.
+ */
+void nvlog_for_each(const struct nvlog *log, nvlog_visit_t *visit, void *data);
+
+/**
+ * @brief Stores a complete set of values as one atomic batch.
+ *
+ * Only entries whose value differs from the stored one (or that are not
+ * stored yet) are appended. If they do not fit, the log is compacted into the
+ * other sector with all 'n' entries; keys missing from 'entries' are dropped.
+ *
+ * @return 0 on success (also when nothing changed), -1 if 'n' is too large
+ *         for a sector or the flash reported an error.
+ */
+int nvlog_store(struct nvlog *log, const struct nvlog_entry *entries, size_t n);
+
+/**
+ * @brief Erases the sector the next compaction writes, unless it is known to
+ *        be blank already (checked once after mounting), so that a store does
+ *        not have to erase. No-op once 'is_spare_erased' is set.
+ * @return 0 on success, -1 if the flash reported an error.
+ */
+int nvlog_erase_spare(struct nvlog *log);
+
+#endif /* PERIPHERAL_INC_NVLOG_H_ */
@@ -0,0 +1,50 @@
+#ifndef PERIPHERAL_INC_NVPARAM_H_
+#define PERIPHERAL_INC_NVPARAM_H_
+
+#include <lely/co/dev.h>
+#include <stdbool.h>
+
+// Object Dictionary entries owned by the parameter storage
+#define NVPARAM_OBJ_STORE       0x1010 // ARRAY: store parameters, write "save"
+#define NVPARAM_OBJ_RESTORE     0x1011 // ARRAY: restore default parameters, write "load"
+
+/**
+ * @brief Restores the stored parameters and registers the 0x1010/0x1011 callbacks.
+ *
+ * The parameters live in an nvlog in flash sectors 10 and 11. Mounting the log
+ * and one backward scan over it put the stored values straight into the Object
+ * Dictionary, so this must run before co_nmt_create(): Lely takes the values
+ * it falls back to on NMT resets from the device at that point.
+ *
+ * Writing "save" to 0x1010:01..04 stores all / communication / application /
+ * manufacturer parameters. Writing "load" to 0x1011:01..04 stores the DCF
+ * defaults of that group, effective from the next boot (CiA 301).
+ *
+ * Erasing a 128 KB sector stalls the MCU for 1-2 s on the single-bank F407:
+ * instruction fetch waits for the flash, so the motion tick, the heartbeat
+ * consumer and the node's own heartbeat stop meanwhile. The sector a
+ * compaction needs is therefore erased ahead of time by nvparam_poll(), and
+ * stores are refused (0x08000022) while 'is_busy' reports motion. A store
+ * then only programs flash; it erases itself only if nvparam_poll() had no
+ * idle moment since the previous compaction.
+ *
+ * @param dev     The CANopen device holding the Object Dictionary.
+ * @param is_busy Whether a drive is enabled, so the MCU must not stall.
+ */
+void nvparam_init(co_dev_t *dev, bool (*is_busy)(void));
+
+/**
+ * @brief Erases the spare sector of the log (main loop), once the flash is
+ *        idle and 'is_busy' reports no motion. Stalls the MCU for 1-2 s when
+ *        it erases, which happens once after a compaction.
+ */
+void nvparam_poll(void);
+
+/**
+ * @brief Whether a sub-object belongs to the stored parameters. Process data
+ *        and commands (controlword, mode of operation, target position, scope
+ *        control, 0x1010/0x1011 themselves) do not.
+ */
+bool nvparam_is_stored(co_unsigned16_t idx, co_unsigned8_t subidx);
+
+#endif /* PERIPHERAL_INC_NVPARAM_H_ */
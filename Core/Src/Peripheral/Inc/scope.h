@@ -0,0 +1,61 @@
+#ifndef PERIPHERAL_INC_SCOPE_H_
+#define PERIPHERAL_INC_SCOPE_H_
+
+#include "tmc5160.h"
+
+#include <lely/co/dev.h>
+#include <stdint.h>
+
+// Object Dictionary entries owned by the recorder
+#define SCOPE_OBJ_CONFIG        0x2100 // RECORD: channels, period, pre-trigger, control, state
+#define SCOPE_OBJ_CAPTURE       0x2101 // DOMAIN: header + samples, read via SDO (block) upload
+
+// Channel bits of 0x2100:01. Samples store the enabled channels in bit order.
+#define SCOPE_CH_TIME           (1 << 0) // us since arming (cycle counter), always recorded
+#define SCOPE_CH_XACTUAL        (1 << 1) // TMC5160 XACTUAL
+#define SCOPE_CH_VACTUAL        (1 << 2) // TMC5160 VACTUAL (sign-extended)
+#define SCOPE_CH_RAMP_STAT      (1 << 3) // TMC5160 RAMP_STAT
+#define SCOPE_CH_SG_RESULT      (1 << 4) // DRV_STATUS SG_RESULT [9:0]
+#define SCOPE_CH_CS_ACTUAL      (1 << 5) // DRV_STATUS CS_ACTUAL [20:16]
+#define SCOPE_CH_STATUSWORD     (1 << 6) // CiA 402 statusword of axis 1 (0x6041)
+#define SCOPE_CH_ALL            0x7F
+
+// Values of 0x2100:04 (control, written by the master)
+#define SCOPE_CMD_STOP          0
+#define SCOPE_CMD_ARM           1 // Record pre-trigger history, wait for a trigger
+#define SCOPE_CMD_TRIGGER       2 // Trigger now (arms first if idle)
+
+// Values of 0x2100:05 (state, read only)
+typedef enum {
+    SCOPE_STATE_IDLE,
+    SCOPE_STATE_ARMED,
+    SCOPE_STATE_TRIGGERED,
+    SCOPE_STATE_DONE
+} scope_state_t;
+
+/**
+ * @brief Registers the recorder's SDO callbacks on objects 0x2100 and 0x2101.
+ * @param dev The CANopen device holding the Object Dictionary.
+ * @param drv The TMC5160 whose registers are recorded (axis 1).
+ */
+void scope_init(co_dev_t *dev, struct tmc5160 *drv);
+
+/**
+ * @brief Takes a sample if the recorder is running and the sample period elapsed.
+ *
+ * Called from the super-loop, so the sample instants jitter with the loop;
+ * each sample therefore carries its time from the cycle counter, and the
+ * upload header the measured mean period. Sampling stays out of the motion
+ * tick, whose SPI time is budgeted. All enabled TMC5160 channels are fetched
+ * with a single tmc5160_read_registers() burst and stored in the CCM RAM ring
+ * buffer.
+ */
+void scope_poll(void);
+
+/**
+ * @brief Trigger event from the motion logic (e.g. a new set-point was started).
+ *        Ignored unless the recorder is armed.
+ */
+void scope_trigger(void);
+
+#endif /* PERIPHERAL_INC_SCOPE_H_ */
@@ -0,0 +1,24 @@
+#ifndef PERIPHERAL_INC_SDO_TEST_H_
+#define PERIPHERAL_INC_SDO_TEST_H_
+
+#include <lely/co/dev.h>
+
+// Object Dictionary entries owned by the SDO transfer test
+#define SDO_TEST_OBJ_DOMAIN     0x2102 // DOMAIN: streamed test pattern (upload and download)
+#define SDO_TEST_OBJ_CONFIG     0x2103 // RECORD: upload size, download statistics
+
+/**
+ * @brief Registers the streaming callbacks of the SDO test domain (0x2102).
+ *
+ * An upload of 0x2102 produces 0x2103:01 bytes of a known pattern, generated
+ * chunk by chunk. A download is checked against the same pattern as the
+ * chunks arrive and is never stored, so transfers of any size can be used to
+ * exercise expedited, segmented and block SDO without buffering the data.
+ *
+ * The pattern byte at offset i is (i * 7 + (i >> 8)) & 0xFF.
+ *
+ * @param dev The CANopen device holding the Object Dictionary.
+ */
+void sdo_test_init(co_dev_t *dev);
+
+#endif /* PERIPHERAL_INC_SDO_TEST_H_ */
@@ -0,0 +1,66 @@
+#ifndef PERIPHERAL_INC_SETPOINT_H_
+#define PERIPHERAL_INC_SETPOINT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Set-points that can wait behind the one being executed (power of two)
+#define SETPOINT_FIFO_DEPTH     8
+
+/**
+ * @brief One Profile Position set-point, with the profile parameters that
+ *        were in the Object Dictionary when it was accepted (0 = unchanged).
+ */
+struct setpoint {
+    int32_t target;       // 0x607A
+    int32_t velocity;     // 0x6081
+    uint32_t accel;       // 0x6083
+    uint32_t decel;       // 0x6084
+    int16_t profile_type; // 0x6086
+    uint32_t jerk;        // 0x60A4:01
+    bool blend;           // Controlword bit 9: continue to the next set-point without stopping
+};
+
+/**
+ * @brief Set-point buffer of one axis. Zero-initialized it is empty.
+ */
+struct setpoint_fifo {
+    struct setpoint entries[SETPOINT_FIFO_DEPTH];
+    uint32_t head; // Free-running indices; the difference is the fill level
+    uint32_t tail;
+};
+
+/**
+ * @brief Drops all buffered set-points.
+ */
+void setpoint_clear(struct setpoint_fifo *fifo);
+
+/**
+ * @brief Appends a set-point to the buffer.
+ * @return false if the buffer is full (the set-point is not accepted).
+ */
+bool setpoint_push(struct setpoint_fifo *fifo, const struct setpoint *sp);
+
+/**
+ * @brief Returns the oldest buffered set-point without removing it,
+ *        or NULL if the buffer is empty.
+ */
+const struct setpoint *setpoint_peek(const struct setpoint_fifo *fifo);
+
+/**
+ * @brief Removes the oldest buffered set-point.
+ * @return false if the buffer was empty.
+ */
+bool setpoint_pop(struct setpoint_fifo *fifo, struct setpoint *sp);
+
+/**
+ * @brief Number of buffered set-points.
+ */
+size_t setpoint_count(const struct setpoint_fifo *fifo);
+
+static inline bool setpoint_is_full(const struct setpoint_fifo *fifo) {
+    return setpoint_count(fifo) == SETPOINT_FIFO_DEPTH;
+}
+
+#endif /* PERIPHERAL_INC_SETPOINT_H_ */
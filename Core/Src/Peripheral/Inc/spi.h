@@ -2,16 +2,32 @@
 #define PERIPHERAL_INC_SPI_H_
 
 #include "stm32f4xx.h"
+#include <stddef.h>
 #include <stdint.h>
 
+// TMC5160 chip selects on SPI1: PA4, PE7, PE8, PE9 (axis 1-4)
+#define SPI1_CS_COUNT   4
+
+// Boards with the TMC5160s daisy-chained behind PA4 (MOSI to SDI of axis 1,
+// its SDO to SDI of axis 2, ..., SDO of the last one to MISO) build with
+// -DSPI1_DAISY_CHAIN_LENGTH=<chips>. 0: each TMC5160 on its own chip select.
+#ifndef SPI1_DAISY_CHAIN_LENGTH
+#define SPI1_DAISY_CHAIN_LENGTH 0
+#endif
+
+// Interrupts at this priority or below may access SPI1 (the motion timer);
+// spi1_lock() masks them, higher ones (CAN RX) keep running.
+#define SPI1_LOCK_PRIORITY  6
+
 /**
  * @brief Configures GPIO pins for SPI1 and initializes the SPI1 peripheral.
  *
  * This function performs the following configurations:
  * 1. Enables the clock for GPIOA.
  * 2. Configures PA5 (SCK), PA6 (MISO), and PA7 (MOSI) for Alternate Function 5 (SPI1).
- * 3. Configures PA4 (CSN) as a general-purpose output pin for software-controlled Chip Select.
- * 4. Enables the clock for the SPI1 peripheral.
+ * 3. Configures PA4 and PE7-PE9 (CSN of axis 1-4) as general-purpose output pins
+ *    for software-controlled Chip Select.
+ * 4. Enables the clock for the SPI1 peripheral and for DMA2 (spi1_transfer_dma()).
  * 5. Configures SPI1 settings:
  *    - SPI Mode 3 (CPOL=1, CPHA=1)
  *    - Master mode
@@ -24,18 +40,18 @@
 void spi1_init(void);
 
 /**
- * @brief Selects the SPI slave device by pulling its CS pin low.
+ * @brief Selects an SPI slave device by pulling its CS pin low.
  *
- * For our project, this pulls PA4 low.
+ * @param cs Chip select 0 to SPI1_CS_COUNT - 1 (PA4, PE7, PE8, PE9).
  */
-void spi1_cs_select(void);
+void spi1_cs_select(uint8_t cs);
 
 /**
- * @brief Deselects the SPI slave device by pulling its CS pin high.
+ * @brief Deselects an SPI slave device by pulling its CS pin high.
  *
- * For our project, this pulls PA4 high.
+ * @param cs Chip select 0 to SPI1_CS_COUNT - 1.
  */
-void spi1_cs_deselect(void);
+void spi1_cs_deselect(uint8_t cs);
 
 /**
  * @brief Transmits and receives one byte of data via SPI1.
@@ -45,5 +61,32 @@ void spi1_cs_deselect(void);
  */
 uint8_t spi1_transfer(uint8_t data);
 
+/**
+ * @brief Exchanges 'n' bytes with the device on 'cs' in one chip select cycle.
+ *
+ * DMA2 stream 3 (TX) and stream 0 (RX), channel 3, move the bytes back to
+ * back, so the frame has no gaps between bytes. Blocks until the last byte
+ * is received and the chip select is released. 'tx' and 'rx' must not be in
+ * the CCM RAM, which the DMA cannot reach.
+ *
+ * @param cs Chip select 0 to SPI1_CS_COUNT - 1.
+ * @param tx Bytes to send.
+ * @param rx Receives the bytes shifted in.
+ * @param n  Number of bytes, 1 to 65535.
+ */
+void spi1_transfer_dma(uint8_t cs, const uint8_t *tx, uint8_t *rx, size_t n);
+
+/**
+ * @brief Keeps the interrupts that access SPI1 out until spi1_unlock(), so
+ *        a multi-datagram access is not interleaved with theirs. Nests.
+ *
+ * @return The previous mask (BASEPRI), to hand to spi1_unlock().
+ */
+uint32_t spi1_lock(void);
+
+/**
+ * @brief Restores the mask spi1_lock() returned.
+ */
+void spi1_unlock(uint32_t key);
 
 #endif /* PERIPHERAL_INC_SPI_H_ */
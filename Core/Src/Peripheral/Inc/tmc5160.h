@@ -3,6 +3,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+// Internal clock (fCLK). Velocities are in fCLK / 2^24 usteps/s,
+// accelerations in fCLK^2 / 2^41 usteps/s^2.
+#define TMC5160_FCLK            12000000
 
 // TMC5160 Register Addresses
 #define TMC5160_GCONF           0x00 // Global Configuration
@@ -11,11 +16,17 @@
 #define TMC5160_IHOLD_IRUN      0x10 // Driver Current Control
 #define TMC5160_TPOWERDOWN      0x11 // Standstill Delay
 #define TMC5160_TPWMTHRS        0x13 // StealthChop voltage PWM mode
+#define TMC5160_TCOOLTHRS       0x14 // StallGuard2 / CoolStep active below this TSTEP (above this speed)
 #define TMC5160_CHOPCONF        0x6C // Chopper Configuration
+#define TMC5160_COOLCONF        0x6D // CoolStep and StallGuard2 configuration (write only)
+#define TMC5160_DRV_STATUS      0x6F // StallGuard2 value and driver error flags
 
 // Ramp Generator Registers
 #define TMC5160_RAMPMODE        0x20 // Ramp Mode configuration
 #define TMC5160_XACTUAL			0x21
+#define TMC5160_VACTUAL         0x22 // Actual velocity (24-bit signed, read only)
+#define TMC5160_VSTART          0x23 // Motor start velocity
+#define TMC5160_A1              0x24 // First acceleration between VSTART and V1
 #define TMC5160_V1              0x25 // First acceleration phase threshold speed
 #define TMC5160_AMAX            0x26 // Acceleration
 #define TMC5160_VMAX            0x27 // Maximum velocity
@@ -24,7 +35,107 @@
 #define TMC5160_VSTOP			0x2B // Motor Stop Velocity
 #define TMC5160_TZEROWAIT		0x2C
 #define TMC5160_XTARGET         0x2D // Target Position
+#define TMC5160_SW_MODE         0x34 // Reference switch and StallGuard2 stop configuration
 #define TMC5160_RAMP_STAT		0x35
+#define TMC5160_XLATCH          0x36 // XACTUAL latched on a reference switch event
+
+// Encoder Registers
+#define TMC5160_ENCMODE         0x38 // Encoder configuration
+#define TMC5160_X_ENC           0x39 // Encoder position in usteps (counts scaled by ENC_CONST)
+#define TMC5160_ENC_CONST       0x3A // Usteps per encoder count, 16.16 (write only)
+
+// RAMPMODE values
+#define TMC5160_RAMPMODE_POSITION       0 // Move to XTARGET
+#define TMC5160_RAMPMODE_VELOCITY_POS   1 // Run at VMAX in positive direction
+#define TMC5160_RAMPMODE_VELOCITY_NEG   2 // Run at VMAX in negative direction
+#define TMC5160_RAMPMODE_HOLD           3 // Keep the current velocity
+
+// SW_MODE bits
+#define TMC5160_SW_MODE_STOP_L_ENABLE   (1u << 0)  // REFL stops motion in negative direction
+#define TMC5160_SW_MODE_STOP_R_ENABLE   (1u << 1)  // REFR stops motion in positive direction
+#define TMC5160_SW_MODE_POL_STOP_L      (1u << 2)  // REFL active low
+#define TMC5160_SW_MODE_POL_STOP_R      (1u << 3)  // REFR active low
+#define TMC5160_SW_MODE_LATCH_L_ACTIVE  (1u << 5)  // Latch XACTUAL when REFL becomes active
+#define TMC5160_SW_MODE_LATCH_L_INACTIVE (1u << 6) // Latch XACTUAL when REFL becomes inactive
+#define TMC5160_SW_MODE_LATCH_R_ACTIVE  (1u << 7)
+#define TMC5160_SW_MODE_LATCH_R_INACTIVE (1u << 8)
+#define TMC5160_SW_MODE_SG_STOP         (1u << 10) // Stop on a StallGuard2 stall (above TCOOLTHRS speed)
+#define TMC5160_SW_MODE_EN_SOFTSTOP     (1u << 11) // Stop switches decelerate instead of stopping hard
+
+// RAMP_STAT bits (status_latch_*, event_stop_sg, event_pos_reached: write 1 to clear)
+#define TMC5160_RAMP_STAT_STATUS_STOP_L     (1u << 0)
+#define TMC5160_RAMP_STAT_STATUS_STOP_R     (1u << 1)
+#define TMC5160_RAMP_STAT_STATUS_LATCH_L    (1u << 2)
+#define TMC5160_RAMP_STAT_STATUS_LATCH_R    (1u << 3)
+#define TMC5160_RAMP_STAT_EVENT_STOP_SG     (1u << 6)
+#define TMC5160_RAMP_STAT_VELOCITY_REACHED  (1u << 8)
+#define TMC5160_RAMP_STAT_POSITION_REACHED  (1u << 9)
+#define TMC5160_RAMP_STAT_VZERO             (1u << 10)
+
+// ENCMODE bits
+#define TMC5160_ENCMODE_DECIMAL         (1u << 10) // ENC_CONST fraction in 1/10000 instead of 1/65536
+
+// GCONF bits
+#define TMC5160_GCONF_EN_PWM_MODE       (1u << 2) // StealthChop; StallGuard2 needs SpreadCycle
+
+// COOLCONF SGT [22:16]: signed StallGuard2 threshold, higher = less sensitive
+#define TMC5160_COOLCONF_SGT(sgt)       (((uint32_t)(sgt) & 0x7Fu) << 16)
+
+// DRV_STATUS SG_RESULT [9:0]: StallGuard2 load value, 0 = highest load
+#define TMC5160_DRV_STATUS_SG_RESULT(value) ((uint32_t)(value) & 0x3FFu)
+
+// DRV_STATUS flags. ot and the shorts latch until GSTAT drv_err is cleared.
+#define TMC5160_DRV_STATUS_S2VSA        (1u << 12) // Short to supply, phase A
+#define TMC5160_DRV_STATUS_S2VSB        (1u << 13)
+#define TMC5160_DRV_STATUS_OT           (1u << 25) // Overtemperature: power stage shut down
+#define TMC5160_DRV_STATUS_OTPW         (1u << 26) // Overtemperature pre-warning
+#define TMC5160_DRV_STATUS_S2GA         (1u << 27) // Short to ground, phase A
+#define TMC5160_DRV_STATUS_S2GB         (1u << 28)
+#define TMC5160_DRV_STATUS_OLA          (1u << 29) // Open load, phase A (only valid while moving)
+#define TMC5160_DRV_STATUS_OLB          (1u << 30)
+#define TMC5160_DRV_STATUS_STST         (1u << 31) // Standstill
+
+// GSTAT flags (write 1 to clear)
+#define TMC5160_GSTAT_RESET     (1u << 0) // The IC has been reset
+#define TMC5160_GSTAT_DRV_ERR   (1u << 1) // Power stage shut down: overtemperature or short
+#define TMC5160_GSTAT_UV_CP     (1u << 2) // Charge pump undervoltage
+
+// SPI_STATUS: the first byte of every reply datagram
+#define TMC5160_SPI_STATUS_RESET            (1u << 0) // GSTAT reset
+#define TMC5160_SPI_STATUS_DRIVER_ERROR     (1u << 1) // GSTAT drv_err
+#define TMC5160_SPI_STATUS_STANDSTILL       (1u << 3)
+#define TMC5160_SPI_STATUS_VELOCITY_REACHED (1u << 4)
+#define TMC5160_SPI_STATUS_POSITION_REACHED (1u << 5)
+
+// CHOPCONF TOFF [3:0]: 0 disables the power stage
+#define TMC5160_CHOPCONF_TOFF_MASK 0x0000000F
+
+// IOIN VERSION [31:24]: 0x30 for the TMC5160
+#define TMC5160_IOIN_VERSION(value)     ((uint32_t)(value) >> 24)
+#define TMC5160_VERSION                 0x30
+
+/**
+ * @brief Chopper and current settings written by tmc5160_init().
+ *        Mirrors object 0x2000, so the values can be stored via 0x1010.
+ */
+struct tmc5160_driver_config {
+    uint32_t gconf;      // GCONF, default 0x00000004: en_pwm_mode (StealthChop)
+    uint32_t chopconf;   // CHOPCONF, default 0x000100C3: TOFF=3, HSTRT=4, HEND=1, TBL=2, CHM=0 (SpreadCycle)
+    uint32_t ihold_irun; // IHOLD_IRUN, default 0x00061F0A: IHOLD=10, IRUN=31, IHOLDDELAY=6
+    uint32_t tpowerdown; // TPOWERDOWN, default 10
+    uint32_t tpwmthrs;   // TPWMTHRS, default 500: StealthChop below this speed
+};
+
+/**
+ * @brief One TMC5160 on SPI1, addressed by its chip select.
+ */
+struct tmc5160 {
+    uint8_t cs;                          // SPI1 chip select, see spi1_cs_select(); position in a daisy chain
+    struct tmc5160_driver_config config; // Settings of tmc5160_init() / tmc5160_configure()
+    bool driver_enabled;
+    uint32_t writes;                     // Register writes so far: tells whether values read earlier are still current
+    uint8_t status;                      // SPI_STATUS of the last datagram, read or write
+};
 
 /**
  * @brief Writes a 32-bit value to a TMC5160 register.
@@ -32,10 +143,11 @@
  * This function handles the 40-bit SPI datagram protocol for a write operation.
  * The address's MSB is automatically set to 1 to indicate a write access.
  *
+ * @param drv The TMC5160 to write to.
  * @param address The 7-bit register address (0x00 to 0x7F).
  * @param value The 32-bit data to write to the register.
  */
-void tmc5160_write_register(uint8_t address, int32_t value);
+void tmc5160_write_register(struct tmc5160 *drv, uint8_t address, int32_t value);
 
 /**
  * @brief Reads a 32-bit value from a TMC5160 register.
@@ -44,26 +156,103 @@ void tmc5160_write_register(uint8_t address, int32_t value);
  * It performs two SPI transactions: one to request the data, and a second
  * to clock it out.
  *
+ * @param drv The TMC5160 to read from.
  * @param address The 7-bit register address (0x00 to 0x7F).
  * @return int32_t The 32-bit value read from the register.
  */
-int32_t tmc5160_read_register(uint8_t address);
+int32_t tmc5160_read_register(struct tmc5160 *drv, uint8_t address);
 
 /**
- * @brief Initializes the TMC5160 with a basic, proven configuration.
+ * @brief Reads several TMC5160 registers in one pipelined burst.
+ *
+ * Every SPI datagram returns the data requested by the previous one, so
+ * reading 'count' registers takes count + 1 datagrams instead of the
+ * 2 * count needed by repeated tmc5160_read_register() calls.
+ *
+ * @param drv       The TMC5160 to read from.
+ * @param addresses Array of 7-bit register addresses to read.
+ * @param values    Array receiving the 32-bit register values, in the same order.
+ * @param count     Number of registers to read.
+ */
+void tmc5160_read_registers(struct tmc5160 *drv, const uint8_t *addresses, int32_t *values, size_t count);
+
+/**
+ * @brief Reads the same registers from several TMC5160s in one burst.
+ *
+ * The datagrams of the chips are interleaved: while one chip prepares the
+ * data of its request, the others are served, so the pause between two
+ * datagrams to the same chip costs no extra time. 'n' chips take
+ * n * (count + 1) datagrams and a single pause per round; daisy-chained
+ * chips take count + 1 frames.
+ *
+ * @param drvs      The TMC5160s to read from.
+ * @param n         Number of TMC5160s.
+ * @param addresses Array of 7-bit register addresses to read from each chip.
+ * @param values    Array of n * count values: those of drvs[i] start at i * count.
+ * @param count     Number of registers to read per chip.
+ */
+void tmc5160_read_registers_batch(struct tmc5160 *const *drvs, size_t n,
+                                  const uint8_t *addresses, int32_t *values, size_t count);
+
+/**
+ * @brief Writes one register of several TMC5160s, e.g. the set-points of
+ *        coordinated axes.
+ *
+ * Daisy-chained TMC5160s (SPI1_DAISY_CHAIN_LENGTH) get all values in one
+ * DMA frame and take them over together at the rising edge of its chip
+ * select. On separate chip selects the datagrams follow back to back.
+ *
+ * @param drvs    The TMC5160s to write to.
+ * @param n       Number of TMC5160s.
+ * @param address The 7-bit register address.
+ * @param values  The value for each of drvs.
+ */
+void tmc5160_write_registers_batch(struct tmc5160 *const *drvs, size_t n, uint8_t address, const int32_t *values);
+
+/**
+ * @brief Whether a TMC5160 answers on the chip select: IOIN reports
+ *        version 0x30. An unfitted chip select reads all zeros or ones.
+ */
+bool tmc5160_is_present(struct tmc5160 *drv);
+
+/**
+ * @brief Initializes the TMC5160 with the given chopper and current settings.
  *
  * This function configures the essential registers for motor operation, including
- * chopper settings (CHOPCONF), driver current (IHOLD_IRUN), and enables
- * StealthChop mode for quiet operation at low speeds.
- * It is based on the "Initialization Examples" from the TMC5160 datasheet.
+ * chopper settings (CHOPCONF), driver current (IHOLD_IRUN), and StealthChop
+ * (GCONF, TPWMTHRS). The defaults in slave.dcf (object 0x2000) are based on the
+ * "Initialization Examples" from the TMC5160 datasheet.
+ *
+ * @param drv    The TMC5160; drv->cs selects it.
+ * @param config Settings to apply; copied, so it may be a temporary.
+ */
+void tmc5160_init(struct tmc5160 *drv, const struct tmc5160_driver_config *config);
+
+/**
+ * @brief Applies new chopper and current settings at runtime.
+ *
+ * Same as tmc5160_init(), except that a disabled driver stays disabled
+ * (TOFF is only taken over when the driver is enabled).
+ *
+ * @param drv    The TMC5160.
+ * @param config Settings to apply; copied.
+ */
+void tmc5160_configure(struct tmc5160 *drv, const struct tmc5160_driver_config *config);
+
+/**
+ * @brief Writes the settings of drv->config, as tmc5160_configure() does
+ *        after taking them over: a disabled driver stays disabled.
+ * @param drv The TMC5160.
  */
-void tmc5160_init(void);
+void tmc5160_write_driver_config(struct tmc5160 *drv);
 
 /**
  * @brief Enables or disables the TMC5160 motor driver outputs.
+ *        Enabling restores the TOFF of the configured CHOPCONF.
+ * @param drv The TMC5160.
  * @param enable Set to true to enable the driver, false to disable.
  */
-void tmc5160_set_driver_enabled(bool enable);
+void tmc5160_set_driver_enabled(struct tmc5160 *drv, bool enable);
 
 
 #endif /* PERIPHERAL_INC_TMC5160_H_ */
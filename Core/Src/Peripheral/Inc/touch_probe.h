@@ -0,0 +1,79 @@
+#ifndef PERIPHERAL_INC_TOUCH_PROBE_H_
+#define PERIPHERAL_INC_TOUCH_PROBE_H_
+
+#include "tmc5160.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Touch probe 1 is the REFL input, touch probe 2 the REFR input
+#define TOUCH_PROBE_COUNT               2
+
+// Touch probe function (0x60B8), bits of probe 1; probe 2 uses the same bits << 8
+#define TOUCH_PROBE_FN_ENABLE           (1u << 0)
+#define TOUCH_PROBE_FN_CONTINUOUS       (1u << 1) // 0 = first edge only
+#define TOUCH_PROBE_FN_POSITIVE_EDGE    (1u << 4) // Input becomes active
+#define TOUCH_PROBE_FN_NEGATIVE_EDGE    (1u << 5) // Input becomes inactive
+
+// Touch probe status (0x60B9), bits of probe 1; probe 2 uses the same bits << 8
+#define TOUCH_PROBE_ST_ENABLED          (1u << 0)
+#define TOUCH_PROBE_ST_POSITIVE_STORED  (1u << 1)
+#define TOUCH_PROBE_ST_NEGATIVE_STORED  (1u << 2)
+#define TOUCH_PROBE_ST_POSITIVE_TOGGLE  (1u << 6) // Continuous mode: toggles with every new value
+#define TOUCH_PROBE_ST_NEGATIVE_TOGGLE  (1u << 7)
+
+/**
+ * @brief Touch probes of one axis. Set up with touch_probe_init().
+ */
+struct touch_probe {
+    struct tmc5160 *drv;
+    uint16_t function;                  // 0x60B8
+    uint16_t st;                        // 0x60B9
+    uint32_t polarity;
+    uint32_t sw_mode;                   // Last value written to SW_MODE
+    uint32_t armed[TOUCH_PROBE_COUNT];  // TOUCH_PROBE_FN_*_EDGE latched by the chip
+    int32_t values[TOUCH_PROBE_COUNT][2];
+};
+
+/**
+ * @brief Binds the touch probes to the TMC5160 of their axis, all disabled.
+ */
+void touch_probe_init(struct touch_probe *tp, struct tmc5160 *drv);
+
+/**
+ * @brief Applies a new touch probe function (0x60B8) and arms the XLATCH
+ *        of the TMC5160 on the reference inputs.
+ *
+ * Enabling a probe, or one of its edges, clears the value stored for it.
+ * SW_MODE is always written, so this also re-arms the latches after
+ * another user of SW_MODE (homing).
+ *
+ * @param function 0x60B8.
+ * @param polarity SW_MODE pol_stop_l / pol_stop_r bits of the inputs.
+ */
+void touch_probe_configure(struct touch_probe *tp, uint16_t function, uint32_t polarity);
+
+/**
+ * @brief Takes a latched position from XLATCH. Call it from the main loop.
+ * @return true if the status or a stored value has changed.
+ */
+bool touch_probe_poll(struct touch_probe *tp);
+
+/**
+ * @brief Whether any probe is enabled (touch_probe_poll() has work).
+ */
+bool touch_probe_is_enabled(const struct touch_probe *tp);
+
+/**
+ * @brief Touch probe status (0x60B9).
+ */
+uint16_t touch_probe_status(const struct touch_probe *tp);
+
+/**
+ * @brief Position stored for an edge: 0x60BA + 2 * probe + negative.
+ * @param probe    0 (REFL) or 1 (REFR).
+ * @param negative Negative instead of positive edge.
+ */
+int32_t touch_probe_value(const struct touch_probe *tp, unsigned int probe, bool negative);
+
+#endif /* PERIPHERAL_INC_TOUCH_PROBE_H_ */
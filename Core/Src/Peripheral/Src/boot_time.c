@@ -0,0 +1,54 @@
+#include "boot_time.h"
+#include "stm32f4xx.h"
+
+#include <lely/co/obj.h>
+
+// The clock phase runs on the 16 MHz HSI until the switch to the PLL,
+// every later phase at 168 MHz.
+#define BOOT_TIME_HSI_MHZ       16
+#define BOOT_TIME_CPU_MHZ       168
+
+static uint32_t boot_time_us[BOOT_PHASE_COUNT];
+static co_dev_t *boot_time_dev = NULL;
+
+static void boot_time_publish(boot_phase_t phase) {
+    if (boot_time_dev) {
+        co_dev_set_val_u32(boot_time_dev, BOOT_TIME_OBJ, (co_unsigned8_t)(phase + 1), boot_time_us[phase]);
+    }
+}
+
+uint32_t boot_time_start(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    return 0;
+}
+
+uint32_t boot_time_cycles(void) {
+    return DWT->CYCCNT;
+}
+
+uint32_t boot_time_cycles_to_us(uint32_t cycles) {
+    return cycles / BOOT_TIME_CPU_MHZ;
+}
+
+uint32_t boot_time_record(boot_phase_t phase, uint32_t start) {
+    uint32_t now = DWT->CYCCNT;
+    uint32_t mhz = (phase == BOOT_PHASE_CLOCK) ? BOOT_TIME_HSI_MHZ : BOOT_TIME_CPU_MHZ;
+
+    boot_time_us[phase] = (now - start) / mhz;
+
+    if (phase < BOOT_PHASE_BOOTUP) {
+        boot_time_us[BOOT_PHASE_BOOTUP] += boot_time_us[phase];
+    }
+    boot_time_publish(phase);
+    return now;
+}
+
+void boot_time_init(co_dev_t *dev) {
+    boot_time_dev = dev;
+
+    for (int phase = 0; phase < BOOT_PHASE_COUNT; phase++) {
+        boot_time_publish((boot_phase_t)phase);
+    }
+}
@@ -2,15 +2,31 @@
 #include "stm32f4xx.h"
 #include "rcc.h"
 #include "gpio.h"
+#include "boot_time.h"
 #include <string.h>
 #include <stdbool.h>
 
 // --- Ring Buffer for CAN message reception (logic copied from PoC) ---
-#define CAN_RX_BUFFER_SIZE 32
+// Sized for an SDO block segment burst arriving while the loop is busy with SPI
+#define CAN_RX_BUFFER_SIZE 64
 static struct can_msg rx_buffer[CAN_RX_BUFFER_SIZE];
 static volatile uint32_t rx_head = 0;
 static volatile uint32_t rx_tail = 0;
 
+// Reception time of the SYNC message, for the SYNC to actuation latency
+static volatile uint32_t sync_id = 0x80;
+static volatile uint32_t sync_cycles = 0;
+
+// Receptions of the watched identifiers (heartbeats of the consumed nodes)
+struct can_watch {
+    volatile uint32_t id;
+    volatile uint32_t count;
+    volatile uint32_t cycles;
+};
+static struct can_watch watches[CAN_WATCH_COUNT] = {
+    { .id = CAN_WATCH_NONE }, { .id = CAN_WATCH_NONE }, { .id = CAN_WATCH_NONE }, { .id = CAN_WATCH_NONE },
+};
+
 void can_init(bool loopback_mode) {
     // 1. Enable Clocks
     rcc_gpio_port_clock_enable(GPIOB);
@@ -116,14 +132,47 @@ size_t can_recv(struct can_msg *msgs, size_t n) {
     return count;
 }
 
+void can_set_sync_id(uint32_t id) {
+    sync_id = id;
+}
+
+uint32_t can_sync_cycles(void) {
+    return sync_cycles;
+}
+
+void can_watch(unsigned int slot, uint32_t id) {
+    watches[slot].id = id;
+}
+
+uint32_t can_watch_count(unsigned int slot, uint32_t *cycles) {
+    uint32_t count;
+
+    // The receive interrupt may update both in between: read until stable
+    do {
+        count = watches[slot].count;
+        *cycles = watches[slot].cycles;
+    } while (count != watches[slot].count);
+    return count;
+}
+
 // CAN1 RX0 Interrupt Handler
 void CAN1_RX0_IRQHandler(void) {
     // Check if the interrupt is for a message pending in FIFO0
     if ((CAN1->RF0R & CAN_RF0R_FMP0) != 0) {
+        uint32_t id = CAN1->sFIFOMailBox[0].RIR >> 21;
+
+        // Counted even when the ring buffer is full: the sender is alive
+        for (unsigned int slot = 0; slot < CAN_WATCH_COUNT; slot++) {
+            if (id == watches[slot].id) {
+                watches[slot].cycles = boot_time_cycles();
+                watches[slot].count++;
+            }
+        }
+
         uint32_t next_head = (rx_head + 1) % CAN_RX_BUFFER_SIZE;
         if (next_head != rx_tail) {
             // Read ID, DLC
-            rx_buffer[rx_head].id = (CAN1->sFIFOMailBox[0].RIR >> 21);
+            rx_buffer[rx_head].id = id;
             rx_buffer[rx_head].len = (CAN1->sFIFOMailBox[0].RDTR & 0x0F);
 
             // Read data
@@ -138,6 +187,10 @@ void CAN1_RX0_IRQHandler(void) {
 
             rx_buffer[rx_head].flags = 0;
 
+            if (rx_buffer[rx_head].id == sync_id) {
+                sync_cycles = boot_time_cycles();
+            }
+
             rx_head = next_head;
         }
 
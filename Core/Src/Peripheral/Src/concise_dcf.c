@@ -0,0 +1,151 @@
+#include "concise_dcf.h"
+#include "nvparam.h"
+
+#include <lely/co/obj.h>
+#include <lely/co/sdo.h>
+#include <lely/co/val.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CONCISE_DCF_MAX_SIZE    3072
+#define CONCISE_DCF_MAX_ENTRIES 320
+
+// Fixed part of an entry: index (u16), sub-index (u8), data size (u32)
+#define CONCISE_DCF_ENTRY_HEADER 7
+
+struct concise_dcf_entry {
+    co_sub_t *sub;
+    union co_val value; // Value from the blob
+    union co_val prev;  // Value before it was applied, used to revert
+};
+
+static co_dev_t *concise_dcf_dev = NULL;
+
+static uint8_t concise_dcf_buf[CONCISE_DCF_MAX_SIZE];
+static struct concise_dcf_entry concise_dcf_entries[CONCISE_DCF_MAX_ENTRIES];
+
+static co_unsigned32_t on_write_blob(co_sub_t *sub, struct co_sdo_req *req, void *data);
+
+void concise_dcf_init(co_dev_t *dev) {
+    concise_dcf_dev = dev;
+
+    co_sub_set_dn_ind(co_dev_find_sub(dev, CONCISE_DCF_OBJ, 0x00), &on_write_blob, NULL);
+}
+
+/**
+ * @brief Checks the buffered blob and decodes it into concise_dcf_entries.
+ *        Nothing in the Object Dictionary is changed here.
+ * @return 0 on success, otherwise the SDO abort code.
+ */
+static co_unsigned32_t concise_dcf_parse(size_t size, size_t *pcount) {
+    const uint8_t *begin = concise_dcf_buf;
+    const uint8_t *end = concise_dcf_buf + size;
+    co_unsigned32_t count;
+
+    if (co_val_read(CO_DEFTYPE_UNSIGNED32, &count, begin, end) != 4) {
+        return CO_SDO_AC_TYPE_LEN_LO;
+    }
+    begin += 4;
+    if (count > CONCISE_DCF_MAX_ENTRIES) {
+        return CO_SDO_AC_NO_MEM;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        struct concise_dcf_entry *entry = &concise_dcf_entries[i];
+        co_unsigned16_t idx;
+        co_unsigned8_t subidx;
+        co_unsigned32_t n;
+
+        if (end - begin < CONCISE_DCF_ENTRY_HEADER) {
+            return CO_SDO_AC_TYPE_LEN_LO;
+        }
+        co_val_read(CO_DEFTYPE_UNSIGNED16, &idx, begin, end);
+        co_val_read(CO_DEFTYPE_UNSIGNED8, &subidx, begin + 2, end);
+        co_val_read(CO_DEFTYPE_UNSIGNED32, &n, begin + 3, end);
+        begin += CONCISE_DCF_ENTRY_HEADER;
+        if (n > (size_t)(end - begin)) {
+            return CO_SDO_AC_TYPE_LEN_LO;
+        }
+
+        entry->sub = co_dev_find_sub(concise_dcf_dev, idx, subidx);
+        if (!entry->sub) {
+            return co_dev_find_obj(concise_dcf_dev, idx) ? CO_SDO_AC_NO_SUB : CO_SDO_AC_NO_OBJ;
+        }
+        // Only parameters: process data and commands would act at once and
+        // cannot be reverted.
+        if (!(co_sub_get_access(entry->sub) & CO_ACCESS_WRITE) || !nvparam_is_stored(idx, subidx)) {
+            return CO_SDO_AC_NO_WRITE;
+        }
+
+        // Domains (including this object) cannot be reverted and are not accepted.
+        co_unsigned16_t type = co_sub_get_type(entry->sub);
+        if (!co_type_is_basic(type)) {
+            return CO_SDO_AC_NO_ACCESS;
+        }
+        if (n != co_type_sizeof(type)) {
+            return n > co_type_sizeof(type) ? CO_SDO_AC_TYPE_LEN_HI : CO_SDO_AC_TYPE_LEN_LO;
+        }
+
+        co_val_read(type, &entry->value, begin, begin + n);
+        begin += n;
+    }
+
+    if (begin != end) {
+        return CO_SDO_AC_TYPE_LEN_HI;
+    }
+
+    *pcount = count;
+    return 0;
+}
+
+/**
+ * @brief Applies the decoded entries in order. On the first refused entry the
+ *        previous ones are written back in reverse order, which also undoes
+ *        sequences such as "disable PDO, change mapping, enable PDO".
+ */
+static co_unsigned32_t concise_dcf_apply(size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        struct concise_dcf_entry *entry = &concise_dcf_entries[i];
+        co_unsigned16_t type = co_sub_get_type(entry->sub);
+
+        // Taken just before the write, an earlier entry may have changed it.
+        memcpy(&entry->prev, co_sub_get_val(entry->sub), co_type_sizeof(type));
+
+        co_unsigned32_t ac = co_sub_dn_ind_val(entry->sub, type, &entry->value);
+        if (ac) {
+            while (i--) {
+                entry = &concise_dcf_entries[i];
+                co_sub_dn_ind_val(entry->sub, co_sub_get_type(entry->sub), &entry->prev);
+            }
+            return ac;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief SDO download to 0x2104. The chunks are collected in a RAM buffer;
+ *        the blob is checked and applied when the last one has arrived.
+ */
+static co_unsigned32_t on_write_blob(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    (void)data;
+
+    if (req->size > CONCISE_DCF_MAX_SIZE || req->offset + req->nbyt > CONCISE_DCF_MAX_SIZE) {
+        return CO_SDO_AC_NO_MEM;
+    }
+    memcpy(concise_dcf_buf + req->offset, req->buf, req->nbyt);
+
+    if (!co_sdo_req_last(req)) {
+        return 0;
+    }
+
+    size_t count = 0;
+    co_unsigned32_t ac = concise_dcf_parse(req->offset + req->nbyt, &count);
+    if (ac) {
+        return ac;
+    }
+
+    return concise_dcf_apply(count);
+}
@@ -0,0 +1,58 @@
+#include "drive_fault.h"
+#include "tmc5160.h"
+
+// Error register (0x1001) bits
+#define ER_GENERIC          0x01
+#define ER_CURRENT          0x02
+#define ER_VOLTAGE          0x04
+#define ER_TEMPERATURE      0x08
+#define ER_DEVICE_PROFILE   0x20
+
+static const struct drive_error_code drive_error_codes[DRIVE_ERROR_COUNT] = {
+    [DRIVE_ERROR_OVERTEMPERATURE]     = { 0x4310, ER_GENERIC | ER_TEMPERATURE },    // Excess temperature drive
+    [DRIVE_ERROR_SHORT_TO_GROUND]     = { 0x2330, ER_GENERIC | ER_CURRENT },        // Earth leakage
+    [DRIVE_ERROR_SHORT_TO_SUPPLY]     = { 0x2340, ER_GENERIC | ER_CURRENT },        // Short circuit
+    [DRIVE_ERROR_POWER_STAGE]         = { 0x5400, ER_GENERIC },                     // Power section
+    [DRIVE_ERROR_UNDERVOLTAGE]        = { 0x3120, ER_GENERIC | ER_VOLTAGE },        // Undervoltage
+    [DRIVE_ERROR_FOLLOWING_ERROR]     = { 0x8611, ER_GENERIC | ER_DEVICE_PROFILE }, // Following error
+    [DRIVE_ERROR_TEMPERATURE_WARNING] = { 0x4300, ER_GENERIC | ER_TEMPERATURE },    // Drive temperature
+    [DRIVE_ERROR_OPEN_LOAD]           = { 0x7120, ER_GENERIC | ER_CURRENT },        // Motor
+};
+
+#define DRV_STATUS_SHORT_TO_GROUND  (TMC5160_DRV_STATUS_S2GA | TMC5160_DRV_STATUS_S2GB)
+#define DRV_STATUS_SHORT_TO_SUPPLY  (TMC5160_DRV_STATUS_S2VSA | TMC5160_DRV_STATUS_S2VSB)
+#define DRV_STATUS_OPEN_LOAD        (TMC5160_DRV_STATUS_OLA | TMC5160_DRV_STATUS_OLB)
+
+const struct drive_error_code *drive_error_code(enum drive_error error) {
+    return &drive_error_codes[error];
+}
+
+uint32_t drive_error_decode(uint32_t gstat, uint32_t drv_status) {
+    uint32_t errors = 0;
+
+    if (gstat & TMC5160_GSTAT_DRV_ERR) {
+        if (drv_status & TMC5160_DRV_STATUS_OT) {
+            errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_OVERTEMPERATURE);
+        }
+        if (drv_status & DRV_STATUS_SHORT_TO_GROUND) {
+            errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_SHORT_TO_GROUND);
+        }
+        if (drv_status & DRV_STATUS_SHORT_TO_SUPPLY) {
+            errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_SHORT_TO_SUPPLY);
+        }
+        if (errors == 0) {
+            errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_POWER_STAGE);
+        }
+    }
+    if (gstat & TMC5160_GSTAT_UV_CP) {
+        errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_UNDERVOLTAGE);
+    }
+
+    if ((drv_status & TMC5160_DRV_STATUS_OTPW) && !(errors & DRIVE_ERROR_BIT(DRIVE_ERROR_OVERTEMPERATURE))) {
+        errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_TEMPERATURE_WARNING);
+    }
+    if ((drv_status & DRV_STATUS_OPEN_LOAD) && !(drv_status & TMC5160_DRV_STATUS_STST)) {
+        errors |= DRIVE_ERROR_BIT(DRIVE_ERROR_OPEN_LOAD);
+    }
+    return errors;
+}
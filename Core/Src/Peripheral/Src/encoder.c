@@ -0,0 +1,64 @@
+#include "encoder.h"
+#include "tmc5160.h"
+
+#define ENC_CONST_INTEGER_MAX   32767
+#define ENC_CONST_DECIMAL       10000
+
+bool encoder_compute(struct encoder_regs *regs, const struct encoder_config *config) {
+    uint32_t counts = config->resolution;
+
+    if (counts == 0 || config->motor_resolution / counts > ENC_CONST_INTEGER_MAX) {
+        return false;
+    }
+
+    uint32_t integer = config->motor_resolution / counts;
+    uint64_t remainder = config->motor_resolution % counts;
+    uint32_t fraction;
+    uint32_t scale;
+
+    if (((remainder << 16) % counts) == 0 || ((remainder * ENC_CONST_DECIMAL) % counts) != 0) {
+        scale = 1u << 16;
+        regs->encmode = 0;
+    } else {
+        scale = ENC_CONST_DECIMAL;
+        regs->encmode = TMC5160_ENCMODE_DECIMAL;
+    }
+    fraction = (uint32_t)((remainder * scale + counts / 2) / counts);
+    if (fraction == scale) {
+        integer++;
+        fraction = 0;
+        if (integer > ENC_CONST_INTEGER_MAX) {
+            return false;
+        }
+    }
+
+    // Negative factors: the integer part is rounded down, the fraction
+    // counts up from it (two's complement in binary)
+    if (config->inverted) {
+        if (fraction) {
+            integer++;
+            fraction = scale - fraction;
+        }
+        integer = (uint32_t)-(int32_t)integer;
+    }
+    regs->enc_const = (int32_t)((integer << 16) | fraction);
+    return true;
+}
+
+void following_error_reset(struct following_error *fe) {
+    fe->is_outside = false;
+}
+
+bool following_error_update(struct following_error *fe, int32_t error, uint32_t now) {
+    uint32_t magnitude = (error < 0) ? (uint32_t)0 - (uint32_t)error : (uint32_t)error;
+
+    if (fe->window == FOLLOWING_ERROR_WINDOW_OFF || magnitude <= fe->window) {
+        fe->is_outside = false;
+        return false;
+    }
+    if (!fe->is_outside) {
+        fe->is_outside = true;
+        fe->since = now;
+    }
+    return now - fe->since >= fe->timeout;
+}
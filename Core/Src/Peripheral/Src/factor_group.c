@@ -0,0 +1,205 @@
+#include "factor_group.h"
+#include "tmc5160.h"
+
+#include <stddef.h>
+
+// Terms of the products making up one fraction, unused ones 1
+#define FACTOR_TERMS    5
+
+static uint64_t gcd(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// a * b as 128 bits, from four 32 x 32 bit products
+static uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t *lo) {
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32;
+    uint64_t b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+    *lo = (mid << 32) | (uint32_t)p00;
+    return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+void factor_init(struct factor *f, uint64_t num, uint64_t den) {
+    uint64_t g = gcd(num, den);
+    if (g > 1) {
+        num /= g;
+        den /= g;
+    }
+
+    // Divisor normalized to its top bit, and its reciprocal
+    // floor((2^128 - 1) / d) - 2^64 = floor((~d * 2^64 + 2^64 - 1) / d),
+    // by long division as ~d < d
+    uint8_t shift = 0;
+    while (!(den << shift >> 63)) {
+        shift++;
+    }
+    uint64_t d = den << shift;
+    uint64_t r = ~d;
+    uint64_t q = 0;
+    for (int i = 0; i < 64; i++) {
+        bool carry = (r >> 63) != 0;
+        r = (r << 1) | 1;
+        q <<= 1;
+        if (carry || r >= d) {
+            r -= d;
+            q |= 1;
+        }
+    }
+
+    *f = (struct factor){
+        .num = num,
+        .den = den,
+        .reciprocal = q,
+        .shift = shift,
+    };
+}
+
+/**
+ * @brief x * num / den rounded, for x >= 0: the 96-bit product divided by
+ *        the normalized divisor with its reciprocal (Moeller-Granlund,
+ *        2-by-1 division), which takes a quotient estimate and at most two
+ *        corrections.
+ * @return false if the quotient does not fit 64 bits.
+ */
+static bool scale_magnitude(const struct factor *f, uint32_t x, uint64_t *y) {
+    uint64_t lo = (uint64_t)x * (uint32_t)f->num;
+    uint64_t mid = (uint64_t)x * (f->num >> 32) + (lo >> 32);
+    uint64_t u1 = mid >> 32;
+    uint64_t u0 = (mid << 32) | (uint32_t)lo;
+    if (u1 >= f->den) {
+        return false;
+    }
+
+    uint8_t s = f->shift;
+    uint64_t d = f->den << s;
+    if (s) {
+        u1 = (u1 << s) | (u0 >> (64 - s));
+        u0 <<= s;
+    }
+
+    uint64_t q0;
+    uint64_t q1 = mul_wide(f->reciprocal, u1, &q0);
+    q0 += u0;
+    q1 += u1 + 1 + (q0 < u0);
+    uint64_t r = u0 - q1 * d;
+    if (r > q0) {
+        q1--;
+        r += d;
+    }
+    if (r >= d) {
+        q1++;
+        r -= d;
+    }
+
+    // Halves away from zero
+    r >>= s;
+    if (r >= f->den - r) {
+        q1++;
+    }
+    *y = q1;
+    return true;
+}
+
+int32_t factor_scale(const struct factor *f, int32_t x) {
+    uint32_t magnitude = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint64_t y;
+
+    if (x < 0) {
+        if (!scale_magnitude(f, magnitude, &y) || y > (uint64_t)INT32_MAX + 1) {
+            return INT32_MIN;
+        }
+        return (int32_t)-(int64_t)y;
+    }
+    if (!scale_magnitude(f, magnitude, &y) || y > INT32_MAX) {
+        return INT32_MAX;
+    }
+    return (int32_t)y;
+}
+
+uint32_t factor_scale_u32(const struct factor *f, uint32_t x) {
+    uint64_t y;
+
+    if (!scale_magnitude(f, x, &y) || y > UINT32_MAX) {
+        return UINT32_MAX;
+    }
+    return (uint32_t)y;
+}
+
+/**
+ * @brief Sets 'f' to the product of 'num' over the product of 'den',
+ *        reduced term by term first so that only the reduced products
+ *        have to fit 64 bits.
+ */
+static bool factor_from_terms(struct factor *f, const uint64_t num[FACTOR_TERMS], const uint64_t den[FACTOR_TERMS]) {
+    uint64_t n[FACTOR_TERMS], d[FACTOR_TERMS];
+    uint64_t num_product = 1, den_product = 1;
+
+    for (size_t i = 0; i < FACTOR_TERMS; i++) {
+        n[i] = num[i];
+        d[i] = den[i];
+    }
+    for (size_t i = 0; i < FACTOR_TERMS; i++) {
+        for (size_t j = 0; j < FACTOR_TERMS; j++) {
+            uint64_t g = gcd(n[i], d[j]);
+            n[i] /= g;
+            d[j] /= g;
+        }
+    }
+    for (size_t i = 0; i < FACTOR_TERMS; i++) {
+        if (n[i] > UINT64_MAX / num_product || d[i] > UINT64_MAX / den_product) {
+            return false;
+        }
+        num_product *= n[i];
+        den_product *= d[i];
+    }
+
+    factor_init(f, num_product, den_product);
+    return true;
+}
+
+bool factor_group_compute(struct factor_group *group, const struct factor_group_config *config) {
+    struct factor_group next;
+
+    if (config->encoder_increments == 0 || config->motor_revolutions == 0 ||
+        config->gear_motor_revolutions == 0 || config->gear_shaft_revolutions == 0 ||
+        config->feed == 0 || config->feed_shaft_revolutions == 0) {
+        return false;
+    }
+
+    // usteps per user unit, and the TMC5160 time bases
+    const uint64_t user[FACTOR_TERMS] = {
+        config->encoder_increments, config->gear_motor_revolutions, config->feed_shaft_revolutions, 1, 1,
+    };
+    const uint64_t usteps[FACTOR_TERMS] = {
+        config->motor_revolutions, config->gear_shaft_revolutions, config->feed, 1, 1,
+    };
+    const uint64_t user_v[FACTOR_TERMS] = {
+        config->encoder_increments, config->gear_motor_revolutions, config->feed_shaft_revolutions,
+        (uint64_t)1 << 24, 1,
+    };
+    const uint64_t vmax[FACTOR_TERMS] = {
+        config->motor_revolutions, config->gear_shaft_revolutions, config->feed, TMC5160_FCLK, 1,
+    };
+    const uint64_t user_a[FACTOR_TERMS] = {
+        config->encoder_increments, config->gear_motor_revolutions, config->feed_shaft_revolutions,
+        (uint64_t)1 << 41, 1,
+    };
+    const uint64_t amax[FACTOR_TERMS] = {
+        config->motor_revolutions, config->gear_shaft_revolutions, config->feed, TMC5160_FCLK, TMC5160_FCLK,
+    };
+
+    if (!factor_from_terms(&next.position, user, usteps) || !factor_from_terms(&next.position_inv, usteps, user) ||
+        !factor_from_terms(&next.velocity, user_v, vmax) || !factor_from_terms(&next.velocity_inv, vmax, user_v) ||
+        !factor_from_terms(&next.acceleration, user_a, amax)) {
+        return false;
+    }
+    *group = next;
+    return true;
+}
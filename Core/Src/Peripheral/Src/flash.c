@@ -0,0 +1,68 @@
+#include "flash.h"
+#include "stm32f4xx.h"
+
+// Unlock sequence of FLASH_KEYR (RM0090, 3.5.1)
+#define FLASH_UNLOCK_KEY1       0x45670123U
+#define FLASH_UNLOCK_KEY2       0xCDEF89ABU
+
+#define FLASH_SR_ERRORS         (FLASH_SR_OPERR | FLASH_SR_WRPERR | FLASH_SR_PGAERR \
+                               | FLASH_SR_PGPERR | FLASH_SR_PGSERR)
+
+static void flash_unlock(void) {
+    if (FLASH->CR & FLASH_CR_LOCK) {
+        FLASH->KEYR = FLASH_UNLOCK_KEY1;
+        FLASH->KEYR = FLASH_UNLOCK_KEY2;
+    }
+    FLASH->SR = FLASH_SR_ERRORS; // Clear flags left over from earlier operations
+}
+
+static void flash_lock(void) {
+    FLASH->CR = FLASH_CR_LOCK;
+}
+
+static int flash_wait(void) {
+    while (FLASH->SR & FLASH_SR_BSY);
+
+    if (FLASH->SR & FLASH_SR_ERRORS) {
+        FLASH->SR = FLASH_SR_ERRORS;
+        return -1;
+    }
+    return 0;
+}
+
+int flash_erase_sector(uint32_t sector) {
+    flash_unlock();
+
+    FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_SER | ((sector << FLASH_CR_SNB_Pos) & FLASH_CR_SNB);
+    FLASH->CR |= FLASH_CR_STRT;
+    int result = flash_wait();
+
+    flash_lock();
+
+    // The data cache may still hold the old contents of the sector.
+    FLASH->ACR &= ~FLASH_ACR_DCEN;
+    FLASH->ACR |= FLASH_ACR_DCRST;
+    FLASH->ACR &= ~FLASH_ACR_DCRST;
+    FLASH->ACR |= FLASH_ACR_DCEN;
+
+    return result;
+}
+
+bool flash_is_busy(void) {
+    return (FLASH->SR & FLASH_SR_BSY) != 0;
+}
+
+int flash_program(uintptr_t address, const uint32_t *data, size_t words) {
+    int result = 0;
+
+    flash_unlock();
+    FLASH->CR = FLASH_CR_PSIZE_1 | FLASH_CR_PG;
+
+    for (size_t i = 0; i < words && result == 0; i++) {
+        *(volatile uint32_t *)(address + i * sizeof(uint32_t)) = data[i];
+        result = flash_wait();
+    }
+
+    flash_lock();
+    return result;
+}
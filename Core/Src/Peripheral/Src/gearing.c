@@ -0,0 +1,22 @@
+#include "gearing.h"
+
+void gearing_reset(struct gearing *g) {
+    *g = (struct gearing){ 0 };
+}
+
+int32_t gearing_follow(struct gearing *g, int32_t master, int32_t ratio, int32_t offset) {
+    if (g->is_started) {
+        // Shortest way from the previous position, across a wrap-around
+        g->master += (uint64_t)(int64_t)(int32_t)((uint32_t)master - (uint32_t)g->last_master);
+    } else {
+        g->master = (uint64_t)(int64_t)master;
+        g->is_started = true;
+    }
+    g->last_master = master;
+
+    // Modulo 2^64 the product is exact, and its bits 16-47 are all the
+    // result needs: no overflow whatever the ratio or the distance run
+    uint64_t product = (uint64_t)(int64_t)ratio * g->master + (GEARING_RATIO_ONE / 2);
+    g->target = (int32_t)((uint32_t)offset + (uint32_t)(product >> GEARING_RATIO_SHIFT));
+    return g->target;
+}
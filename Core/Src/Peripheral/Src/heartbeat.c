@@ -0,0 +1,37 @@
+#include "heartbeat.h"
+
+void heartbeat_consumer_configure(struct heartbeat_consumer *c, uint32_t entry, uint32_t received) {
+    uint8_t node_id = (uint8_t)(entry >> 16);
+    uint16_t time_ms = (uint16_t)entry;
+
+    *c = (struct heartbeat_consumer){
+        .received = received,
+    };
+    if (node_id >= 1 && node_id <= 127 && time_ms != 0) {
+        c->node_id = node_id;
+        c->time_us = (uint32_t)time_ms * 1000;
+    }
+}
+
+bool heartbeat_consumer_check(struct heartbeat_consumer *c, uint32_t received, uint32_t received_us,
+                              uint32_t now_us) {
+    if (c->node_id == 0) {
+        return false;
+    }
+
+    if (received != c->received) {
+        c->received = received;
+        c->last_us = received_us;
+        c->is_started = true;
+        c->is_expired = false;
+    }
+    if (!c->is_started || c->is_expired) {
+        return false;
+    }
+
+    if (now_us - c->last_us >= c->time_us) {
+        c->is_expired = true;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,321 @@
+#include "homing.h"
+#include "tmc5160.h"
+
+#define HOMING_SG_RESULT_NONE   0x3FFu
+#define HOMING_TCOOLTHRS_MAX    0xFFFFFu  // TCOOLTHRS: 20 bits
+
+static bool is_stall_method(int8_t method) {
+    return method == HOMING_METHOD_STALL_NEGATIVE || method == HOMING_METHOD_STALL_POSITIVE;
+}
+
+static bool is_negative_method(int8_t method) {
+    return method == HOMING_METHOD_STALL_NEGATIVE || method == HOMING_METHOD_SWITCH_NEGATIVE;
+}
+
+/**
+ * @brief SW_MODE polarity bits of the reference switches (0x2001:02).
+ */
+static uint32_t switch_polarity(const struct homing *homing) {
+    uint32_t sw_mode = 0;
+    if (homing->config.switch_polarity & HOMING_SWITCH_REFL_ACTIVE_LOW) {
+        sw_mode |= TMC5160_SW_MODE_POL_STOP_L;
+    }
+    if (homing->config.switch_polarity & HOMING_SWITCH_REFR_ACTIVE_LOW) {
+        sw_mode |= TMC5160_SW_MODE_POL_STOP_R;
+    }
+    return sw_mode;
+}
+
+/**
+ * @brief Linear ramp with the homing acceleration for both velocity mode
+ *        (AMAX) and positioning (DMAX, D1; V1 = 0).
+ */
+static void load_ramp(struct homing *homing, uint32_t accel) {
+    tmc5160_write_register(homing->drv, TMC5160_V1, 0);
+    tmc5160_write_register(homing->drv, TMC5160_AMAX, (int32_t)accel);
+    tmc5160_write_register(homing->drv, TMC5160_DMAX, (int32_t)accel);
+    tmc5160_write_register(homing->drv, TMC5160_D1, (int32_t)accel);
+}
+
+static void run(struct homing *homing, bool negative, uint32_t velocity) {
+    tmc5160_write_register(homing->drv, TMC5160_VMAX, (int32_t)velocity);
+    tmc5160_write_register(homing->drv, TMC5160_RAMPMODE,
+                           negative ? TMC5160_RAMPMODE_VELOCITY_NEG : TMC5160_RAMPMODE_VELOCITY_POS);
+}
+
+/**
+ * @brief Makes 'home' (an XACTUAL value) the home offset 0x607C. The motor
+ *        is at rest at 'xactual'; it is held while the counter is moved,
+ *        then left in positioning mode on its position.
+ */
+static void set_home(struct homing *homing, int32_t xactual, int32_t home) {
+    int32_t position = (int32_t)((uint32_t)homing->config.offset + ((uint32_t)xactual - (uint32_t)home));
+
+    tmc5160_write_register(homing->drv, TMC5160_RAMPMODE, TMC5160_RAMPMODE_HOLD);
+    tmc5160_write_register(homing->drv, TMC5160_XACTUAL, position);
+    tmc5160_write_register(homing->drv, TMC5160_XTARGET, position);
+    tmc5160_write_register(homing->drv, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+}
+
+/**
+ * @brief Undoes the StallGuard and switch settings of a homing run.
+ */
+static void restore_driver(struct homing *homing) {
+    tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)switch_polarity(homing));
+    tmc5160_write_register(homing->drv, TMC5160_RAMP_STAT, TMC5160_RAMP_STAT_EVENT_STOP_SG |
+                           TMC5160_RAMP_STAT_STATUS_LATCH_L | TMC5160_RAMP_STAT_STATUS_LATCH_R);
+    if (is_stall_method(homing->config.method)) {
+        tmc5160_write_register(homing->drv, TMC5160_TCOOLTHRS, 0);
+        tmc5160_write_register(homing->drv, TMC5160_GCONF, (int32_t)homing->config.gconf);
+    }
+}
+
+/**
+ * @brief Search for a hard stop with StallGuard2. The chip stops the motor
+ *        on a stall (sg_stop) once it runs faster than half the search
+ *        speed, so the acceleration phase cannot trigger it. The search
+ *        starts with start_search().
+ */
+static void prepare_stall_search(struct homing *homing) {
+    // StallGuard2 only works in SpreadCycle; GCONF is switched at standstill
+    tmc5160_write_register(homing->drv, TMC5160_GCONF, (int32_t)(homing->config.gconf & ~TMC5160_GCONF_EN_PWM_MODE));
+
+    // TSTEP = 2^24 / v for 256 microsteps: active above v / 2
+    uint32_t tcoolthrs = (1u << 25) / homing->config.fast;
+    if (tcoolthrs > HOMING_TCOOLTHRS_MAX) {
+        tcoolthrs = HOMING_TCOOLTHRS_MAX;
+    }
+    tmc5160_write_register(homing->drv, TMC5160_TCOOLTHRS, (int32_t)tcoolthrs);
+    tmc5160_write_register(homing->drv, TMC5160_COOLCONF, (int32_t)TMC5160_COOLCONF_SGT(homing->config.sgt));
+    tmc5160_write_register(homing->drv, TMC5160_RAMP_STAT, TMC5160_RAMP_STAT_EVENT_STOP_SG);
+    tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)(switch_polarity(homing) | TMC5160_SW_MODE_SG_STOP));
+}
+
+/**
+ * @brief Search for the limit switch at the fast speed. The switch stops
+ *        the motor with a soft stop (AMAX) in hardware. The search starts
+ *        with start_search().
+ */
+static void prepare_switch_search(struct homing *homing) {
+    bool negative = is_negative_method(homing->config.method);
+    uint32_t stop = negative ? TMC5160_SW_MODE_STOP_L_ENABLE : TMC5160_SW_MODE_STOP_R_ENABLE;
+
+    tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)(switch_polarity(homing) | stop | TMC5160_SW_MODE_EN_SOFTSTOP));
+}
+
+static void start_search(struct homing *homing) {
+    load_ramp(homing, homing->config.accel);
+    run(homing, is_negative_method(homing->config.method), homing->config.fast);
+}
+
+void homing_init(struct homing *homing, struct tmc5160 *drv) {
+    homing->drv = drv;
+    homing->status = HOMING_IDLE;
+    homing->phase = HOMING_PHASE_NONE;
+    homing->latch = 0;
+    homing->sg_min = HOMING_SG_RESULT_NONE;
+}
+
+bool homing_start(struct homing *homing, const struct homing_config *config) {
+    homing->config = *config;
+    homing->phase = HOMING_PHASE_NONE;
+
+    switch (config->method) {
+        case HOMING_METHOD_CURRENT_POSITION:
+        case HOMING_METHOD_CURRENT_POSITION_37:
+            homing->status = HOMING_ATTAINED;
+            return true;
+
+        case HOMING_METHOD_STALL_NEGATIVE:
+        case HOMING_METHOD_STALL_POSITIVE:
+            if (config->fast == 0) {
+                break;
+            }
+            homing->sg_min = HOMING_SG_RESULT_NONE;
+            homing->phase = HOMING_PHASE_SEARCH;
+            homing->status = HOMING_IN_PROGRESS;
+            return true;
+
+        case HOMING_METHOD_SWITCH_NEGATIVE:
+        case HOMING_METHOD_SWITCH_POSITIVE:
+            if (config->fast == 0 || config->slow == 0) {
+                break;
+            }
+            homing->phase = HOMING_PHASE_SEARCH;
+            homing->status = HOMING_IN_PROGRESS;
+            return true;
+
+        default:
+            break;
+    }
+
+    homing->status = HOMING_ERROR;
+    return false;
+}
+
+void homing_load(struct homing *homing, unsigned int step) {
+    switch (homing->config.method) {
+        case HOMING_METHOD_CURRENT_POSITION:
+        case HOMING_METHOD_CURRENT_POSITION_37:
+            // The motor is at home: XACTUAL becomes the home offset
+            if (step == 0) {
+                set_home(homing, 0, 0);
+            }
+            break;
+
+        case HOMING_METHOD_STALL_NEGATIVE:
+        case HOMING_METHOD_STALL_POSITIVE:
+            if (step == 0) {
+                prepare_stall_search(homing);
+            } else {
+                start_search(homing);
+            }
+            break;
+
+        case HOMING_METHOD_SWITCH_NEGATIVE:
+        case HOMING_METHOD_SWITCH_POSITIVE:
+            if (step == 0) {
+                prepare_switch_search(homing);
+            } else {
+                start_search(homing);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Search for the hard stop: finished by the StallGuard2 stop event.
+ *        The lowest SG_RESULT at search speed is kept for tuning SGT.
+ */
+static void poll_stall_search(struct homing *homing) {
+    static const uint8_t addresses[] = { TMC5160_RAMP_STAT, TMC5160_DRV_STATUS, TMC5160_XACTUAL };
+    int32_t regs[3];
+
+    tmc5160_read_registers(homing->drv, addresses, regs, 3);
+    uint32_t ramp_stat = (uint32_t)regs[0];
+
+    if (ramp_stat & TMC5160_RAMP_STAT_VELOCITY_REACHED) {
+        uint16_t sg = (uint16_t)TMC5160_DRV_STATUS_SG_RESULT(regs[1]);
+        if (sg < homing->sg_min) {
+            homing->sg_min = sg;
+        }
+    }
+
+    if (!(ramp_stat & TMC5160_RAMP_STAT_EVENT_STOP_SG)) {
+        return;
+    }
+
+    // Stopped at the hard stop. No new velocity before sg_stop is released.
+    tmc5160_write_register(homing->drv, TMC5160_VMAX, 0);
+    set_home(homing, regs[2], regs[2]);
+    restore_driver(homing);
+
+    homing->phase = HOMING_PHASE_NONE;
+    homing->status = HOMING_ATTAINED;
+}
+
+void homing_poll(struct homing *homing) {
+    if (homing->phase == HOMING_PHASE_NONE) {
+        return;
+    }
+    if (homing->phase == HOMING_PHASE_SEARCH && is_stall_method(homing->config.method)) {
+        poll_stall_search(homing);
+        return;
+    }
+
+    bool negative = is_negative_method(homing->config.method);
+    uint32_t ramp_stat = (uint32_t)tmc5160_read_register(homing->drv, TMC5160_RAMP_STAT);
+
+    switch (homing->phase) {
+        case HOMING_PHASE_SEARCH: {
+            // On the switch and stopped by it: leave it slowly, latching the release edge
+            uint32_t on_switch = negative ? TMC5160_RAMP_STAT_STATUS_STOP_L : TMC5160_RAMP_STAT_STATUS_STOP_R;
+            if (!(ramp_stat & on_switch) || !(ramp_stat & TMC5160_RAMP_STAT_VZERO)) {
+                break;
+            }
+            uint32_t stop = negative ? TMC5160_SW_MODE_STOP_L_ENABLE : TMC5160_SW_MODE_STOP_R_ENABLE;
+            uint32_t latch = negative ? TMC5160_SW_MODE_LATCH_L_INACTIVE : TMC5160_SW_MODE_LATCH_R_INACTIVE;
+            tmc5160_write_register(homing->drv, TMC5160_RAMP_STAT, TMC5160_RAMP_STAT_STATUS_LATCH_L | TMC5160_RAMP_STAT_STATUS_LATCH_R);
+            tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)(switch_polarity(homing) | stop | latch | TMC5160_SW_MODE_EN_SOFTSTOP));
+            run(homing, !negative, homing->config.slow);
+            homing->phase = HOMING_PHASE_RELEASE;
+            break;
+        }
+
+        case HOMING_PHASE_RELEASE: {
+            // Release edge latched: go back to it in positioning mode
+            uint32_t latched = negative ? TMC5160_RAMP_STAT_STATUS_LATCH_L : TMC5160_RAMP_STAT_STATUS_LATCH_R;
+            if (!(ramp_stat & latched)) {
+                break;
+            }
+            homing->latch = tmc5160_read_register(homing->drv, TMC5160_XLATCH);
+            tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)switch_polarity(homing));
+            tmc5160_write_register(homing->drv, TMC5160_XTARGET, homing->latch);
+            tmc5160_write_register(homing->drv, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+            homing->phase = HOMING_PHASE_RETURN;
+            break;
+        }
+
+        case HOMING_PHASE_RETURN:
+            if (ramp_stat & TMC5160_RAMP_STAT_POSITION_REACHED) {
+                set_home(homing, homing->latch, homing->latch);
+                restore_driver(homing);
+                homing->phase = HOMING_PHASE_NONE;
+                homing->status = HOMING_ATTAINED;
+            }
+            break;
+
+        case HOMING_PHASE_STOP:
+            if (ramp_stat & TMC5160_RAMP_STAT_VZERO) {
+                int32_t xactual = tmc5160_read_register(homing->drv, TMC5160_XACTUAL);
+                tmc5160_write_register(homing->drv, TMC5160_XTARGET, xactual);
+                tmc5160_write_register(homing->drv, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+                restore_driver(homing);
+                homing->phase = HOMING_PHASE_NONE;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool homing_abort(struct homing *homing) {
+    if (homing->phase == HOMING_PHASE_NONE || homing->phase == HOMING_PHASE_STOP) {
+        homing_reset(homing);
+        return false;
+    }
+
+    homing->phase = HOMING_PHASE_STOP;
+    homing->status = HOMING_IDLE;
+    return true;
+}
+
+void homing_load_stop(struct homing *homing, uint32_t decel) {
+    // Velocity mode with VMAX = 0 decelerates with AMAX from any motion
+    tmc5160_write_register(homing->drv, TMC5160_VMAX, 0);
+    tmc5160_write_register(homing->drv, TMC5160_AMAX, (int32_t)decel);
+    tmc5160_write_register(homing->drv, TMC5160_RAMPMODE, TMC5160_RAMPMODE_VELOCITY_POS);
+    tmc5160_write_register(homing->drv, TMC5160_SW_MODE, (int32_t)switch_polarity(homing));
+}
+
+void homing_reset(struct homing *homing) {
+    if (homing->phase == HOMING_PHASE_NONE || homing->phase == HOMING_PHASE_STOP) {
+        homing->status = HOMING_IDLE;
+    }
+}
+
+enum homing_status homing_get_status(const struct homing *homing) {
+    return homing->status;
+}
+
+bool homing_is_moving(const struct homing *homing) {
+    return homing->phase != HOMING_PHASE_NONE;
+}
+
+uint16_t homing_sg_result(const struct homing *homing) {
+    return homing->sg_min;
+}
@@ -0,0 +1,170 @@
+#include "interpolation.h"
+#include "tmc5160.h"
+
+#include <stdatomic.h>
+
+_Static_assert((INTERPOLATION_BUFFER_DEPTH & (INTERPOLATION_BUFFER_DEPTH - 1)) == 0,
+               "INTERPOLATION_BUFFER_DEPTH must be a power of two");
+
+#define INTERPOLATION_VMAX_MAX  0x7FFE00u // VMAX: 2^23 - 512
+
+void interpolation_init(struct interpolation *ip, struct interpolation_buffer *buffer) {
+    *ip = (struct interpolation){
+        .points = buffer->points,
+        .size = INTERPOLATION_BUFFER_DEPTH,
+        .is_accepting = true,
+    };
+}
+
+uint32_t interpolation_period_us(uint8_t value, int8_t index) {
+    uint32_t period = value;
+
+    if (index < INTERPOLATION_INDEX_MIN || index > INTERPOLATION_INDEX_MAX) {
+        return 0;
+    }
+    for (int8_t i = INTERPOLATION_INDEX_MIN; i < index; i++) {
+        period *= 10;
+    }
+    return period;
+}
+
+bool interpolation_push(struct interpolation *ip, int32_t point) {
+    if (!ip->is_accepting || interpolation_count(ip) >= ip->size) {
+        return false;
+    }
+    ip->points[ip->head % INTERPOLATION_BUFFER_DEPTH] = point;
+    // The point must be in place before the interrupt sees the new head
+    atomic_signal_fence(memory_order_release);
+    ip->head++;
+    return true;
+}
+
+size_t interpolation_count(const struct interpolation *ip) {
+    return ip->head - ip->tail;
+}
+
+size_t interpolation_space(const struct interpolation *ip) {
+    size_t count = interpolation_count(ip);
+
+    if (!ip->is_accepting || count >= ip->size) {
+        return 0;
+    }
+    return ip->size - count;
+}
+
+void interpolation_set_access(struct interpolation *ip, bool enable) {
+    if (!enable) {
+        ip->tail = ip->head;
+    }
+    ip->is_accepting = enable;
+}
+
+bool interpolation_set_size(struct interpolation *ip, uint32_t size) {
+    if (size == 0 || size > INTERPOLATION_BUFFER_DEPTH) {
+        return false;
+    }
+    ip->size = size;
+    ip->tail = ip->head;
+    return true;
+}
+
+void interpolation_start(struct interpolation *ip, int32_t position, uint32_t period_us, uint32_t tick_us) {
+    uint32_t ticks = (period_us + tick_us / 2) / tick_us;
+
+    if (ticks == 0) {
+        ticks = 1;
+    }
+    ip->position = position;
+    ip->ticks_per_point = ticks;
+    ip->period_us = ticks * tick_us;
+    ip->ticks = ticks - 1;
+    ip->is_running = false;
+    ip->scan_index = ip->tail;
+    ip->scan_dir = 0;
+    ip->is_run_closed = true;
+    // The consumer state must be complete before the interrupt sees it enabled
+    atomic_signal_fence(memory_order_release);
+    ip->is_enabled = true;
+}
+
+void interpolation_stop(struct interpolation *ip) {
+    ip->is_enabled = false;
+    atomic_signal_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief VMAX that covers 'distance' usteps in 'period_us', rounded up; at
+ *        least one ustep per period, so lagging motors still arrive.
+ */
+static uint32_t segment_vmax(uint32_t distance, uint32_t period_us) {
+    uint64_t clocks = (uint64_t)period_us * (TMC5160_FCLK / 1000000);
+    uint64_t v;
+
+    if (distance == 0) {
+        distance = 1;
+    }
+    v = (((uint64_t)distance << 24) + clocks - 1) / clocks;
+    return (v > INTERPOLATION_VMAX_MAX) ? INTERPOLATION_VMAX_MAX : (uint32_t)v;
+}
+
+/**
+ * @brief Extends the run ahead of the consumer over the buffered points,
+ *        INTERPOLATION_SCAN_MAX at most. A reversal or a repeated point
+ *        (a dwell) closes it.
+ */
+static void scan_run(struct interpolation *ip, uint32_t head) {
+    for (unsigned int n = 0; n < INTERPOLATION_SCAN_MAX && !ip->is_run_closed && ip->scan_index != head; n++) {
+        int32_t delta = ip->points[ip->scan_index % INTERPOLATION_BUFFER_DEPTH] - ip->scan_position;
+
+        if ((delta > 0 && ip->scan_dir > 0) || (delta < 0 && ip->scan_dir < 0)) {
+            ip->scan_position += delta;
+            ip->scan_index++;
+        } else {
+            ip->is_run_closed = true;
+        }
+    }
+}
+
+bool interpolation_tick(struct interpolation *ip, struct interpolation_step *step) {
+    if (!ip->is_enabled) {
+        return false;
+    }
+    if (++ip->ticks < ip->ticks_per_point) {
+        return false;
+    }
+    ip->ticks = 0;
+
+    uint32_t head = ip->head;
+    uint32_t tail = ip->tail;
+    atomic_signal_fence(memory_order_acquire);
+
+    if (head == tail) {
+        if (ip->is_running) {
+            ip->is_running = false;
+            ip->underruns++;
+        }
+        return false;
+    }
+
+    int32_t point = ip->points[tail % INTERPOLATION_BUFFER_DEPTH];
+    int32_t delta = point - ip->position;
+    int8_t dir = (delta > 0) - (delta < 0);
+
+    // The point continues the run found so far, or starts a new one
+    if (dir == 0 || dir != ip->scan_dir || (int32_t)(ip->scan_index - tail) <= 0) {
+        ip->scan_dir = dir;
+        ip->scan_position = point;
+        ip->scan_index = tail + 1;
+        ip->is_run_closed = (dir == 0);
+    }
+    scan_run(ip, head);
+
+    step->xtarget = ip->scan_position;
+    step->vmax = segment_vmax((delta < 0) ? (uint32_t)0 - (uint32_t)delta : (uint32_t)delta, ip->period_us);
+
+    ip->position = point;
+    ip->is_running = true;
+    atomic_signal_fence(memory_order_release);
+    ip->tail = tail + 1;
+    return true;
+}
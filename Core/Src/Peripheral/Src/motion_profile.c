@@ -0,0 +1,102 @@
+#include "motion_profile.h"
+#include "tmc5160.h"
+
+#define RAMP_A_MAX      0xFFFFu   // A1, AMAX, DMAX, D1: 16 bits
+#define RAMP_V1_MAX     0xFFFFFu  // V1: 20 bits
+#define RAMP_VMAX_MAX   0x7FFE00u // VMAX: 2^23 - 512
+
+// V1 = a^2 / (2 * jerk) converted to chip units. With a in AMAX units and
+// jerk in usteps/s^3 this is V1 = a^2 * fCLK^3 / (2^59 * jerk); the factor
+// fCLK^3 / 2^59 is kept in Q16 (about 3000 at 12 MHz). fCLK is a multiple
+// of 256, so (fCLK / 256)^3 still fits 64 bits.
+#define RAMP_V1_SCALE_Q16 \
+    (((uint64_t)(TMC5160_FCLK >> 8) * (TMC5160_FCLK >> 8) * (TMC5160_FCLK >> 8)) >> 19)
+
+static uint32_t clamp(uint32_t value, uint32_t low, uint32_t high) {
+    return (value < low) ? low : (value > high) ? high : value;
+}
+
+void motion_profile_compute(struct tmc5160_ramp *ramp, int16_t type, uint32_t vmax,
+                            uint32_t accel, uint32_t decel, uint32_t jerk) {
+    ramp->vmax = clamp(vmax, 0, RAMP_VMAX_MAX);
+    ramp->amax = clamp(accel, 1, RAMP_A_MAX);
+    ramp->dmax = clamp(decel, 1, RAMP_A_MAX);
+
+    // Linear ramp: one acceleration from standstill. D1 must not be 0 in
+    // positioning mode even when V1 = 0 leaves it unused.
+    ramp->v1 = 0;
+    ramp->a1 = ramp->amax;
+    ramp->d1 = ramp->dmax;
+
+    if (type == MOTION_PROFILE_LINEAR || jerk == 0) {
+        return;
+    }
+
+    uint64_t a = (ramp->amax > ramp->dmax) ? ramp->amax : ramp->dmax;
+    uint64_t v1 = (a * a * RAMP_V1_SCALE_Q16 / jerk) >> 16;
+
+    // Keep a full-acceleration phase below VMAX
+    if (v1 > ramp->vmax / 2) {
+        v1 = ramp->vmax / 2;
+    }
+    if (v1 == 0) {
+        return;  // Jerk limit above what the ramp can resolve
+    }
+
+    ramp->v1 = clamp((uint32_t)v1, 1, RAMP_V1_MAX);
+    ramp->a1 = clamp(ramp->amax / 2, 1, RAMP_A_MAX);
+    ramp->d1 = clamp(ramp->dmax / 2, 1, RAMP_A_MAX);
+}
+
+void motion_profile_stop_ramp(struct tmc5160_ramp *ramp, uint32_t vmax, uint32_t decel) {
+    motion_profile_compute(ramp, MOTION_PROFILE_LINEAR, vmax, decel, decel, 0);
+}
+
+int32_t motion_profile_stop_position(int32_t xactual, int32_t vactual, uint32_t decel,
+                                     uint32_t lead_clocks) {
+    uint64_t speed = (vactual < 0) ? (uint64_t)(-(int64_t)vactual) : (uint64_t)vactual;
+    uint64_t a = clamp(decel, 1, RAMP_A_MAX);
+    uint64_t d = 256 * a;
+
+    // Until XTARGET is written the motor may still accelerate, with AMAX =
+    // 'decel' (velocity grows by 'a' every 2^17 clocks); brake from the
+    // highest speed it can have by then. Velocity is in 2^-24 usteps per clock.
+    speed += (a * lead_clocks + (1u << 17) - 1) >> 17;
+    uint64_t distance = (speed * speed + d - 1) / d + ((speed * lead_clocks + (1u << 24) - 1) >> 24);
+    return (vactual < 0) ? xactual - (int32_t)distance : xactual + (int32_t)distance;
+}
+
+uint32_t motion_profile_brake_distance(const struct tmc5160_ramp *ramp, uint32_t speed) {
+    uint64_t v = speed;
+    uint64_t v1 = (ramp->v1 < speed) ? ramp->v1 : speed;
+
+    uint64_t low = v1 * v1 / (256 * (uint64_t)ramp->d1);
+    uint64_t high = (v * v - v1 * v1) / (256 * (uint64_t)ramp->dmax);
+    return (uint32_t)(low + high);
+}
+
+int32_t motion_profile_csv_velocity(int32_t target, int32_t offset) {
+    int64_t v = (int64_t)target + offset;
+
+    if (v > (int64_t)RAMP_VMAX_MAX) {
+        return (int32_t)RAMP_VMAX_MAX;
+    }
+    if (v < -(int64_t)RAMP_VMAX_MAX) {
+        return -(int32_t)RAMP_VMAX_MAX;
+    }
+    return (int32_t)v;
+}
+
+uint32_t motion_profile_csv_accel(int32_t from, int32_t to, uint32_t period_us) {
+    int64_t delta = (int64_t)to - from;
+    uint64_t change = (delta < 0) ? (uint64_t)-delta : (uint64_t)delta;
+
+    if (period_us == 0) {
+        return RAMP_A_MAX;
+    }
+
+    // Clocks of one period: fCLK / 1 MHz is 12 at 12 MHz
+    uint64_t clocks = (uint64_t)period_us * (TMC5160_FCLK / 1000000);
+    uint64_t accel = ((change << 17) + clocks - 1) / clocks;
+    return clamp((accel > RAMP_A_MAX) ? RAMP_A_MAX : (uint32_t)accel, 1, RAMP_A_MAX);
+}
@@ -0,0 +1,240 @@
+#include "motion_queue.h"
+#include "motion_profile.h"
+#include "spi.h" // SPI1_CS_COUNT
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+_Static_assert((MOTION_QUEUE_DEPTH & (MOTION_QUEUE_DEPTH - 1)) == 0, "MOTION_QUEUE_DEPTH must be a power of two");
+
+// Travel between reading XACTUAL/VACTUAL and writing the stop XTARGET: the
+// write follows the read within the same tick
+#define MOTION_QUEUE_STOP_LEAD_CLOCKS   (TMC5160_FCLK / 20000) // 50 us
+
+bool motion_queue_post(struct motion_queue *q, const struct motion_command *cmd, uint32_t *index) {
+    uint32_t head = q->head;
+
+    if (head - q->tail >= MOTION_QUEUE_DEPTH) {
+        return false;
+    }
+    q->entries[head % MOTION_QUEUE_DEPTH] = *cmd;
+    // The command must be in place before the interrupt sees the new head
+    atomic_signal_fence(memory_order_release);
+    q->head = head + 1;
+    if (index) {
+        *index = head;
+    }
+    return true;
+}
+
+bool motion_queue_is_done(const struct motion_queue *q, uint32_t index) {
+    return (int32_t)(q->tail - index) > 0;
+}
+
+/**
+ * @brief Number of commands from 'tail' on that write the same register of
+ *        different chips and can go out as one batch.
+ */
+static size_t batch_length(const struct motion_queue *q, uint32_t tail, uint32_t head, size_t max) {
+    const struct motion_command *first = &q->entries[tail % MOTION_QUEUE_DEPTH];
+    size_t n = 1;
+
+    while (n < max && tail + n != head) {
+        const struct motion_command *next = &q->entries[(tail + n) % MOTION_QUEUE_DEPTH];
+        if (next->type != MOTION_COMMAND_WRITE || next->address != first->address) {
+            break;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (q->entries[(tail + i) % MOTION_QUEUE_DEPTH].drv == next->drv) {
+                return n;
+            }
+        }
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Stop target as start_stop_ramp() computes it, never past the
+ *        target the motor was heading for.
+ */
+static void execute_stop(const struct motion_command *cmd) {
+    static const uint8_t addresses[] = { TMC5160_XACTUAL, TMC5160_VACTUAL, TMC5160_XTARGET };
+    int32_t regs[3];
+
+    tmc5160_read_registers(cmd->drv, addresses, regs, 3);
+    int32_t xactual = regs[0];
+    int32_t vactual = (int32_t)((uint32_t)regs[1] << 8) >> 8;
+    int32_t xtarget = regs[2];
+    int32_t target = motion_profile_stop_position(xactual, vactual, (uint32_t)cmd->value,
+                                                  MOTION_QUEUE_STOP_LEAD_CLOCKS);
+
+    if ((vactual > 0 && xtarget >= xactual && xtarget < target) ||
+        (vactual < 0 && xtarget <= xactual && xtarget > target)) {
+        target = xtarget;
+    }
+    tmc5160_write_register(cmd->drv, TMC5160_XTARGET, target);
+}
+
+void motion_command_execute(const struct motion_command *cmd) {
+    switch (cmd->type) {
+        case MOTION_COMMAND_WRITE:
+            tmc5160_write_register(cmd->drv, cmd->address, cmd->value);
+            break;
+        case MOTION_COMMAND_COPY:
+            tmc5160_write_register(cmd->drv, cmd->address, tmc5160_read_register(cmd->drv, (uint8_t)cmd->value));
+            break;
+        case MOTION_COMMAND_STOP:
+            execute_stop(cmd);
+            break;
+        case MOTION_COMMAND_ENABLE:
+            tmc5160_set_driver_enabled(cmd->drv, cmd->value != 0);
+            break;
+        case MOTION_COMMAND_CONFIGURE:
+            tmc5160_write_driver_config(cmd->drv);
+            break;
+        case MOTION_COMMAND_CALL:
+            cmd->call(cmd->context, cmd->value);
+            break;
+        default:
+            break;
+    }
+}
+
+unsigned int motion_command_datagrams(const struct motion_command *cmd) {
+    switch (cmd->type) {
+        case MOTION_COMMAND_WRITE:
+        case MOTION_COMMAND_ENABLE:
+            return 1;
+        case MOTION_COMMAND_COPY:
+            return 3; // Request, reply, write
+        case MOTION_COMMAND_STOP:
+            return 5; // Three registers pipelined, then XTARGET
+        case MOTION_COMMAND_CONFIGURE:
+            return 5; // See tmc5160_write_driver_config()
+        case MOTION_COMMAND_CALL:
+            return cmd->datagrams;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Datagrams of a tick for 'period_us', before its share of the
+ *        fitted axes.
+ */
+static unsigned int tick_datagrams(uint32_t period_us) {
+    return (unsigned int)((uint64_t)period_us * 1000u * MOTION_TICK_SPI_LOAD_PERCENT / 100u / MOTION_TICK_DATAGRAM_NS);
+}
+
+/**
+ * @brief Datagrams every tick spends on 'axes' fitted axes: VMAX and
+ *        XTARGET of interpolation, and the sample of one.
+ */
+static unsigned int axes_datagrams(unsigned int axes) {
+    if (axes == 0) {
+        return 0;
+    }
+    return 2 * MOTION_BATCH_DATAGRAMS(axes) + MOTION_TICK_SAMPLE_DATAGRAMS;
+}
+
+unsigned int motion_tick_budget(uint32_t period_us, unsigned int axes) {
+    unsigned int datagrams = tick_datagrams(period_us);
+    unsigned int reserved = axes_datagrams(axes);
+
+    return (datagrams > reserved) ? datagrams - reserved : 0;
+}
+
+uint32_t motion_tick_min_period_us(unsigned int axes) {
+    uint64_t ns = (uint64_t)(axes_datagrams(axes) + MOTION_COMMAND_DATAGRAMS_MAX) * MOTION_TICK_DATAGRAM_NS;
+
+    return (uint32_t)((ns * 100u + (uint64_t)MOTION_TICK_SPI_LOAD_PERCENT * 1000u - 1u) /
+                      ((uint64_t)MOTION_TICK_SPI_LOAD_PERCENT * 1000u));
+}
+
+static bool is_discarded(const struct motion_queue *q, const struct motion_command *cmd) {
+    return cmd->drv && (q->discarded & (1u << cmd->drv->cs));
+}
+
+unsigned int motion_queue_execute(struct motion_queue *q, unsigned int budget) {
+    uint32_t head = q->head;
+    uint32_t tail = q->tail;
+    unsigned int done = 0;
+    unsigned int spent = 0;
+
+    atomic_signal_fence(memory_order_acquire);
+
+    while (tail != head && done < MOTION_QUEUE_TICK_MAX) {
+        const struct motion_command *cmd = &q->entries[tail % MOTION_QUEUE_DEPTH];
+        unsigned int datagrams = motion_command_datagrams(cmd);
+        size_t n = 1;
+
+        // A batch takes the chips the budget has room for
+        if (cmd->type == MOTION_COMMAND_WRITE) {
+            size_t max = MOTION_QUEUE_TICK_MAX - done;
+            if (max > SPI1_CS_COUNT) {
+                max = SPI1_CS_COUNT;
+            }
+            if (!SPI1_DAISY_CHAIN_LENGTH && spent < budget && max > budget - spent) {
+                max = budget - spent;
+            }
+            n = batch_length(q, tail, head, max);
+            datagrams = MOTION_BATCH_DATAGRAMS(n);
+        }
+        if (spent > 0 && spent + datagrams > budget) {
+            break;
+        }
+        spent += datagrams;
+
+        switch (cmd->type) {
+            case MOTION_COMMAND_WRITE: {
+                struct tmc5160 *drvs[SPI1_CS_COUNT];
+                int32_t values[SPI1_CS_COUNT];
+                size_t count = 0;
+
+                for (size_t i = 0; i < n; i++) {
+                    const struct motion_command *write = &q->entries[(tail + i) % MOTION_QUEUE_DEPTH];
+                    if (!is_discarded(q, write)) {
+                        drvs[count] = write->drv;
+                        values[count] = write->value;
+                        count++;
+                    }
+                }
+                if (count) {
+                    tmc5160_write_registers_batch(drvs, count, cmd->address, values);
+                }
+                break;
+            }
+            case MOTION_COMMAND_MARK:
+                q->mark_latency = q->cycles() - cmd->posted;
+                q->marks++;
+                break;
+            default:
+                if (!is_discarded(q, cmd)) {
+                    motion_command_execute(cmd);
+                }
+                break;
+        }
+
+        // The oldest command of the batch waited the longest
+        uint32_t latency = q->cycles() - cmd->posted;
+        if (latency > q->max_latency) {
+            q->max_latency = latency;
+        }
+        q->executed += n;
+        done += n;
+        tail += n;
+
+        // Done with the entries before the producer may reuse them
+        atomic_signal_fence(memory_order_release);
+        q->tail = tail;
+    }
+    return done;
+}
+
+void motion_queue_reset_stats(struct motion_queue *q) {
+    q->executed = 0;
+    q->max_latency = 0;
+    q->marks = 0;
+    q->mark_latency = 0;
+}
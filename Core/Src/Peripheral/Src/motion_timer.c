@@ -0,0 +1,57 @@
+#include "motion_timer.h"
+#include "stm32f4xx.h"
+
+#include <stddef.h>
+
+// APB1 timer clock: twice PCLK1 (42 MHz) since APB1 is divided
+#define MOTION_TIMER_CLOCK_HZ   84000000u
+
+static void (*volatile motion_timer_handler)(void) = NULL;
+static uint32_t motion_timer_period = MOTION_TIMER_PERIOD_US;
+
+static bool motion_timer_is_valid(uint32_t period_us) {
+    return period_us >= MOTION_TIMER_PERIOD_MIN_US && period_us <= MOTION_TIMER_PERIOD_MAX_US;
+}
+
+void motion_timer_start(uint32_t period_us, void (*handler)(void)) {
+    motion_timer_handler = handler;
+    motion_timer_period = motion_timer_is_valid(period_us) ? period_us : MOTION_TIMER_PERIOD_US;
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;
+
+    TIM7->CR1 = 0;
+    TIM7->PSC = MOTION_TIMER_CLOCK_HZ / 1000000u - 1; // 1 us per count
+    TIM7->ARR = motion_timer_period - 1;
+    TIM7->EGR = TIM_EGR_UG;    // Load PSC and ARR now
+    TIM7->SR = 0;              // UG sets UIF as well
+    TIM7->DIER = TIM_DIER_UIE;
+
+    NVIC_SetPriority(TIM7_IRQn, MOTION_TIMER_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TIM7_IRQn);
+
+    TIM7->CR1 = TIM_CR1_CEN;
+}
+
+bool motion_timer_set_period(uint32_t period_us) {
+    if (!motion_timer_is_valid(period_us)) {
+        return false;
+    }
+    motion_timer_period = period_us;
+    TIM7->ARR = period_us - 1; // ARPE = 0: a counter already past it wraps at 0xFFFF, so restart it
+    TIM7->CNT = 0;
+    return true;
+}
+
+uint32_t motion_timer_period_us(void) {
+    return motion_timer_period;
+}
+
+// TIM7 Interrupt Handler
+void TIM7_IRQHandler(void) {
+    if (TIM7->SR & TIM_SR_UIF) {
+        TIM7->SR = ~(uint32_t)TIM_SR_UIF; // rc_w0: the 1s leave the other flags alone
+        if (motion_timer_handler) {
+            motion_timer_handler();
+        }
+    }
+}
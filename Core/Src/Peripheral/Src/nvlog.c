@@ -0,0 +1,286 @@
+#include "nvlog.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#define NVLOG_VERSION           1
+
+// Record types, stored in the top byte of the key word (0xFF = erased)
+#define NVLOG_TYPE_VALUE        0x01
+#define NVLOG_TYPE_BEGIN        0x02
+#define NVLOG_TYPE_COMMIT       0x03
+#define NVLOG_TYPE_HEADER       0x5A
+
+#define NVLOG_ERASED            0xFFFFFFFFu
+
+struct nvlog_record {
+    uint32_t key;   // type << 24 | key
+    uint32_t value;
+    uint32_t check; // CRC-32 of key and value, programmed last
+};
+
+// Per-entry state of nvlog_store(), filled by the backward scan
+#define NVLOG_ENTRY_SEEN        0x01
+#define NVLOG_ENTRY_CHANGED     0x02
+
+struct nvlog_diff {
+    const struct nvlog_entry *entries;
+    size_t n;
+    uint8_t state[NVLOG_MAX_ENTRIES];
+};
+
+static uint32_t nvlog_crc32(const uint8_t *data, size_t n) {
+    // Nibble table of the reflected CRC-32 (0xEDB88320)
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for (size_t i = 0; i < n; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+static uint32_t nvlog_check(uint32_t key, uint32_t value) {
+    uint8_t bytes[8];
+
+    memcpy(&bytes[0], &key, sizeof(key));
+    memcpy(&bytes[4], &value, sizeof(value));
+    return nvlog_crc32(bytes, sizeof(bytes));
+}
+
+static uint32_t nvlog_capacity(const struct nvlog_flash *flash) {
+    return flash->size / NVLOG_SLOT_SIZE;
+}
+
+static void nvlog_read(const struct nvlog_flash *flash, int sector, uint32_t slot, struct nvlog_record *rec) {
+    memcpy(rec, flash->base[sector] + slot * NVLOG_SLOT_SIZE, sizeof(*rec));
+}
+
+static bool nvlog_is_erased(const struct nvlog_record *rec) {
+    return rec->key == NVLOG_ERASED && rec->value == NVLOG_ERASED && rec->check == NVLOG_ERASED;
+}
+
+static bool nvlog_is_valid(const struct nvlog_record *rec) {
+    return rec->check == nvlog_check(rec->key, rec->value);
+}
+
+static int nvlog_write(struct nvlog *log, int sector, uint32_t slot, uint8_t type, uint32_t key, uint32_t value) {
+    struct nvlog_record rec;
+
+    rec.key = ((uint32_t)type << 24) | (key & NVLOG_KEY_MAX);
+    rec.value = value;
+    rec.check = nvlog_check(rec.key, rec.value);
+
+    const uint8_t *dst = log->flash->base[sector] + slot * NVLOG_SLOT_SIZE;
+    return log->flash->program(dst, (const uint32_t *)&rec, sizeof(rec) / sizeof(uint32_t));
+}
+
+static bool nvlog_read_header(const struct nvlog_flash *flash, int sector, uint32_t *seq) {
+    struct nvlog_record rec;
+
+    nvlog_read(flash, sector, 0, &rec);
+    if (rec.key != (((uint32_t)NVLOG_TYPE_HEADER << 24) | NVLOG_VERSION) || !nvlog_is_valid(&rec)) {
+        return false;
+    }
+    *seq = rec.value;
+    return true;
+}
+
+static bool nvlog_sector_is_blank(const struct nvlog_flash *flash, int sector) {
+    const uint8_t *p = flash->base[sector];
+
+    for (uint32_t i = 0; i < flash->size; i++) {
+        if (p[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void nvlog_mount(struct nvlog *log, const struct nvlog_flash *flash) {
+    uint32_t seq[NVLOG_SECTORS];
+    bool valid[NVLOG_SECTORS];
+
+    log->flash = flash;
+    log->active = -1;
+    log->seq = 0;
+    log->end = 1;
+    log->is_spare_erased = false;
+
+    for (int s = 0; s < NVLOG_SECTORS; s++) {
+        valid[s] = nvlog_read_header(flash, s, &seq[s]);
+    }
+    // Both valid: a compaction was cut off before the old sector was erased.
+    if (valid[0] && (!valid[1] || (int32_t)(seq[0] - seq[1]) > 0)) {
+        log->active = 0;
+    } else if (valid[1]) {
+        log->active = 1;
+    } else {
+        return;
+    }
+    log->seq = seq[log->active];
+
+    // Slots are used strictly in order, so the first erased one is the end.
+    uint32_t lo = 1;
+    uint32_t hi = nvlog_capacity(flash);
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        struct nvlog_record rec;
+        nvlog_read(flash, log->active, mid, &rec);
+        if (nvlog_is_erased(&rec)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    log->end = lo;
+}
+
+void nvlog_for_each(const struct nvlog *log, nvlog_visit_t *visit, void *data) {
+    // Walking backwards, a value counts only if a COMMIT was passed after the
+    // last BEGIN (or damaged record): the tail of an interrupted batch is skipped.
+    bool committed = false;
+
+    if (log->active < 0) {
+        return;
+    }
+
+    for (uint32_t slot = log->end; slot-- > 1;) {
+        struct nvlog_record rec;
+        nvlog_read(log->flash, log->active, slot, &rec);
+
+        if (!nvlog_is_valid(&rec)) {
+            committed = false;
+            continue;
+        }
+        switch (rec.key >> 24) {
+            case NVLOG_TYPE_COMMIT:
+                committed = true;
+                break;
+            case NVLOG_TYPE_VALUE:
+                if (committed && visit(rec.key & NVLOG_KEY_MAX, rec.value, data)) {
+                    return;
+                }
+                break;
+            default:
+                committed = false;
+                break;
+        }
+    }
+}
+
+static int nvlog_diff_visit(uint32_t key, uint32_t value, void *data) {
+    struct nvlog_diff *diff = data;
+
+    for (size_t i = 0; i < diff->n; i++) {
+        if (diff->entries[i].key == key && !(diff->state[i] & NVLOG_ENTRY_SEEN)) {
+            diff->state[i] |= NVLOG_ENTRY_SEEN;
+            if (diff->entries[i].value != value) {
+                diff->state[i] |= NVLOG_ENTRY_CHANGED;
+            }
+            break;
+        }
+    }
+    return 0;
+}
+
+static int nvlog_spare(const struct nvlog *log) {
+    return (log->active < 0) ? 0 : 1 - log->active;
+}
+
+int nvlog_erase_spare(struct nvlog *log) {
+    int spare = nvlog_spare(log);
+
+    if (log->is_spare_erased) {
+        return 0;
+    }
+    if (!nvlog_sector_is_blank(log->flash, spare) && log->flash->erase((unsigned int)spare)) {
+        return -1;
+    }
+    log->is_spare_erased = true;
+    return 0;
+}
+
+/**
+ * @brief Writes all entries as the first batch of the spare sector. The header
+ *        goes in last, so the new sector only becomes valid once complete.
+ *        The old sector is left as it is: it becomes the spare.
+ */
+static int nvlog_compact(struct nvlog *log, const struct nvlog_entry *entries, size_t n) {
+    int target = nvlog_spare(log);
+    uint32_t slot = 1;
+
+    if (nvlog_erase_spare(log)) {
+        return -1;
+    }
+    log->is_spare_erased = false; // Written from here on
+
+    if (nvlog_write(log, target, slot++, NVLOG_TYPE_BEGIN, 0, (uint32_t)n)) {
+        return -1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (nvlog_write(log, target, slot++, NVLOG_TYPE_VALUE, entries[i].key, entries[i].value)) {
+            return -1;
+        }
+    }
+    if (nvlog_write(log, target, slot++, NVLOG_TYPE_COMMIT, 0, (uint32_t)n)
+            || nvlog_write(log, target, 0, NVLOG_TYPE_HEADER, NVLOG_VERSION, log->seq + 1)) {
+        return -1;
+    }
+
+    log->active = target;
+    log->seq++;
+    log->end = slot;
+    return 0;
+}
+
+int nvlog_store(struct nvlog *log, const struct nvlog_entry *entries, size_t n) {
+    static struct nvlog_diff diff;
+    size_t changed = 0;
+
+    if (n > NVLOG_MAX_ENTRIES || n + 3 > nvlog_capacity(log->flash)) {
+        return -1;
+    }
+
+    diff.entries = entries;
+    diff.n = n;
+    memset(diff.state, 0, sizeof(diff.state));
+    nvlog_for_each(log, &nvlog_diff_visit, &diff);
+
+    for (size_t i = 0; i < n; i++) {
+        if (!(diff.state[i] & NVLOG_ENTRY_SEEN)) {
+            diff.state[i] |= NVLOG_ENTRY_CHANGED;
+        }
+        if (diff.state[i] & NVLOG_ENTRY_CHANGED) {
+            changed++;
+        }
+    }
+    if (changed == 0) {
+        return 0;
+    }
+
+    if (log->active < 0 || log->end + changed + 2 > nvlog_capacity(log->flash)) {
+        return nvlog_compact(log, entries, n);
+    }
+
+    uint32_t slot = log->end;
+    if (nvlog_write(log, log->active, slot++, NVLOG_TYPE_BEGIN, 0, (uint32_t)changed)) {
+        log->end = slot;
+        return -1;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if ((diff.state[i] & NVLOG_ENTRY_CHANGED)
+                && nvlog_write(log, log->active, slot++, NVLOG_TYPE_VALUE, entries[i].key, entries[i].value)) {
+            log->end = slot;
+            return -1;
+        }
+    }
+    int rc = nvlog_write(log, log->active, slot++, NVLOG_TYPE_COMMIT, 0, (uint32_t)changed);
+    log->end = slot;
+    return rc ? -1 : 0;
+}
@@ -0,0 +1,295 @@
+#include "nvparam.h"
+#include "nvlog.h"
+#include "flash.h"
+
+#include <lely/co/obj.h>
+#include <lely/co/sdo.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Signatures of CiA 301 for 0x1010 ("save") and 0x1011 ("load")
+#define NVPARAM_SIGNATURE_SAVE  0x65766173
+#define NVPARAM_SIGNATURE_LOAD  0x64616F6C
+
+// First of the two flash sectors holding the log (sector 10 and 11)
+#define NVPARAM_FLASH_SECTOR    10
+
+// Parameter groups, selected by the sub-index of 0x1010/0x1011
+#define NVPARAM_GROUP_COMM      (1 << 0) // Sub-index 2: 0x1000-0x1FFF
+#define NVPARAM_GROUP_APP       (1 << 1) // Sub-index 3: 0x6000-0x9FFF
+#define NVPARAM_GROUP_MFR       (1 << 2) // Sub-index 4: 0x2000-0x5FFF
+#define NVPARAM_GROUP_ALL       (NVPARAM_GROUP_COMM | NVPARAM_GROUP_APP | NVPARAM_GROUP_MFR)
+
+#define NVPARAM_KEY(idx, subidx) (((uint32_t)(idx) << 8) | (subidx))
+
+// Repeats of a table entry: the object alone, 20 PDOs, the objects of the
+// four axes 0x800 apart
+#define NVPARAM_ONCE            1, 0
+#define NVPARAM_PDOS            20, 1
+#define NVPARAM_AXES            4, 0x800
+
+struct nvparam_object {
+    co_unsigned16_t idx;
+    co_unsigned8_t first; // First and last stored sub-index
+    co_unsigned8_t last;
+    co_unsigned8_t count; // Repeats at idx + k * stride
+    co_unsigned16_t stride;
+};
+
+// Stored objects. Process data and commands (controlword, mode of operation,
+// target position, scope control) are left out on purpose.
+static const struct nvparam_object nvparam_objects[] = {
+    { 0x1005, 0x00, 0x00, NVPARAM_ONCE }, // COB-ID SYNC
+    { 0x1006, 0x00, 0x00, NVPARAM_ONCE }, // Communication cycle period
+    { 0x1012, 0x00, 0x00, NVPARAM_ONCE }, // COB-ID TIME
+    { 0x1014, 0x00, 0x00, NVPARAM_ONCE }, // COB-ID EMCY
+    { 0x1015, 0x00, 0x00, NVPARAM_ONCE }, // Inhibit time EMCY
+    { 0x1016, 0x01, 0x04, NVPARAM_ONCE }, // Consumer heartbeat times
+    { 0x1017, 0x00, 0x00, NVPARAM_ONCE }, // Producer heartbeat time
+    { 0x1400, 0x01, 0x02, NVPARAM_PDOS }, // RPDO communication parameters (unused numbers are absent)
+    { 0x1600, 0x00, 0x08, NVPARAM_PDOS }, // RPDO mapping
+    { 0x1800, 0x01, 0x02, NVPARAM_PDOS }, // TPDO communication parameters
+    { 0x1A00, 0x00, 0x08, NVPARAM_PDOS }, // TPDO mapping
+    { 0x1F80, 0x00, 0x00, NVPARAM_ONCE }, // NMT startup
+    { 0x2000, 0x01, 0x05, NVPARAM_AXES }, // TMC5160 driver configuration
+    { 0x2001, 0x01, 0x02, NVPARAM_AXES }, // StallGuard threshold, reference switch polarity
+    { 0x2002, 0x01, 0x03, NVPARAM_AXES }, // Encoder configuration
+    { 0x2005, 0x02, 0x03, NVPARAM_AXES }, // Gear ratio and offset
+    { 0x2100, 0x01, 0x03, NVPARAM_ONCE }, // Scope channels, period, pre-trigger
+    { 0x2107, 0x01, 0x01, NVPARAM_ONCE }, // Motion tick period
+    { 0x6007, 0x00, 0x00, NVPARAM_AXES }, // Abort connection option code
+    { 0x605A, 0x00, 0x00, NVPARAM_AXES }, // Quick stop option code
+    { 0x605D, 0x00, 0x00, NVPARAM_AXES }, // Halt option code
+    { 0x6065, 0x00, 0x00, NVPARAM_AXES }, // Following error window
+    { 0x6066, 0x00, 0x00, NVPARAM_AXES }, // Following error time out
+    { 0x607C, 0x00, 0x00, NVPARAM_AXES }, // Home offset
+    { 0x6081, 0x00, 0x00, NVPARAM_AXES }, // Profile velocity
+    { 0x6083, 0x00, 0x00, NVPARAM_AXES }, // Profile acceleration
+    { 0x6084, 0x00, 0x00, NVPARAM_AXES }, // Profile deceleration
+    { 0x6085, 0x00, 0x00, NVPARAM_AXES }, // Quick stop deceleration
+    { 0x6086, 0x00, 0x00, NVPARAM_AXES }, // Motion profile type
+    { 0x608F, 0x01, 0x02, NVPARAM_AXES }, // Position encoder resolution
+    { 0x6091, 0x01, 0x02, NVPARAM_AXES }, // Gear ratio
+    { 0x6092, 0x01, 0x02, NVPARAM_AXES }, // Feed constant
+    { 0x6098, 0x00, 0x00, NVPARAM_AXES }, // Homing method
+    { 0x6099, 0x01, 0x02, NVPARAM_AXES }, // Homing speeds
+    { 0x609A, 0x00, 0x00, NVPARAM_AXES }, // Homing acceleration
+    { 0x60A4, 0x01, 0x01, NVPARAM_AXES }, // Profile jerk
+    { 0x60C2, 0x01, 0x02, NVPARAM_AXES }, // Interpolation time period
+    { 0x60C4, 0x02, 0x02, NVPARAM_AXES }, // Interpolation buffer size
+};
+
+#define NVPARAM_OBJECT_COUNT    (sizeof(nvparam_objects) / sizeof(nvparam_objects[0]))
+
+static int nvparam_flash_erase(unsigned int sector);
+static int nvparam_flash_program(const uint8_t *dst, const uint32_t *src, size_t words);
+
+static const struct nvlog_flash nvparam_flash = {
+    .base = { (const uint8_t *)FLASH_SECTOR_10_ADDR, (const uint8_t *)FLASH_SECTOR_11_ADDR },
+    .size = FLASH_SECTOR_128K_SIZE,
+    .erase = &nvparam_flash_erase,
+    .program = &nvparam_flash_program,
+};
+
+static co_dev_t *nvparam_dev = NULL;
+static bool (*nvparam_is_busy)(void) = NULL;
+static struct nvlog nvparam_log;
+
+// Values currently in the log, and the set being prepared for the next store
+static struct nvlog_entry nvparam_stored[NVLOG_MAX_ENTRIES];
+static size_t nvparam_stored_count = 0;
+static size_t nvparam_storable_count = 0; // Table entries present in the OD
+static struct nvlog_entry nvparam_entries[NVLOG_MAX_ENTRIES];
+
+static co_unsigned32_t on_write_store(co_sub_t *sub, struct co_sdo_req *req, void *data);
+
+static int nvparam_flash_erase(unsigned int sector) {
+    return flash_erase_sector(NVPARAM_FLASH_SECTOR + sector);
+}
+
+static int nvparam_flash_program(const uint8_t *dst, const uint32_t *src, size_t words) {
+    return flash_program((uintptr_t)dst, src, words);
+}
+
+static unsigned int nvparam_group(co_unsigned16_t idx) {
+    if (idx < 0x2000) {
+        return NVPARAM_GROUP_COMM;
+    }
+    return (idx < 0x6000) ? NVPARAM_GROUP_MFR : NVPARAM_GROUP_APP;
+}
+
+static co_unsigned16_t nvparam_index(const struct nvparam_object *obj, unsigned int k) {
+    return (co_unsigned16_t)(obj->idx + k * obj->stride);
+}
+
+bool nvparam_is_stored(co_unsigned16_t idx, co_unsigned8_t subidx) {
+    for (size_t i = 0; i < NVPARAM_OBJECT_COUNT; i++) {
+        const struct nvparam_object *obj = &nvparam_objects[i];
+        if (subidx < obj->first || subidx > obj->last) {
+            continue;
+        }
+        for (unsigned int k = 0; k < obj->count; k++) {
+            if (nvparam_index(obj, k) == idx) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool nvparam_is_storable(const co_sub_t *sub) {
+    return sub && co_type_sizeof(co_sub_get_type(sub)) <= sizeof(uint32_t);
+}
+
+static size_t nvparam_count_storable(void) {
+    size_t n = 0;
+
+    for (size_t i = 0; i < NVPARAM_OBJECT_COUNT; i++) {
+        const struct nvparam_object *obj = &nvparam_objects[i];
+        for (unsigned int k = 0; k < obj->count; k++) {
+            for (unsigned int subidx = obj->first; subidx <= obj->last; subidx++) {
+                if (nvparam_is_storable(co_dev_find_sub(nvparam_dev, nvparam_index(obj, k), (co_unsigned8_t)subidx))) {
+                    n++;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+static bool nvparam_find_stored(uint32_t key, uint32_t *value) {
+    for (size_t i = 0; i < nvparam_stored_count; i++) {
+        if (nvparam_stored[i].key == key) {
+            *value = nvparam_stored[i].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief nvlog visitor: writes a stored value into the Object Dictionary.
+ *        Values arrive newest first, so a key that was seen before is skipped.
+ *        The scan stops as soon as every stored object has its value, which
+ *        keeps the boot time independent of how long the log has grown.
+ */
+static int nvparam_restore_visit(uint32_t key, uint32_t value, void *data) {
+    (void)data;
+    uint32_t unused;
+
+    if (nvparam_find_stored(key, &unused)) {
+        return 0;
+    }
+
+    // Objects no longer in the table (older firmware) are ignored.
+    co_unsigned16_t idx = (co_unsigned16_t)(key >> 8);
+    co_unsigned8_t subidx = (co_unsigned8_t)(key & 0xFF);
+    co_sub_t *sub = co_dev_find_sub(nvparam_dev, idx, subidx);
+    if (!nvparam_is_storable(sub) || !nvparam_is_stored(idx, subidx) || nvparam_stored_count == NVLOG_MAX_ENTRIES) {
+        return 0;
+    }
+    co_sub_set_val(sub, &value, co_type_sizeof(co_sub_get_type(sub)));
+
+    nvparam_stored[nvparam_stored_count].key = key;
+    nvparam_stored[nvparam_stored_count].value = value;
+    nvparam_stored_count++;
+    return nvparam_stored_count == nvparam_storable_count;
+}
+
+/**
+ * @brief Fills nvparam_entries with the complete set to store: current (or
+ *        default) values for the selected groups, the stored values for the rest.
+ * @return Number of entries.
+ */
+static size_t nvparam_collect(unsigned int groups, bool defaults) {
+    size_t n = 0;
+
+    for (size_t i = 0; i < NVPARAM_OBJECT_COUNT; i++) {
+        const struct nvparam_object *obj = &nvparam_objects[i];
+
+        for (unsigned int k = 0; k < obj->count; k++) {
+            co_unsigned16_t idx = nvparam_index(obj, k);
+
+            for (unsigned int subidx = obj->first; subidx <= obj->last && n < NVLOG_MAX_ENTRIES; subidx++) {
+                co_sub_t *sub = co_dev_find_sub(nvparam_dev, idx, (co_unsigned8_t)subidx);
+                if (!nvparam_is_storable(sub)) {
+                    continue;
+                }
+                size_t size = co_type_sizeof(co_sub_get_type(sub));
+
+                struct nvlog_entry *entry = &nvparam_entries[n];
+                entry->key = NVPARAM_KEY(idx, subidx);
+                entry->value = 0;
+
+                if (nvparam_group(idx) & groups) {
+                    memcpy(&entry->value, defaults ? co_sub_get_def(sub) : co_sub_get_val(sub), size);
+                } else if (!nvparam_find_stored(entry->key, &entry->value)) {
+                    continue; // Not selected and never stored: stays at the DCF default
+                }
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+void nvparam_init(co_dev_t *dev, bool (*is_busy)(void)) {
+    nvparam_dev = dev;
+    nvparam_is_busy = is_busy;
+
+    nvlog_mount(&nvparam_log, &nvparam_flash);
+    nvparam_storable_count = nvparam_count_storable();
+    nvparam_stored_count = 0;
+    nvlog_for_each(&nvparam_log, &nvparam_restore_visit, NULL);
+
+    for (co_unsigned8_t subidx = 0x01; subidx <= 0x04; subidx++) {
+        co_sub_set_dn_ind(co_dev_find_sub(dev, NVPARAM_OBJ_STORE, subidx), &on_write_store, NULL);
+        co_sub_set_dn_ind(co_dev_find_sub(dev, NVPARAM_OBJ_RESTORE, subidx), &on_write_store, NULL);
+    }
+}
+
+/**
+ * @brief SDO download to 0x1010 (store) or 0x1011 (restore defaults).
+ *        The object keeps its value 1 ("saves on command"); only the
+ *        signature is checked. Refused while a drive is enabled, since
+ *        programming (and an erase, if the spare sector is not erased yet)
+ *        stalls the MCU.
+ */
+static co_unsigned32_t on_write_store(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+    co_unsigned32_t signature;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &signature, &ac) == -1) {
+        return ac;
+    }
+
+    bool restore = co_obj_get_idx(co_sub_get_obj(sub)) == NVPARAM_OBJ_RESTORE;
+    if (signature != (restore ? NVPARAM_SIGNATURE_LOAD : NVPARAM_SIGNATURE_SAVE)) {
+        return CO_SDO_AC_DATA;
+    }
+    if (nvparam_is_busy()) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    static const unsigned int groups[] = {
+        0, NVPARAM_GROUP_ALL, NVPARAM_GROUP_COMM, NVPARAM_GROUP_APP, NVPARAM_GROUP_MFR
+    };
+    size_t n = nvparam_collect(groups[co_sub_get_subidx(sub)], restore);
+    if (nvlog_store(&nvparam_log, nvparam_entries, n)) {
+        return CO_SDO_AC_HARDWARE;
+    }
+
+    memcpy(nvparam_stored, nvparam_entries, n * sizeof(nvparam_entries[0]));
+    nvparam_stored_count = n;
+    return 0;
+}
+
+void nvparam_poll(void) {
+    if (nvparam_log.is_spare_erased || flash_is_busy() || nvparam_is_busy()) {
+        return;
+    }
+    // Not fatal: the next compaction erases it
+    nvlog_erase_spare(&nvparam_log);
+}
@@ -0,0 +1,369 @@
+#include "scope.h"
+#include "boot_time.h"
+#include "systick.h"
+#include "tmc5160.h"
+
+#include <lely/co/obj.h>
+#include <lely/co/sdo.h>
+#include <stdbool.h>
+
+// 32 KB of the 64 KB CCM RAM. Not touched by DMA, so the CPU has it to itself.
+#define SCOPE_BUFFER_WORDS      8192
+#define SCOPE_FORMAT_VERSION    2
+
+// The upload hands Lely the ring buffer in chunks of this size and counts as
+// running until SCOPE_UPLOAD_HOLD_MS after the last one: Lely still sends
+// from the buffer then, and an aborted upload is never reported. One chunk
+// takes about 150 ms at 125 kbit/s.
+#define SCOPE_UPLOAD_CHUNK_BYTES 1024
+#define SCOPE_UPLOAD_HOLD_MS    1000
+
+// Header sent in front of the samples in the 0x2101 upload (little-endian)
+struct scope_header {
+    uint8_t version;
+    uint8_t channels;     // Channel mask the capture was taken with
+    uint16_t period_ms;   // Configured sample period
+    uint16_t samples;     // Number of samples that follow
+    uint16_t pre_trigger; // Index of the first sample taken after the trigger
+    uint32_t period_us;   // Mean interval of the samples, measured (0 below two samples)
+};
+
+static int32_t scope_buffer[SCOPE_BUFFER_WORDS] __attribute__((section(".ccm_noinit")));
+
+static co_dev_t *scope_dev = NULL;
+static struct tmc5160 *scope_drv = NULL; // TMC5160 of the recorded axis
+static scope_state_t scope_state = SCOPE_STATE_IDLE;
+
+// Configuration latched when the recorder is armed
+static uint8_t scope_channels = 0;
+static uint16_t scope_period_ms = 1;
+static uint16_t scope_pre_trigger = 0;
+static uint32_t scope_width = 1;    // int32 words per sample
+static uint32_t scope_capacity = 0; // Samples that fit into the buffer
+
+// TMC5160 registers fetched for every sample (one burst read)
+static uint8_t scope_reg_addr[4];
+static size_t scope_reg_count = 0;
+
+// Ring buffer state, in samples
+static uint32_t scope_head = 0;
+static uint32_t scope_count = 0;
+static uint32_t scope_post_remaining = 0;
+static uint32_t scope_next_sample_us = 0;
+
+// Time since arming, from the cycle counter
+static uint32_t scope_clock_base_us = 0;
+static uint32_t scope_clock_base_cycles = 0;
+
+static struct scope_header scope_upload_header;
+static bool scope_is_uploading = false;
+static uint32_t scope_upload_ms = 0; // millis() of the last chunk handed to Lely
+
+static co_unsigned32_t on_write_config(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_control(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_capture(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+
+static void scope_set_state(scope_state_t state) {
+    scope_state = state;
+    co_dev_set_val_u8(scope_dev, SCOPE_OBJ_CONFIG, 0x05, (co_unsigned8_t)state);
+    co_dev_set_val_u16(scope_dev, SCOPE_OBJ_CONFIG, 0x06, (co_unsigned16_t)scope_count);
+}
+
+/**
+ * @brief Microseconds since the recorder was armed. The base is moved on
+ *        well before the cycle counter wraps (25 s at 168 MHz).
+ */
+static uint32_t scope_clock_us(void) {
+    uint32_t now = boot_time_cycles();
+    uint32_t elapsed = now - scope_clock_base_cycles;
+    uint32_t us = scope_clock_base_us + boot_time_cycles_to_us(elapsed);
+
+    if (elapsed >= (1u << 30)) {
+        scope_clock_base_us = us;
+        scope_clock_base_cycles = now;
+    }
+    return us;
+}
+
+/**
+ * @brief Whether Lely may still be sending from the ring buffer.
+ */
+static bool scope_upload_is_running(void) {
+    if (scope_is_uploading && millis() - scope_upload_ms >= SCOPE_UPLOAD_HOLD_MS) {
+        scope_is_uploading = false;
+    }
+    return scope_is_uploading;
+}
+
+static uint32_t scope_popcount(uint8_t mask) {
+    uint32_t n = 0;
+    for (; mask; mask &= mask - 1) {
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Latches the configuration from 0x2100 and clears the ring buffer.
+ *        The time channel is always recorded.
+ */
+static void scope_arm(void) {
+    scope_channels = (co_dev_get_val_u8(scope_dev, SCOPE_OBJ_CONFIG, 0x01) & SCOPE_CH_ALL) | SCOPE_CH_TIME;
+    scope_period_ms = co_dev_get_val_u16(scope_dev, SCOPE_OBJ_CONFIG, 0x02);
+    scope_pre_trigger = co_dev_get_val_u16(scope_dev, SCOPE_OBJ_CONFIG, 0x03);
+
+    if (scope_channels == SCOPE_CH_TIME) {
+        scope_channels |= SCOPE_CH_XACTUAL;
+    }
+    if (scope_period_ms == 0) {
+        scope_period_ms = 1;
+    }
+
+    scope_width = scope_popcount(scope_channels);
+    scope_capacity = SCOPE_BUFFER_WORDS / scope_width;
+    if (scope_capacity > CO_UNSIGNED16_MAX) {
+        scope_capacity = CO_UNSIGNED16_MAX;
+    }
+    if (scope_pre_trigger >= scope_capacity) {
+        scope_pre_trigger = (uint16_t)(scope_capacity - 1);
+    }
+
+    // DRV_STATUS carries both SG_RESULT and CS_ACTUAL, so it is read once.
+    scope_reg_count = 0;
+    if (scope_channels & SCOPE_CH_XACTUAL) {
+        scope_reg_addr[scope_reg_count++] = TMC5160_XACTUAL;
+    }
+    if (scope_channels & SCOPE_CH_VACTUAL) {
+        scope_reg_addr[scope_reg_count++] = TMC5160_VACTUAL;
+    }
+    if (scope_channels & SCOPE_CH_RAMP_STAT) {
+        scope_reg_addr[scope_reg_count++] = TMC5160_RAMP_STAT;
+    }
+    if (scope_channels & (SCOPE_CH_SG_RESULT | SCOPE_CH_CS_ACTUAL)) {
+        scope_reg_addr[scope_reg_count++] = TMC5160_DRV_STATUS;
+    }
+
+    scope_head = 0;
+    scope_count = 0;
+    scope_post_remaining = 0;
+    scope_clock_base_us = 0;
+    scope_clock_base_cycles = boot_time_cycles();
+    scope_next_sample_us = 0;
+
+    scope_set_state(SCOPE_STATE_ARMED);
+}
+
+/**
+ * @brief Switches from pre-trigger to post-trigger recording.
+ *        Only the newest 'pre_trigger' samples of the history are kept.
+ */
+static void scope_start_post_trigger(void) {
+    if (scope_count > scope_pre_trigger) {
+        scope_count = scope_pre_trigger;
+    }
+    scope_post_remaining = scope_capacity - scope_count;
+    scope_pre_trigger = (uint16_t)scope_count;
+
+    scope_set_state(SCOPE_STATE_TRIGGERED);
+}
+
+static void scope_take_sample(void) {
+    int32_t regs[4];
+    int32_t *slot = &scope_buffer[scope_head * scope_width];
+    size_t r = 0;
+
+    // Stamped right before the burst, so jitter of the loop shows in the data
+    *slot++ = (int32_t)scope_clock_us();
+    tmc5160_read_registers(scope_drv, scope_reg_addr, regs, scope_reg_count);
+
+    if (scope_channels & SCOPE_CH_XACTUAL) {
+        *slot++ = regs[r++];
+    }
+    if (scope_channels & SCOPE_CH_VACTUAL) {
+        // VACTUAL is a 24-bit two's complement value
+        *slot++ = (int32_t)((uint32_t)regs[r++] << 8) >> 8;
+    }
+    if (scope_channels & SCOPE_CH_RAMP_STAT) {
+        *slot++ = regs[r++];
+    }
+    if (scope_channels & (SCOPE_CH_SG_RESULT | SCOPE_CH_CS_ACTUAL)) {
+        int32_t drv_status = regs[r++];
+        if (scope_channels & SCOPE_CH_SG_RESULT) {
+            *slot++ = drv_status & 0x3FF;
+        }
+        if (scope_channels & SCOPE_CH_CS_ACTUAL) {
+            *slot++ = (drv_status >> 16) & 0x1F;
+        }
+    }
+    if (scope_channels & SCOPE_CH_STATUSWORD) {
+        *slot++ = co_dev_get_val_u16(scope_dev, 0x6041, 0x00);
+    }
+
+    scope_head = (scope_head + 1) % scope_capacity;
+    if (scope_count < scope_capacity) {
+        scope_count++;
+    }
+}
+
+void scope_init(co_dev_t *dev, struct tmc5160 *drv) {
+    scope_dev = dev;
+    scope_drv = drv;
+
+    for (co_unsigned8_t subidx = 0x01; subidx <= 0x03; subidx++) {
+        co_sub_set_dn_ind(co_dev_find_sub(dev, SCOPE_OBJ_CONFIG, subidx), &on_write_config, NULL);
+    }
+    co_sub_set_dn_ind(co_dev_find_sub(dev, SCOPE_OBJ_CONFIG, 0x04), &on_write_control, NULL);
+    co_sub_set_up_ind(co_dev_find_sub(dev, SCOPE_OBJ_CAPTURE, 0x00), &on_read_capture, NULL);
+
+    scope_set_state(SCOPE_STATE_IDLE);
+}
+
+void scope_poll(void) {
+    if (scope_state != SCOPE_STATE_ARMED && scope_state != SCOPE_STATE_TRIGGERED) {
+        return;
+    }
+    // Without pre-trigger history there is nothing to record until the trigger.
+    if (scope_state == SCOPE_STATE_ARMED && scope_pre_trigger == 0) {
+        return;
+    }
+
+    uint32_t period_us = scope_period_ms * 1000u;
+    uint32_t late = scope_clock_us() - scope_next_sample_us;
+    if (late >= (1u << 31)) {
+        return; // Not due yet
+    }
+    // Keep a fixed grid; resynchronise instead of bursting after a long stall.
+    scope_next_sample_us += (late >= period_us) ? late + period_us : period_us;
+
+    scope_take_sample();
+
+    if (scope_state == SCOPE_STATE_TRIGGERED && --scope_post_remaining == 0) {
+        scope_set_state(SCOPE_STATE_DONE);
+    }
+}
+
+void scope_trigger(void) {
+    if (scope_state == SCOPE_STATE_ARMED) {
+        scope_start_post_trigger();
+    }
+}
+
+/**
+ * @brief SDO download to 0x2100:01..03. The configuration is latched on arm,
+ *        so changing it while recording is refused.
+ */
+static co_unsigned32_t on_write_config(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+
+    if (scope_state == SCOPE_STATE_ARMED || scope_state == SCOPE_STATE_TRIGGERED) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    // Default download, including the range check against the OD limits
+    co_sub_on_dn(sub, req, &ac);
+    return ac;
+}
+
+/**
+ * @brief SDO download to 0x2100:04 (scope control).
+ */
+static co_unsigned32_t on_write_control(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+    co_unsigned8_t command;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED8, &command, &ac) == -1) {
+        return ac;
+    }
+
+    // Arming clears the ring buffer Lely may still be sending from.
+    bool is_arming = command == SCOPE_CMD_ARM ||
+                     (command == SCOPE_CMD_TRIGGER && scope_state != SCOPE_STATE_ARMED &&
+                      scope_state != SCOPE_STATE_TRIGGERED);
+    if (is_arming && scope_upload_is_running()) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    switch (command) {
+        case SCOPE_CMD_STOP:
+            if (scope_state == SCOPE_STATE_ARMED || scope_state == SCOPE_STATE_TRIGGERED) {
+                scope_set_state(scope_count ? SCOPE_STATE_DONE : SCOPE_STATE_IDLE);
+            }
+            break;
+        case SCOPE_CMD_ARM:
+            scope_arm();
+            break;
+        case SCOPE_CMD_TRIGGER:
+            if (scope_state != SCOPE_STATE_ARMED && scope_state != SCOPE_STATE_TRIGGERED) {
+                scope_arm();
+            }
+            if (scope_state == SCOPE_STATE_ARMED) {
+                scope_start_post_trigger();
+            }
+            break;
+        default:
+            return CO_SDO_AC_PARAM_VAL;
+    }
+
+    co_sub_dn(sub, &command);
+    return 0;
+}
+
+/**
+ * @brief SDO upload of 0x2101 (capture). Streams the header and then the ring
+ *        buffer in place: each call hands Lely up to SCOPE_UPLOAD_CHUNK_BYTES
+ *        of contiguous samples starting at req->offset, so nothing is copied.
+ *        Re-arming is refused meanwhile (scope_upload_is_running()).
+ */
+static co_unsigned32_t on_read_capture(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    (void)data;
+
+    if (scope_state == SCOPE_STATE_ARMED || scope_state == SCOPE_STATE_TRIGGERED) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    uint32_t total_words = scope_count * scope_width;
+    uint32_t ring_words = scope_capacity * scope_width;
+    uint32_t oldest = ((scope_head + scope_capacity - scope_count) % scope_capacity) * scope_width;
+
+    scope_is_uploading = true;
+    scope_upload_ms = millis();
+
+    if (co_sdo_req_first(req)) {
+        scope_upload_header.version = SCOPE_FORMAT_VERSION;
+        scope_upload_header.channels = scope_channels;
+        scope_upload_header.period_ms = scope_period_ms;
+        scope_upload_header.samples = (uint16_t)scope_count;
+        scope_upload_header.pre_trigger = scope_pre_trigger;
+        scope_upload_header.period_us = 0;
+        if (scope_count >= 2) {
+            // The time channel comes first in every sample
+            uint32_t newest = (oldest + total_words - scope_width) % ring_words;
+            uint32_t span = (uint32_t)scope_buffer[newest] - (uint32_t)scope_buffer[oldest];
+            scope_upload_header.period_us = span / (scope_count - 1);
+        }
+
+        req->size = sizeof(scope_upload_header) + total_words * sizeof(int32_t);
+        req->buf = &scope_upload_header;
+        req->nbyt = sizeof(scope_upload_header);
+        return 0;
+    }
+
+    // Every chunk is a whole number of words, so offsets stay word aligned.
+    uint32_t word = (req->offset - sizeof(scope_upload_header)) / sizeof(int32_t);
+    uint32_t phys = (oldest + word) % ring_words;
+
+    uint32_t n = total_words - word;
+    if (n > ring_words - phys) {
+        n = ring_words - phys; // Stop at the wrap-around, the next call continues at index 0
+    }
+    if (n > SCOPE_UPLOAD_CHUNK_BYTES / sizeof(int32_t)) {
+        n = SCOPE_UPLOAD_CHUNK_BYTES / sizeof(int32_t);
+    }
+
+    req->buf = &scope_buffer[phys];
+    req->nbyt = n * sizeof(int32_t);
+    return 0;
+}
@@ -16,7 +16,7 @@ const struct co_sdev slave_sdev = {
 	.rate = 125,
 	.lss = 0,
 	.dummy = 0x000000fe,
-	.nobj = 30,
+	.nobj = 271,
 	.objs = (const struct co_sobj[]){{
 #if !LELY_NO_CO_OBJ_NAME
 		.name = CO_SDEV_STRING("Device type"),
@@ -69,100 +69,84 @@ const struct co_sdev slave_sdev = {
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("COB-ID time stamp object"),
+		.name = CO_SDEV_STRING("Pre-defined error field"),
 #endif
-		.idx = 0x1012,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
+		.idx = 0x1003,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 9,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID time stamp object"),
+			.name = CO_SDEV_STRING("Number of errors"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x80000100lu },
+			.def = { .u8 = CO_UNSIGNED8_MIN },
 #endif
-			.val = { .u32 = 0x80000100lu },
+			.val = { .u8 = CO_UNSIGNED8_MIN },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
-#if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Producer heartbeat time"),
-#endif
-		.idx = 0x1017,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
-		.subs = (const struct co_ssub[]){{
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Producer heartbeat time"),
+			.name = CO_SDEV_STRING("Standard error field 1"),
 #endif
-			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED16,
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u16 = CO_UNSIGNED16_MIN },
-			.max = { .u16 = CO_UNSIGNED16_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u16 = 0x03e8u },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u16 = 0x03e8u },
-			.access = CO_ACCESS_RW,
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
-#if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Identity object"),
-#endif
-		.idx = 0x1018,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 5,
-		.subs = (const struct co_ssub[]){{
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Highest sub-index supported"),
+			.name = CO_SDEV_STRING("Standard error field 2"),
 #endif
-			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED8,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = CO_UNSIGNED8_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x04 },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u8 = 0x04 },
-			.access = CO_ACCESS_CONST,
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Vendor-ID"),
+			.name = CO_SDEV_STRING("Standard error field 3"),
 #endif
-			.subidx = 0x01,
+			.subidx = 0x03,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000360lu },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u32 = 0x00000360lu },
+			.val = { .u32 = CO_UNSIGNED32_MIN },
 			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Product code"),
+			.name = CO_SDEV_STRING("Standard error field 4"),
 #endif
-			.subidx = 0x02,
+			.subidx = 0x04,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -177,9 +161,9 @@ const struct co_sdev slave_sdev = {
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Revision number"),
+			.name = CO_SDEV_STRING("Standard error field 5"),
 #endif
-			.subidx = 0x03,
+			.subidx = 0x05,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -194,9 +178,9 @@ const struct co_sdev slave_sdev = {
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Serial number"),
+			.name = CO_SDEV_STRING("Standard error field 6"),
 #endif
-			.subidx = 0x04,
+			.subidx = 0x06,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -209,95 +193,118 @@ const struct co_sdev slave_sdev = {
 			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 1 Communication Parameter"),
+			.name = CO_SDEV_STRING("Standard error field 7"),
 #endif
-		.idx = 0x1400,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 3,
-		.subs = (const struct co_ssub[]){{
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of Entries"),
+			.name = CO_SDEV_STRING("Standard error field 8"),
 #endif
-			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED8,
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = 0x02 },
-			.max = { .u8 = 0x02 },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x02 },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u8 = 0x02 },
+			.val = { .u32 = CO_UNSIGNED32_MIN },
 			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID use by RPDO 1"),
+		.name = CO_SDEV_STRING("COB-ID SYNC message"),
 #endif
-			.subidx = 0x01,
+		.idx = 0x1005,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID SYNC message"),
+#endif
+			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000202lu },
+			.def = { .u32 = 0x00000080lu },
 #endif
-			.val = { .u32 = 0x00000202lu },
+			.val = { .u32 = 0x00000080lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-				| CO_OBJ_FLAGS_DEF_NODEID
-				| CO_OBJ_FLAGS_VAL_NODEID
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Transmission type RPDO 1"),
+		.name = CO_SDEV_STRING("Communication cycle period"),
 #endif
-			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED8,
+		.idx = 0x1006,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Communication cycle period"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = CO_UNSIGNED8_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = CO_UNSIGNED8_MAX },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.val = { .u32 = CO_UNSIGNED32_MIN },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 2 Communication Parameter"),
+		.name = CO_SDEV_STRING("Store parameters"),
 #endif
-		.idx = 0x1401,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 3,
+		.idx = 0x1010,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 5,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of Entries"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = 0x02 },
-			.max = { .u8 = 0x02 },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x02 },
+			.def = { .u8 = 0x04 },
 #endif
-			.val = { .u8 = 0x02 },
+			.val = { .u8 = 0x04 },
 			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID use by RPDO 2"),
+			.name = CO_SDEV_STRING("Save all parameters"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -306,120 +313,91 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000302lu },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = 0x00000302lu },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-				| CO_OBJ_FLAGS_DEF_NODEID
-				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Transmission type RPDO 2"),
+			.name = CO_SDEV_STRING("Save communication parameters"),
 #endif
 			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED8,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = CO_UNSIGNED8_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = CO_UNSIGNED8_MAX },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
-#if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 3 Communication Parameter"),
-#endif
-		.idx = 0x1402,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 3,
-		.subs = (const struct co_ssub[]){{
-#if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of Entries"),
-#endif
-			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED8,
-#if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = 0x02 },
-			.max = { .u8 = 0x02 },
-#endif
-#if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x02 },
-#endif
-			.val = { .u8 = 0x02 },
-			.access = CO_ACCESS_RO,
-			.pdo_mapping = 0,
-			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID use by RPDO 3"),
+			.name = CO_SDEV_STRING("Save application parameters"),
 #endif
-			.subidx = 0x01,
+			.subidx = 0x03,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000402lu },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = 0x00000402lu },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-				| CO_OBJ_FLAGS_DEF_NODEID
-				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Transmission type RPDO 3"),
+			.name = CO_SDEV_STRING("Save manufacturer defined parameters"),
 #endif
-			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED8,
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = CO_UNSIGNED8_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = CO_UNSIGNED8_MAX },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 1 mapping parameter"),
+		.name = CO_SDEV_STRING("Restore default parameters"),
 #endif
-		.idx = 0x1600,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 9,
+		.idx = 0x1011,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 5,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of mapped objects RPDO 1"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = 0x08 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x01 },
+			.def = { .u8 = 0x04 },
 #endif
-			.val = { .u8 = 0x01 },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 1"),
+			.name = CO_SDEV_STRING("Restore all default parameters"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -428,15 +406,15 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60400010lu },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = 0x60400010lu },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 2"),
+			.name = CO_SDEV_STRING("Restore communication default parameters"),
 #endif
 			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -445,15 +423,15 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 3"),
+			.name = CO_SDEV_STRING("Restore application default parameters"),
 #endif
 			.subidx = 0x03,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -462,15 +440,15 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 4"),
+			.name = CO_SDEV_STRING("Restore manufacturer defined default parameters"),
 #endif
 			.subidx = 0x04,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -479,108 +457,117 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 5"),
-#endif
-			.subidx = 0x05,
-			.type = CO_DEFTYPE_UNSIGNED32,
-#if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
-#endif
-#if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+		.name = CO_SDEV_STRING("COB-ID time stamp object"),
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
-			.pdo_mapping = 0,
-			.flags = 0
-		}, {
+		.idx = 0x1012,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 6"),
+			.name = CO_SDEV_STRING("COB-ID time stamp object"),
 #endif
-			.subidx = 0x06,
+			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x80000100lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x80000100lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 7"),
+		.name = CO_SDEV_STRING("COB-ID EMCY"),
 #endif
-			.subidx = 0x07,
+		.idx = 0x1014,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID EMCY"),
+#endif
+			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000082lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000082lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 1 mapping information 8"),
+		.name = CO_SDEV_STRING("Inhibit time EMCY"),
 #endif
-			.subidx = 0x08,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1015,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Inhibit time EMCY"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u16 = CO_UNSIGNED16_MIN },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u16 = CO_UNSIGNED16_MIN },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 2 mapping parameter"),
+		.name = CO_SDEV_STRING("Consumer heartbeat time"),
 #endif
-		.idx = 0x1601,
-		.code = CO_OBJECT_RECORD,
-		.nsub = 9,
+		.idx = 0x1016,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 5,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of mapped objects RPDO 2"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = 0x08 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x02 },
+			.def = { .u8 = 0x04 },
 #endif
-			.val = { .u8 = 0x02 },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 1"),
+			.name = CO_SDEV_STRING("Consumer heartbeat time 1"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -589,15 +576,15 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60400010lu },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u32 = 0x60400010lu },
+			.val = { .u32 = CO_UNSIGNED32_MIN },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 2"),
+			.name = CO_SDEV_STRING("Consumer heartbeat time 2"),
 #endif
 			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -606,15 +593,15 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60600008lu },
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
-			.val = { .u32 = 0x60600008lu },
+			.val = { .u32 = CO_UNSIGNED32_MIN },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 3"),
+			.name = CO_SDEV_STRING("Consumer heartbeat time 3"),
 #endif
 			.subidx = 0x03,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -631,7 +618,7 @@ const struct co_sdev slave_sdev = {
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 4"),
+			.name = CO_SDEV_STRING("Consumer heartbeat time 4"),
 #endif
 			.subidx = 0x04,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -646,28 +633,78 @@ const struct co_sdev slave_sdev = {
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Producer heartbeat time"),
+#endif
+		.idx = 0x1017,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Producer heartbeat time"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x03e8u },
+#endif
+			.val = { .u16 = 0x03e8u },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Identity object"),
+#endif
+		.idx = 0x1018,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 5,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 5"),
+			.name = CO_SDEV_STRING("Vendor-ID"),
 #endif
-			.subidx = 0x05,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000360lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u32 = 0x00000360lu },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 6"),
+			.name = CO_SDEV_STRING("Product code"),
 #endif
-			.subidx = 0x06,
+			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -677,14 +714,14 @@ const struct co_sdev slave_sdev = {
 			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
 			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 7"),
+			.name = CO_SDEV_STRING("Revision number"),
 #endif
-			.subidx = 0x07,
+			.subidx = 0x03,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -694,14 +731,14 @@ const struct co_sdev slave_sdev = {
 			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
 			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 2 mapping information 8"),
+			.name = CO_SDEV_STRING("Serial number"),
 #endif
-			.subidx = 0x08,
+			.subidx = 0x04,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
@@ -711,37 +748,37 @@ const struct co_sdev slave_sdev = {
 			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
 			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Receive PDO 3 mapping parameter"),
+		.name = CO_SDEV_STRING("Receive PDO 1 Communication Parameter"),
 #endif
-		.idx = 0x1602,
+		.idx = 0x1400,
 		.code = CO_OBJECT_RECORD,
-		.nsub = 9,
+		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of mapped objects RPDO 3"),
+			.name = CO_SDEV_STRING("Number of Entries"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = 0x08 },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
 			.def = { .u8 = 0x02 },
 #endif
 			.val = { .u8 = 0x02 },
-			.access = CO_ACCESS_RW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 1"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 1"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -750,137 +787,159 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60400010lu },
+			.def = { .u32 = 0x00000202lu },
 #endif
-			.val = { .u32 = 0x60400010lu },
+			.val = { .u32 = 0x00000202lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 2"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 1"),
 #endif
 			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x607a0020lu },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = 0x607a0020lu },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 3"),
+		.name = CO_SDEV_STRING("Receive PDO 2 Communication Parameter"),
 #endif
-			.subidx = 0x03,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1401,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 4"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 2"),
 #endif
-			.subidx = 0x04,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000302lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000302lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 5"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 2"),
 #endif
-			.subidx = 0x05,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 6"),
+		.name = CO_SDEV_STRING("Receive PDO 3 Communication Parameter"),
 #endif
-			.subidx = 0x06,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1402,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 7"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 3"),
 #endif
-			.subidx = 0x07,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000402lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000402lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("RPDO 3 mapping information 8"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 3"),
 #endif
-			.subidx = 0x08,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Transmit PDO 1 communication parameters"),
+		.name = CO_SDEV_STRING("Receive PDO 4 Communication Parameter"),
 #endif
-		.idx = 0x1800,
+		.idx = 0x1403,
 		.code = CO_OBJECT_RECORD,
 		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
@@ -902,7 +961,7 @@ const struct co_sdev slave_sdev = {
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID use by TPDO 1"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 4"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -911,9 +970,9 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000182lu },
+			.def = { .u32 = 0x00000502lu },
 #endif
-			.val = { .u32 = 0x00000182lu },
+			.val = { .u32 = 0x00000502lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
@@ -921,7 +980,7 @@ const struct co_sdev slave_sdev = {
 				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Transmission type TPDO 1"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 4"),
 #endif
 			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED8,
@@ -930,18 +989,18 @@ const struct co_sdev slave_sdev = {
 			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = CO_UNSIGNED8_MAX },
+			.def = { .u8 = 0x01 },
 #endif
-			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.val = { .u8 = 0x01 },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Transmit PDO 2 communication parameters"),
+		.name = CO_SDEV_STRING("Receive PDO 5 Communication Parameter"),
 #endif
-		.idx = 0x1801,
+		.idx = 0x1404,
 		.code = CO_OBJECT_RECORD,
 		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
@@ -963,7 +1022,7 @@ const struct co_sdev slave_sdev = {
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("COB-ID use by TPDO 2"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 5"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -972,9 +1031,9 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x00000282lu },
+			.def = { .u32 = 0x80000203lu },
 #endif
-			.val = { .u32 = 0x00000282lu },
+			.val = { .u32 = 0x80000203lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
@@ -982,7 +1041,7 @@ const struct co_sdev slave_sdev = {
 				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Transmission type TPDO 2"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 5"),
 #endif
 			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED8,
@@ -1000,31 +1059,31 @@ const struct co_sdev slave_sdev = {
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Transmit PDO 1 mapping parameter"),
+		.name = CO_SDEV_STRING("Receive PDO 6 Communication Parameter"),
 #endif
-		.idx = 0x1a00,
+		.idx = 0x1405,
 		.code = CO_OBJECT_RECORD,
-		.nsub = 9,
+		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of mapped objects TPDO 1"),
+			.name = CO_SDEV_STRING("Number of Entries"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = 0x08 },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x01 },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u8 = 0x01 },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 1"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 6"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -1033,159 +1092,181 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60410010lu },
+			.def = { .u32 = 0x80000303lu },
 #endif
-			.val = { .u32 = 0x60410010lu },
+			.val = { .u32 = 0x80000303lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 2"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 6"),
 #endif
 			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 3"),
+		.name = CO_SDEV_STRING("Receive PDO 7 Communication Parameter"),
 #endif
-			.subidx = 0x03,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1406,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 4"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 7"),
 #endif
-			.subidx = 0x04,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x80000403lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x80000403lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 5"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 7"),
 #endif
-			.subidx = 0x05,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 6"),
+		.name = CO_SDEV_STRING("Receive PDO 8 Communication Parameter"),
 #endif
-			.subidx = 0x06,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1407,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 7"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 8"),
 #endif
-			.subidx = 0x07,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x80000503lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x80000503lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 1 mapping information 8"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 8"),
 #endif
-			.subidx = 0x08,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x01 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u8 = 0x01 },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Transmit PDO 2 mapping parameter"),
+		.name = CO_SDEV_STRING("Receive PDO 9 Communication Parameter"),
 #endif
-		.idx = 0x1a01,
+		.idx = 0x1408,
 		.code = CO_OBJECT_RECORD,
-		.nsub = 9,
+		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of mapped objects TPDO 2"),
+			.name = CO_SDEV_STRING("Number of Entries"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = 0x08 },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
 			.def = { .u8 = 0x02 },
 #endif
 			.val = { .u8 = 0x02 },
-			.access = CO_ACCESS_RW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 1"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 9"),
 #endif
 			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
@@ -1194,268 +1275,14682 @@ const struct co_sdev slave_sdev = {
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60410010lu },
+			.def = { .u32 = 0x80000204lu },
 #endif
-			.val = { .u32 = 0x60410010lu },
+			.val = { .u32 = 0x80000204lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 3 mapping information 2"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 9"),
 #endif
 			.subidx = 0x02,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = 0x60640020lu },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
 #endif
-			.val = { .u32 = 0x60640020lu },
+			.val = { .u8 = CO_UNSIGNED8_MAX },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-		}, {
+		}}
+	}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 3"),
+		.name = CO_SDEV_STRING("Receive PDO 10 Communication Parameter"),
 #endif
-			.subidx = 0x03,
-			.type = CO_DEFTYPE_UNSIGNED32,
+		.idx = 0x1409,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RW,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 4"),
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 10"),
 #endif
-			.subidx = 0x04,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
 			.min = { .u32 = CO_UNSIGNED32_MIN },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x80000304lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x80000304lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 5"),
+			.name = CO_SDEV_STRING("Transmission type RPDO 10"),
 #endif
-			.subidx = 0x05,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 11 Communication Parameter"),
+#endif
+		.idx = 0x140a,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 11"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000404lu },
+#endif
+			.val = { .u32 = 0x80000404lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 11"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 12 Communication Parameter"),
+#endif
+		.idx = 0x140b,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 12"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000504lu },
+#endif
+			.val = { .u32 = 0x80000504lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 12"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 13 Communication Parameter"),
+#endif
+		.idx = 0x140c,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 13"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000205lu },
+#endif
+			.val = { .u32 = 0x80000205lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 13"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 14 Communication Parameter"),
+#endif
+		.idx = 0x140d,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 14"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000305lu },
+#endif
+			.val = { .u32 = 0x80000305lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 14"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 15 Communication Parameter"),
+#endif
+		.idx = 0x140e,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 15"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000405lu },
+#endif
+			.val = { .u32 = 0x80000405lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 15"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 16 Communication Parameter"),
+#endif
+		.idx = 0x140f,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by RPDO 16"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000505lu },
+#endif
+			.val = { .u32 = 0x80000505lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type RPDO 16"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 1 mapping parameter"),
+#endif
+		.idx = 0x1600,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 1"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60400010lu },
+#endif
+			.val = { .u32 = 0x60400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 1 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 2 mapping parameter"),
+#endif
+		.idx = 0x1601,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60400010lu },
+#endif
+			.val = { .u32 = 0x60400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60600008lu },
+#endif
+			.val = { .u32 = 0x60600008lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 2 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 3 mapping parameter"),
+#endif
+		.idx = 0x1602,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60400010lu },
+#endif
+			.val = { .u32 = 0x60400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x607a0020lu },
+#endif
+			.val = { .u32 = 0x607a0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 3 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 4 mapping parameter"),
+#endif
+		.idx = 0x1603,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60ff0020lu },
+#endif
+			.val = { .u32 = 0x60ff0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60b10020lu },
+#endif
+			.val = { .u32 = 0x60b10020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 4 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 5 mapping parameter"),
+#endif
+		.idx = 0x1604,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 5"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68400010lu },
+#endif
+			.val = { .u32 = 0x68400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 5 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 6 mapping parameter"),
+#endif
+		.idx = 0x1605,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 6"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68400010lu },
+#endif
+			.val = { .u32 = 0x68400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68600008lu },
+#endif
+			.val = { .u32 = 0x68600008lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 6 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 7 mapping parameter"),
+#endif
+		.idx = 0x1606,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 7"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68400010lu },
+#endif
+			.val = { .u32 = 0x68400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x687a0020lu },
+#endif
+			.val = { .u32 = 0x687a0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 7 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 8 mapping parameter"),
+#endif
+		.idx = 0x1607,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 8"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68ff0020lu },
+#endif
+			.val = { .u32 = 0x68ff0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68b10020lu },
+#endif
+			.val = { .u32 = 0x68b10020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 8 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 9 mapping parameter"),
+#endif
+		.idx = 0x1608,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 9"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70400010lu },
+#endif
+			.val = { .u32 = 0x70400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 9 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 10 mapping parameter"),
+#endif
+		.idx = 0x1609,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 10"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70400010lu },
+#endif
+			.val = { .u32 = 0x70400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70600008lu },
+#endif
+			.val = { .u32 = 0x70600008lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 10 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 11 mapping parameter"),
+#endif
+		.idx = 0x160a,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 11"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70400010lu },
+#endif
+			.val = { .u32 = 0x70400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x707a0020lu },
+#endif
+			.val = { .u32 = 0x707a0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 11 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 12 mapping parameter"),
+#endif
+		.idx = 0x160b,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 12"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70ff0020lu },
+#endif
+			.val = { .u32 = 0x70ff0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70b10020lu },
+#endif
+			.val = { .u32 = 0x70b10020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 12 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 13 mapping parameter"),
+#endif
+		.idx = 0x160c,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 13"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78400010lu },
+#endif
+			.val = { .u32 = 0x78400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 13 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 14 mapping parameter"),
+#endif
+		.idx = 0x160d,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 14"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78400010lu },
+#endif
+			.val = { .u32 = 0x78400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78600008lu },
+#endif
+			.val = { .u32 = 0x78600008lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 14 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 15 mapping parameter"),
+#endif
+		.idx = 0x160e,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 15"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78400010lu },
+#endif
+			.val = { .u32 = 0x78400010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x787a0020lu },
+#endif
+			.val = { .u32 = 0x787a0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 15 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Receive PDO 16 mapping parameter"),
+#endif
+		.idx = 0x160f,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects RPDO 16"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78ff0020lu },
+#endif
+			.val = { .u32 = 0x78ff0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78b10020lu },
+#endif
+			.val = { .u32 = 0x78b10020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("RPDO 16 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 1 communication parameters"),
+#endif
+		.idx = 0x1800,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000182lu },
+#endif
+			.val = { .u32 = 0x00000182lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 1"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 2 communication parameters"),
+#endif
+		.idx = 0x1801,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 2"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000282lu },
+#endif
+			.val = { .u32 = 0x00000282lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 3 communication parameters"),
+#endif
+		.idx = 0x1802,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 3"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000382lu },
+#endif
+			.val = { .u32 = 0x00000382lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 3"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 4 communication parameters"),
+#endif
+		.idx = 0x1803,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 4"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000482lu },
+#endif
+			.val = { .u32 = 0x00000482lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 4"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 5 communication parameters"),
+#endif
+		.idx = 0x1804,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 5"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000183lu },
+#endif
+			.val = { .u32 = 0x80000183lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 5"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 6 communication parameters"),
+#endif
+		.idx = 0x1805,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 6"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000283lu },
+#endif
+			.val = { .u32 = 0x80000283lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 6"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 7 communication parameters"),
+#endif
+		.idx = 0x1806,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 7"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000383lu },
+#endif
+			.val = { .u32 = 0x80000383lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 7"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 8 communication parameters"),
+#endif
+		.idx = 0x1807,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 8"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000483lu },
+#endif
+			.val = { .u32 = 0x80000483lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 8"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 9 communication parameters"),
+#endif
+		.idx = 0x1808,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 9"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000184lu },
+#endif
+			.val = { .u32 = 0x80000184lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 9"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 10 communication parameters"),
+#endif
+		.idx = 0x1809,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 10"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000284lu },
+#endif
+			.val = { .u32 = 0x80000284lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 10"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 11 communication parameters"),
+#endif
+		.idx = 0x180a,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 11"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000384lu },
+#endif
+			.val = { .u32 = 0x80000384lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 11"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 12 communication parameters"),
+#endif
+		.idx = 0x180b,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 12"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000484lu },
+#endif
+			.val = { .u32 = 0x80000484lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 12"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 13 communication parameters"),
+#endif
+		.idx = 0x180c,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 13"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000185lu },
+#endif
+			.val = { .u32 = 0x80000185lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 13"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 14 communication parameters"),
+#endif
+		.idx = 0x180d,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 14"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000285lu },
+#endif
+			.val = { .u32 = 0x80000285lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 14"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 15 communication parameters"),
+#endif
+		.idx = 0x180e,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 15"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000385lu },
+#endif
+			.val = { .u32 = 0x80000385lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 15"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 16 communication parameters"),
+#endif
+		.idx = 0x180f,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 16"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000485lu },
+#endif
+			.val = { .u32 = 0x80000485lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 16"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MAX },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 17 communication parameters"),
+#endif
+		.idx = 0x1810,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 17"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000682lu },
+#endif
+			.val = { .u32 = 0x00000682lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 17"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 18 communication parameters"),
+#endif
+		.idx = 0x1811,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 18"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000683lu },
+#endif
+			.val = { .u32 = 0x80000683lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 18"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 19 communication parameters"),
+#endif
+		.idx = 0x1812,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 19"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000684lu },
+#endif
+			.val = { .u32 = 0x80000684lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 19"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 20 communication parameters"),
+#endif
+		.idx = 0x1813,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("COB-ID use by TPDO 20"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x80000685lu },
+#endif
+			.val = { .u32 = 0x80000685lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_DEF_NODEID
+				| CO_OBJ_FLAGS_VAL_NODEID
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Transmission type TPDO 20"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 1 mapping parameter"),
+#endif
+		.idx = 0x1a00,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 1"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60410010lu },
+#endif
+			.val = { .u32 = 0x60410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 1 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 2 mapping parameter"),
+#endif
+		.idx = 0x1a01,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60410010lu },
+#endif
+			.val = { .u32 = 0x60410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60640020lu },
+#endif
+			.val = { .u32 = 0x60640020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 2 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 3 mapping parameter"),
+#endif
+		.idx = 0x1a02,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60b90010lu },
+#endif
+			.val = { .u32 = 0x60b90010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60ba0020lu },
+#endif
+			.val = { .u32 = 0x60ba0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 3 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 4 mapping parameter"),
+#endif
+		.idx = 0x1a03,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60bb0020lu },
+#endif
+			.val = { .u32 = 0x60bb0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60bc0020lu },
+#endif
+			.val = { .u32 = 0x60bc0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 4 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 5 mapping parameter"),
+#endif
+		.idx = 0x1a04,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 5"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68410010lu },
+#endif
+			.val = { .u32 = 0x68410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 5 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 6 mapping parameter"),
+#endif
+		.idx = 0x1a05,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 6"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68410010lu },
+#endif
+			.val = { .u32 = 0x68410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68640020lu },
+#endif
+			.val = { .u32 = 0x68640020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 6 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 7 mapping parameter"),
+#endif
+		.idx = 0x1a06,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 7"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68b90010lu },
+#endif
+			.val = { .u32 = 0x68b90010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68ba0020lu },
+#endif
+			.val = { .u32 = 0x68ba0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 7 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 8 mapping parameter"),
+#endif
+		.idx = 0x1a07,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 8"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68bb0020lu },
+#endif
+			.val = { .u32 = 0x68bb0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68bc0020lu },
+#endif
+			.val = { .u32 = 0x68bc0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 8 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 9 mapping parameter"),
+#endif
+		.idx = 0x1a08,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 9"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70410010lu },
+#endif
+			.val = { .u32 = 0x70410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 9 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 10 mapping parameter"),
+#endif
+		.idx = 0x1a09,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 10"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70410010lu },
+#endif
+			.val = { .u32 = 0x70410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70640020lu },
+#endif
+			.val = { .u32 = 0x70640020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 10 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 11 mapping parameter"),
+#endif
+		.idx = 0x1a0a,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 11"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70b90010lu },
+#endif
+			.val = { .u32 = 0x70b90010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70ba0020lu },
+#endif
+			.val = { .u32 = 0x70ba0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 11 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 12 mapping parameter"),
+#endif
+		.idx = 0x1a0b,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 12"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70bb0020lu },
+#endif
+			.val = { .u32 = 0x70bb0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70bc0020lu },
+#endif
+			.val = { .u32 = 0x70bc0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 12 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 13 mapping parameter"),
+#endif
+		.idx = 0x1a0c,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 13"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78410010lu },
+#endif
+			.val = { .u32 = 0x78410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 13 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 14 mapping parameter"),
+#endif
+		.idx = 0x1a0d,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 14"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78410010lu },
+#endif
+			.val = { .u32 = 0x78410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78640020lu },
+#endif
+			.val = { .u32 = 0x78640020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 14 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 15 mapping parameter"),
+#endif
+		.idx = 0x1a0e,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 15"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78b90010lu },
+#endif
+			.val = { .u32 = 0x78b90010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78ba0020lu },
+#endif
+			.val = { .u32 = 0x78ba0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 15 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 16 mapping parameter"),
+#endif
+		.idx = 0x1a0f,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 16"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78bb0020lu },
+#endif
+			.val = { .u32 = 0x78bb0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78bc0020lu },
+#endif
+			.val = { .u32 = 0x78bc0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 16 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 17 mapping parameter"),
+#endif
+		.idx = 0x1a10,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 17"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x60410010lu },
+#endif
+			.val = { .u32 = 0x60410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x606c0020lu },
+#endif
+			.val = { .u32 = 0x606c0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x20030110lu },
+#endif
+			.val = { .u32 = 0x20030110lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 17 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 18 mapping parameter"),
+#endif
+		.idx = 0x1a11,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 18"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x68410010lu },
+#endif
+			.val = { .u32 = 0x68410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x686c0020lu },
+#endif
+			.val = { .u32 = 0x686c0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x28030110lu },
+#endif
+			.val = { .u32 = 0x28030110lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 18 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 19 mapping parameter"),
+#endif
+		.idx = 0x1a12,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 19"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x70410010lu },
+#endif
+			.val = { .u32 = 0x70410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x706c0020lu },
+#endif
+			.val = { .u32 = 0x706c0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x30030110lu },
+#endif
+			.val = { .u32 = 0x30030110lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 19 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Transmit PDO 20 mapping parameter"),
+#endif
+		.idx = 0x1a13,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 9,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of mapped objects TPDO 20"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x08 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x78410010lu },
+#endif
+			.val = { .u32 = 0x78410010lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 2"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x786c0020lu },
+#endif
+			.val = { .u32 = 0x786c0020lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 3"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x38030110lu },
+#endif
+			.val = { .u32 = 0x38030110lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 4"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 5"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 6"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 7"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TPDO 20 mapping information 8"),
+#endif
+			.subidx = 0x08,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("NMT startup"),
+#endif
+		.idx = 0x1f80,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("NMT startup"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = 0x00000004lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+				| CO_OBJ_FLAGS_PARAMETER_VALUE
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("TMC5160 driver configuration"),
+#endif
+		.idx = 0x2000,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 GCONF"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000004lu },
+#endif
+			.val = { .u32 = 0x00000004lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 CHOPCONF"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000100c3lu },
+#endif
+			.val = { .u32 = 0x000100c3lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 IHOLD_IRUN"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00061f0alu },
+#endif
+			.val = { .u32 = 0x00061f0alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPOWERDOWN"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000000fflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000000alu },
+#endif
+			.val = { .u32 = 0x0000000alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPWMTHRS"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000ffffflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000001f4lu },
+#endif
+			.val = { .u32 = 0x000001f4lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing configuration"),
+#endif
+		.idx = 0x2001,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard threshold"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -64 },
+			.max = { .i8 = 63 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 0 },
+#endif
+			.val = { .i8 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reference switch polarity"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x03 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard result"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x03ffu },
+#endif
+			.val = { .u16 = 0x03ffu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Encoder configuration"),
+#endif
+		.idx = 0x2002,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder resolution"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor resolution"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000c800lu },
+#endif
+			.val = { .u32 = 0x0000c800lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder direction inverted"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation buffer status"),
+#endif
+		.idx = 0x2003,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer fill level"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer underruns"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data burst"),
+#endif
+		.idx = 0x2004,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data burst"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Electronic gearing"),
+#endif
+		.idx = 0x2005,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Master position"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear ratio"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 65536l },
+#endif
+			.val = { .i32 = 65536l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear offset"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gearing error"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum gearing error"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Scope configuration"),
+#endif
+		.idx = 0x2100,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 7,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x06 },
+#endif
+			.val = { .u8 = 0x06 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope channel mask"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x7f },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x4f },
+#endif
+			.val = { .u8 = 0x4f },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope sample period"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = 0x0001u },
+			.max = { .u16 = 0x03e8u },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x0001u },
+#endif
+			.val = { .u16 = 0x0001u },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope pre-trigger samples"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope control"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope state"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope captured samples"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Scope capture"),
+#endif
+		.idx = 0x2101,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Scope capture"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("SDO test domain"),
+#endif
+		.idx = 0x2102,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SDO test domain"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("SDO test"),
+#endif
+		.idx = 0x2103,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SDO test upload size"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x00100000lu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00001000lu },
+#endif
+			.val = { .u32 = 0x00001000lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SDO test bytes received"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SDO test pattern errors"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Concise DCF"),
+#endif
+		.idx = 0x2104,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Concise DCF"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Boot time"),
+#endif
+		.idx = 0x2105,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 8,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x07 },
+#endif
+			.val = { .u8 = 0x07 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time clock setup"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time peripherals"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time object dictionary"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time parameter restore"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time NMT start"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time to boot-up message"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Boot time drive configuration"),
+#endif
+			.subidx = 0x07,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("SYNC latency"),
+#endif
+		.idx = 0x2106,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 5,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SYNC latency last"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SYNC latency minimum"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SYNC latency maximum"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("SYNC latency count"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Motion tick"),
+#endif
+		.idx = 0x2107,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 5,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion tick period"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = 0x00fau },
+			.max = { .u16 = 0x07d0u },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x00fau },
+#endif
+			.val = { .u16 = 0x00fau },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion command latency maximum"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion tick duration maximum"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion commands executed"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Heartbeat loss reaction"),
+#endif
+		.idx = 0x2108,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 5,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reaction time last"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reaction time maximum"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Heartbeat losses"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Node-ID of the last loss"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("TMC5160 driver configuration axis 2"),
+#endif
+		.idx = 0x2800,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 GCONF"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000004lu },
+#endif
+			.val = { .u32 = 0x00000004lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 CHOPCONF"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000100c3lu },
+#endif
+			.val = { .u32 = 0x000100c3lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 IHOLD_IRUN"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00061f0alu },
+#endif
+			.val = { .u32 = 0x00061f0alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPOWERDOWN"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000000fflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000000alu },
+#endif
+			.val = { .u32 = 0x0000000alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPWMTHRS"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000ffffflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000001f4lu },
+#endif
+			.val = { .u32 = 0x000001f4lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing configuration axis 2"),
+#endif
+		.idx = 0x2801,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard threshold"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -64 },
+			.max = { .i8 = 63 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 0 },
+#endif
+			.val = { .i8 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reference switch polarity"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x03 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard result"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x03ffu },
+#endif
+			.val = { .u16 = 0x03ffu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Encoder configuration axis 2"),
+#endif
+		.idx = 0x2802,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder resolution"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor resolution"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000c800lu },
+#endif
+			.val = { .u32 = 0x0000c800lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder direction inverted"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation buffer status axis 2"),
+#endif
+		.idx = 0x2803,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer fill level"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer underruns"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data burst axis 2"),
+#endif
+		.idx = 0x2804,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data burst axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Electronic gearing axis 2"),
+#endif
+		.idx = 0x2805,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Master position"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear ratio"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 65536l },
+#endif
+			.val = { .i32 = 65536l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear offset"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gearing error"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum gearing error"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("TMC5160 driver configuration axis 3"),
+#endif
+		.idx = 0x3000,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 GCONF"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000004lu },
+#endif
+			.val = { .u32 = 0x00000004lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 CHOPCONF"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000100c3lu },
+#endif
+			.val = { .u32 = 0x000100c3lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 IHOLD_IRUN"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00061f0alu },
+#endif
+			.val = { .u32 = 0x00061f0alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPOWERDOWN"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000000fflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000000alu },
+#endif
+			.val = { .u32 = 0x0000000alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPWMTHRS"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000ffffflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000001f4lu },
+#endif
+			.val = { .u32 = 0x000001f4lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing configuration axis 3"),
+#endif
+		.idx = 0x3001,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard threshold"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -64 },
+			.max = { .i8 = 63 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 0 },
+#endif
+			.val = { .i8 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reference switch polarity"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x03 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard result"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x03ffu },
+#endif
+			.val = { .u16 = 0x03ffu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Encoder configuration axis 3"),
+#endif
+		.idx = 0x3002,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder resolution"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor resolution"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000c800lu },
+#endif
+			.val = { .u32 = 0x0000c800lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder direction inverted"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation buffer status axis 3"),
+#endif
+		.idx = 0x3003,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer fill level"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer underruns"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data burst axis 3"),
+#endif
+		.idx = 0x3004,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data burst axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Electronic gearing axis 3"),
+#endif
+		.idx = 0x3005,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Master position"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear ratio"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 65536l },
+#endif
+			.val = { .i32 = 65536l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear offset"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gearing error"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum gearing error"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("TMC5160 driver configuration axis 4"),
+#endif
+		.idx = 0x3800,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 GCONF"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000004lu },
+#endif
+			.val = { .u32 = 0x00000004lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 CHOPCONF"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000100c3lu },
+#endif
+			.val = { .u32 = 0x000100c3lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 IHOLD_IRUN"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00061f0alu },
+#endif
+			.val = { .u32 = 0x00061f0alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPOWERDOWN"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000000fflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000000alu },
+#endif
+			.val = { .u32 = 0x0000000alu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("TMC5160 TPWMTHRS"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = 0x000ffffflu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x000001f4lu },
+#endif
+			.val = { .u32 = 0x000001f4lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing configuration axis 4"),
+#endif
+		.idx = 0x3801,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard threshold"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -64 },
+			.max = { .i8 = 63 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 0 },
+#endif
+			.val = { .i8 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Reference switch polarity"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x03 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("StallGuard result"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x03ffu },
+#endif
+			.val = { .u16 = 0x03ffu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Encoder configuration axis 4"),
+#endif
+		.idx = 0x3802,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 4,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x03 },
+#endif
+			.val = { .u8 = 0x03 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder resolution"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor resolution"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000c800lu },
+#endif
+			.val = { .u32 = 0x0000c800lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder direction inverted"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation buffer status axis 4"),
+#endif
+		.idx = 0x3803,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer fill level"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation buffer underruns"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data burst axis 4"),
+#endif
+		.idx = 0x3804,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data burst axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_DOMAIN,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .dom = NULL },
+			.max = { .dom = NULL },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .dom = NULL },
+#endif
+			.val = { .dom = NULL },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Electronic gearing axis 4"),
+#endif
+		.idx = 0x3805,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 6,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x05 },
+#endif
+			.val = { .u8 = 0x05 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Master position"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear ratio"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 65536l },
+#endif
+			.val = { .i32 = 65536l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gear offset"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Gearing error"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum gearing error"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Abort connection option code"),
+#endif
+		.idx = 0x6007,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Abort connection option code"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 1 },
+#endif
+			.val = { .i16 = 1 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Error code"),
+#endif
+		.idx = 0x603f,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Error code"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Control word"),
+#endif
+		.idx = 0x6040,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Control word"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Status word"),
+#endif
+		.idx = 0x6041,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Status word"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop option code"),
+#endif
+		.idx = 0x605a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop option code"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 6 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Halt option code"),
+#endif
+		.idx = 0x605d,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Halt option code"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 1 },
+			.max = { .i16 = 4 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Modes of operation"),
+#endif
+		.idx = 0x6060,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Modes of operation"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Commanded position"),
+#endif
+		.idx = 0x6062,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Commanded position"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Actual motor position"),
+#endif
+		.idx = 0x6064,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual motor position"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWR,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error window"),
+#endif
+		.idx = 0x6065,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error window"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000200lu },
+#endif
+			.val = { .u32 = 0x00000200lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error time out"),
+#endif
+		.idx = 0x6066,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error time out"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x000au },
+#endif
+			.val = { .u16 = 0x000au },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity actual value"),
+#endif
+		.idx = 0x606c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity actual value"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target position"),
+#endif
+		.idx = 0x607a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target position"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Home offset"),
+#endif
+		.idx = 0x607c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Home offset"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target velocity"),
+#endif
+		.idx = 0x6081,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target velocity"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = 500000000l },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target acceleration"),
+#endif
+		.idx = 0x6083,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target acceleration"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target deceleration"),
+#endif
+		.idx = 0x6084,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target deceleration"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop deceleration"),
+#endif
+		.idx = 0x6085,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop deceleration"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0003ff2elu },
+#endif
+			.val = { .u32 = 0x0003ff2elu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Motion profile type"),
+#endif
+		.idx = 0x6086,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion profile type"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 0 },
+#endif
+			.val = { .i16 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Position encoder resolution"),
+#endif
+		.idx = 0x608f,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder increments"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Gear ratio"),
+#endif
+		.idx = 0x6091,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor shaft revolutions"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Feed constant"),
+#endif
+		.idx = 0x6092,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Feed"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing method"),
+#endif
+		.idx = 0x6098,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing method"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = CO_INTEGER8_MIN },
+			.max = { .i8 = CO_INTEGER8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 35 },
+#endif
+			.val = { .i8 = 35 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing speeds"),
+#endif
+		.idx = 0x6099,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (fast)"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 36621l },
+#endif
+			.val = { .i32 = 36621l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (slow)"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 3662l },
+#endif
+			.val = { .i32 = 3662l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing acceleration"),
+#endif
+		.idx = 0x609a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing acceleration"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000ffcclu },
+#endif
+			.val = { .u32 = 0x0000ffcclu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile jerk"),
+#endif
+		.idx = 0x60a4,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile jerk 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity offset"),
+#endif
+		.idx = 0x60b1,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity offset"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe function"),
+#endif
+		.idx = 0x60b8,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe function"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe status"),
+#endif
+		.idx = 0x60b9,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe status"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 positive edge"),
+#endif
+		.idx = 0x60ba,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 positive edge"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 negative edge"),
+#endif
+		.idx = 0x60bb,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 negative edge"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 positive edge"),
+#endif
+		.idx = 0x60bc,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 positive edge"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 negative edge"),
+#endif
+		.idx = 0x60bd,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 negative edge"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data record"),
+#endif
+		.idx = 0x60c1,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data record 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation time period"),
+#endif
+		.idx = 0x60c2,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time period value"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time index"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -6 },
+			.max = { .i8 = -3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = -3 },
+#endif
+			.val = { .i8 = -3 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data configuration"),
+#endif
+		.idx = 0x60c4,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 7,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x06 },
+#endif
+			.val = { .u8 = 0x06 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum buffer size"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual buffer size"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = 0x00000400lu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer organization"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer position"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Size of data record"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x04 },
+			.max = { .u8 = 0x04 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer clear"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error actual value"),
+#endif
+		.idx = 0x60f4,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error actual value"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Target velocity"),
+#endif
+		.idx = 0x60ff,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Target velocity"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Abort connection option code axis 2"),
+#endif
+		.idx = 0x6807,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Abort connection option code axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 1 },
+#endif
+			.val = { .i16 = 1 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Error code axis 2"),
+#endif
+		.idx = 0x683f,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Error code axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Control word axis 2"),
+#endif
+		.idx = 0x6840,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Control word axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Status word axis 2"),
+#endif
+		.idx = 0x6841,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Status word axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop option code axis 2"),
+#endif
+		.idx = 0x685a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop option code axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 6 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Halt option code axis 2"),
+#endif
+		.idx = 0x685d,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Halt option code axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 1 },
+			.max = { .i16 = 4 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Modes of operation axis 2"),
+#endif
+		.idx = 0x6860,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Modes of operation axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Commanded position axis 2"),
+#endif
+		.idx = 0x6862,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Commanded position axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Actual motor position axis 2"),
+#endif
+		.idx = 0x6864,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual motor position axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWR,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error window axis 2"),
+#endif
+		.idx = 0x6865,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error window axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000200lu },
+#endif
+			.val = { .u32 = 0x00000200lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error time out axis 2"),
+#endif
+		.idx = 0x6866,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error time out axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x000au },
+#endif
+			.val = { .u16 = 0x000au },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity actual value axis 2"),
+#endif
+		.idx = 0x686c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity actual value axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target position axis 2"),
+#endif
+		.idx = 0x687a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target position axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Home offset axis 2"),
+#endif
+		.idx = 0x687c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Home offset axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target velocity axis 2"),
+#endif
+		.idx = 0x6881,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target velocity axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = 500000000l },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target acceleration axis 2"),
+#endif
+		.idx = 0x6883,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target acceleration axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target deceleration axis 2"),
+#endif
+		.idx = 0x6884,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target deceleration axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop deceleration axis 2"),
+#endif
+		.idx = 0x6885,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop deceleration axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0003ff2elu },
+#endif
+			.val = { .u32 = 0x0003ff2elu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Motion profile type axis 2"),
+#endif
+		.idx = 0x6886,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion profile type axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 0 },
+#endif
+			.val = { .i16 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Position encoder resolution axis 2"),
+#endif
+		.idx = 0x688f,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder increments"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Gear ratio axis 2"),
+#endif
+		.idx = 0x6891,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor shaft revolutions"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Feed constant axis 2"),
+#endif
+		.idx = 0x6892,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Feed"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing method axis 2"),
+#endif
+		.idx = 0x6898,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing method axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = CO_INTEGER8_MIN },
+			.max = { .i8 = CO_INTEGER8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 35 },
+#endif
+			.val = { .i8 = 35 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing speeds axis 2"),
+#endif
+		.idx = 0x6899,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (fast)"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 36621l },
+#endif
+			.val = { .i32 = 36621l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (slow)"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 3662l },
+#endif
+			.val = { .i32 = 3662l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing acceleration axis 2"),
+#endif
+		.idx = 0x689a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing acceleration axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000ffcclu },
+#endif
+			.val = { .u32 = 0x0000ffcclu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile jerk axis 2"),
+#endif
+		.idx = 0x68a4,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile jerk 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity offset axis 2"),
+#endif
+		.idx = 0x68b1,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity offset axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe function axis 2"),
+#endif
+		.idx = 0x68b8,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe function axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe status axis 2"),
+#endif
+		.idx = 0x68b9,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe status axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 2"),
+#endif
+		.idx = 0x68ba,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 2"),
+#endif
+		.idx = 0x68bb,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 2"),
+#endif
+		.idx = 0x68bc,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 2"),
+#endif
+		.idx = 0x68bd,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data record axis 2"),
+#endif
+		.idx = 0x68c1,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data record 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation time period axis 2"),
+#endif
+		.idx = 0x68c2,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time period value"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time index"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -6 },
+			.max = { .i8 = -3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = -3 },
+#endif
+			.val = { .i8 = -3 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data configuration axis 2"),
+#endif
+		.idx = 0x68c4,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 7,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x06 },
+#endif
+			.val = { .u8 = 0x06 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum buffer size"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual buffer size"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = 0x00000400lu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer organization"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer position"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Size of data record"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x04 },
+			.max = { .u8 = 0x04 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer clear"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error actual value axis 2"),
+#endif
+		.idx = 0x68f4,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error actual value axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Target velocity axis 2"),
+#endif
+		.idx = 0x68ff,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Target velocity axis 2"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Abort connection option code axis 3"),
+#endif
+		.idx = 0x7007,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Abort connection option code axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 1 },
+#endif
+			.val = { .i16 = 1 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Error code axis 3"),
+#endif
+		.idx = 0x703f,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Error code axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Control word axis 3"),
+#endif
+		.idx = 0x7040,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Control word axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Status word axis 3"),
+#endif
+		.idx = 0x7041,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Status word axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop option code axis 3"),
+#endif
+		.idx = 0x705a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop option code axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 6 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Halt option code axis 3"),
+#endif
+		.idx = 0x705d,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Halt option code axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 1 },
+			.max = { .i16 = 4 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Modes of operation axis 3"),
+#endif
+		.idx = 0x7060,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Modes of operation axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Commanded position axis 3"),
+#endif
+		.idx = 0x7062,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Commanded position axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Actual motor position axis 3"),
+#endif
+		.idx = 0x7064,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual motor position axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWR,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error window axis 3"),
+#endif
+		.idx = 0x7065,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error window axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000200lu },
+#endif
+			.val = { .u32 = 0x00000200lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error time out axis 3"),
+#endif
+		.idx = 0x7066,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error time out axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x000au },
+#endif
+			.val = { .u16 = 0x000au },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity actual value axis 3"),
+#endif
+		.idx = 0x706c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity actual value axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target position axis 3"),
+#endif
+		.idx = 0x707a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target position axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Home offset axis 3"),
+#endif
+		.idx = 0x707c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Home offset axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target velocity axis 3"),
+#endif
+		.idx = 0x7081,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target velocity axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = 500000000l },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target acceleration axis 3"),
+#endif
+		.idx = 0x7083,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target acceleration axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target deceleration axis 3"),
+#endif
+		.idx = 0x7084,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target deceleration axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop deceleration axis 3"),
+#endif
+		.idx = 0x7085,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop deceleration axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0003ff2elu },
+#endif
+			.val = { .u32 = 0x0003ff2elu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Motion profile type axis 3"),
+#endif
+		.idx = 0x7086,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion profile type axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 0 },
+#endif
+			.val = { .i16 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Position encoder resolution axis 3"),
+#endif
+		.idx = 0x708f,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder increments"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Gear ratio axis 3"),
+#endif
+		.idx = 0x7091,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motor shaft revolutions"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Feed constant axis 3"),
+#endif
+		.idx = 0x7092,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Feed"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing method axis 3"),
+#endif
+		.idx = 0x7098,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing method axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = CO_INTEGER8_MIN },
+			.max = { .i8 = CO_INTEGER8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = 35 },
+#endif
+			.val = { .i8 = 35 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing speeds axis 3"),
+#endif
+		.idx = 0x7099,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (fast)"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 36621l },
+#endif
+			.val = { .i32 = 36621l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (slow)"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 3662l },
+#endif
+			.val = { .i32 = 3662l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing acceleration axis 3"),
+#endif
+		.idx = 0x709a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing acceleration axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0000ffcclu },
+#endif
+			.val = { .u32 = 0x0000ffcclu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile jerk axis 3"),
+#endif
+		.idx = 0x70a4,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile jerk 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity offset axis 3"),
+#endif
+		.idx = 0x70b1,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity offset axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe function axis 3"),
+#endif
+		.idx = 0x70b8,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe function axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe status axis 3"),
+#endif
+		.idx = 0x70b9,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe status axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 3"),
+#endif
+		.idx = 0x70ba,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 3"),
+#endif
+		.idx = 0x70bb,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 3"),
+#endif
+		.idx = 0x70bc,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 3"),
+#endif
+		.idx = 0x70bd,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data record axis 3"),
+#endif
+		.idx = 0x70c1,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation data record 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation time period axis 3"),
+#endif
+		.idx = 0x70c2,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time period value"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Interpolation time index"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i8 = -6 },
+			.max = { .i8 = -3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i8 = -3 },
+#endif
+			.val = { .i8 = -3 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Interpolation data configuration axis 3"),
+#endif
+		.idx = 0x70c4,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 7,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x06 },
+#endif
+			.val = { .u8 = 0x06 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Maximum buffer size"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual buffer size"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = 0x00000400lu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer organization"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer position"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Size of data record"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x04 },
+			.max = { .u8 = 0x04 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer clear"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error actual value axis 3"),
+#endif
+		.idx = 0x70f4,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error actual value axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Target velocity axis 3"),
+#endif
+		.idx = 0x70ff,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Target velocity axis 3"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Abort connection option code axis 4"),
+#endif
+		.idx = 0x7807,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Abort connection option code axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 1 },
+#endif
+			.val = { .i16 = 1 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Error code axis 4"),
+#endif
+		.idx = 0x783f,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Error code axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Control word axis 4"),
+#endif
+		.idx = 0x7840,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Control word axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Status word axis 4"),
+#endif
+		.idx = 0x7841,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Status word axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop option code axis 4"),
+#endif
+		.idx = 0x785a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop option code axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 6 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Halt option code axis 4"),
+#endif
+		.idx = 0x785d,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Halt option code axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 1 },
+			.max = { .i16 = 4 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 2 },
+#endif
+			.val = { .i16 = 2 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Modes of operation axis 4"),
+#endif
+		.idx = 0x7860,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Modes of operation axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Commanded position axis 4"),
+#endif
+		.idx = 0x7862,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Commanded position axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Actual motor position axis 4"),
+#endif
+		.idx = 0x7864,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Actual motor position axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWR,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error window axis 4"),
+#endif
+		.idx = 0x7865,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error window axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000200lu },
+#endif
+			.val = { .u32 = 0x00000200lu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error time out axis 4"),
+#endif
+		.idx = 0x7866,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error time out axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = 0x000au },
+#endif
+			.val = { .u16 = 0x000au },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Velocity actual value axis 4"),
+#endif
+		.idx = 0x786c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Velocity actual value axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target position axis 4"),
+#endif
+		.idx = 0x787a,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target position axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Home offset axis 4"),
+#endif
+		.idx = 0x787c,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Home offset axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target velocity axis 4"),
+#endif
+		.idx = 0x7881,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target velocity axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = 500000000l },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 0l },
+#endif
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target acceleration axis 4"),
+#endif
+		.idx = 0x7883,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target acceleration axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile target deceleration axis 4"),
+#endif
+		.idx = 0x7884,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile target deceleration axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
 #endif
 			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Quick stop deceleration axis 4"),
+#endif
+		.idx = 0x7885,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Quick stop deceleration axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x0003ff2elu },
+#endif
+			.val = { .u32 = 0x0003ff2elu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Motion profile type axis 4"),
+#endif
+		.idx = 0x7886,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Motion profile type axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_INTEGER16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i16 = 0 },
+			.max = { .i16 = 3 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i16 = 0 },
+#endif
+			.val = { .i16 = 0 },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Position encoder resolution axis 4"),
+#endif
+		.idx = 0x788f,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Encoder increments"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 6"),
+			.name = CO_SDEV_STRING("Motor revolutions"),
 #endif
-			.subidx = 0x06,
+			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.min = { .u32 = 0x00000001lu },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Gear ratio axis 4"),
+#endif
+		.idx = 0x7891,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 7"),
+			.name = CO_SDEV_STRING("Motor shaft revolutions"),
 #endif
-			.subidx = 0x07,
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.min = { .u32 = 0x00000001lu },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("TPDO 2 mapping information 8"),
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
 #endif
-			.subidx = 0x08,
+			.subidx = 0x02,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.min = { .u32 = 0x00000001lu },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("NMT startup"),
+		.name = CO_SDEV_STRING("Feed constant axis 4"),
 #endif
-		.idx = 0x1f80,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
+		.idx = 0x7892,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("NMT startup"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Feed"),
+#endif
+			.subidx = 0x01,
 			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.min = { .u32 = 0x00000001lu },
 			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u32 = 0x00000001lu },
 #endif
-			.val = { .u32 = 0x00000004lu },
+			.val = { .u32 = 0x00000001lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Driving shaft revolutions"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000001lu },
+#endif
+			.val = { .u32 = 0x00000001lu },
 			.access = CO_ACCESS_RW,
 			.pdo_mapping = 0,
 			.flags = 0
-				| CO_OBJ_FLAGS_PARAMETER_VALUE
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Control word"),
+		.name = CO_SDEV_STRING("Homing method axis 4"),
 #endif
-		.idx = 0x6040,
+		.idx = 0x7898,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Control word"),
+			.name = CO_SDEV_STRING("Homing method axis 4"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED16,
+			.type = CO_DEFTYPE_INTEGER8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u16 = CO_UNSIGNED16_MIN },
-			.max = { .u16 = CO_UNSIGNED16_MAX },
+			.min = { .i8 = CO_INTEGER8_MIN },
+			.max = { .i8 = CO_INTEGER8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u16 = CO_UNSIGNED16_MIN },
+			.def = { .i8 = 35 },
 #endif
-			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.val = { .i8 = 35 },
 			.access = CO_ACCESS_RWW,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Status word"),
+		.name = CO_SDEV_STRING("Homing speeds axis 4"),
 #endif
-		.idx = 0x6041,
+		.idx = 0x7899,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 3,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Number of Entries"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x02 },
+			.max = { .u8 = 0x02 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x02 },
+#endif
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (fast)"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 36621l },
+#endif
+			.val = { .i32 = 36621l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Homing velocity (slow)"),
+#endif
+			.subidx = 0x02,
+			.type = CO_DEFTYPE_INTEGER32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .i32 = 0l },
+			.max = { .i32 = CO_INTEGER32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .i32 = 3662l },
+#endif
+			.val = { .i32 = 3662l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Homing acceleration axis 4"),
+#endif
+		.idx = 0x789a,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Status word"),
+			.name = CO_SDEV_STRING("Homing acceleration axis 4"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED16,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u16 = CO_UNSIGNED16_MIN },
-			.max = { .u16 = CO_UNSIGNED16_MAX },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u16 = CO_UNSIGNED16_MIN },
+			.def = { .u32 = 0x0000ffcclu },
 #endif
-			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.val = { .u32 = 0x0000ffcclu },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Profile jerk axis 4"),
+#endif
+		.idx = 0x78a4,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
 			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Profile jerk 1"),
+#endif
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = CO_UNSIGNED32_MIN },
+#endif
+			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.access = CO_ACCESS_RWW,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Halt option code"),
+		.name = CO_SDEV_STRING("Velocity offset axis 4"),
 #endif
-		.idx = 0x605d,
+		.idx = 0x78b1,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Halt option code"),
+			.name = CO_SDEV_STRING("Velocity offset axis 4"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_INTEGER16,
+			.type = CO_DEFTYPE_INTEGER32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i16 = CO_INTEGER16_MIN },
-			.max = { .i16 = CO_INTEGER16_MAX },
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .i16 = 0 },
+			.def = { .i32 = 0l },
 #endif
-			.val = { .i16 = 0 },
+			.val = { .i32 = 0l },
+			.access = CO_ACCESS_RWW,
+			.pdo_mapping = 1,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Touch probe function axis 4"),
+#endif
+		.idx = 0x78b8,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Touch probe function axis 4"),
+#endif
+			.subidx = 0x00,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
 			.access = CO_ACCESS_RWW,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Modes of operation"),
+		.name = CO_SDEV_STRING("Touch probe status axis 4"),
 #endif
-		.idx = 0x6060,
+		.idx = 0x78b9,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Modes of operation"),
+			.name = CO_SDEV_STRING("Touch probe status axis 4"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED8,
+			.type = CO_DEFTYPE_UNSIGNED16,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = CO_UNSIGNED8_MIN },
-			.max = { .u8 = CO_UNSIGNED8_MAX },
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = CO_UNSIGNED8_MIN },
+			.def = { .u16 = CO_UNSIGNED16_MIN },
 #endif
-			.val = { .u8 = CO_UNSIGNED8_MIN },
-			.access = CO_ACCESS_RWW,
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Commanded position"),
+		.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 4"),
 #endif
-		.idx = 0x6062,
+		.idx = 0x78ba,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Commanded position"),
+			.name = CO_SDEV_STRING("Touch probe 1 positive edge axis 4"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_INTEGER32,
@@ -1473,14 +15968,14 @@ const struct co_sdev slave_sdev = {
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Actual motor position"),
+		.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 4"),
 #endif
-		.idx = 0x6064,
+		.idx = 0x78bb,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Actual motor position"),
+			.name = CO_SDEV_STRING("Touch probe 1 negative edge axis 4"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_INTEGER32,
@@ -1492,20 +15987,20 @@ const struct co_sdev slave_sdev = {
 			.def = { .i32 = 0l },
 #endif
 			.val = { .i32 = 0l },
-			.access = CO_ACCESS_RWR,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Profile target position"),
+		.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 4"),
 #endif
-		.idx = 0x607a,
+		.idx = 0x78bc,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Profile target position"),
+			.name = CO_SDEV_STRING("Touch probe 2 positive edge axis 4"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_INTEGER32,
@@ -1517,215 +16012,309 @@ const struct co_sdev slave_sdev = {
 			.def = { .i32 = 0l },
 #endif
 			.val = { .i32 = 0l },
-			.access = CO_ACCESS_RWW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Profile target velocity"),
+		.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 4"),
 #endif
-		.idx = 0x6081,
+		.idx = 0x78bd,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Profile target velocity"),
+			.name = CO_SDEV_STRING("Touch probe 2 negative edge axis 4"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_INTEGER32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i32 = 0l },
-			.max = { .i32 = 500000000l },
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
 			.def = { .i32 = 0l },
 #endif
 			.val = { .i32 = 0l },
-			.access = CO_ACCESS_RWW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Profile target acceleration"),
+		.name = CO_SDEV_STRING("Interpolation data record axis 4"),
 #endif
-		.idx = 0x6083,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
+		.idx = 0x78c1,
+		.code = CO_OBJECT_ARRAY,
+		.nsub = 2,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Profile target acceleration"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = 0x01 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .u8 = 0x01 },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
-			.access = CO_ACCESS_RWW,
-			.pdo_mapping = 1,
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
-#if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Profile target deceleration"),
-#endif
-		.idx = 0x6084,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
-		.subs = (const struct co_ssub[]){{
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Profile target deceleration"),
+			.name = CO_SDEV_STRING("Interpolation data record 1"),
 #endif
-			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_INTEGER32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .i32 = 0l },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .i32 = 0l },
 			.access = CO_ACCESS_RWW,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Motion profile type"),
+		.name = CO_SDEV_STRING("Interpolation time period axis 4"),
 #endif
-		.idx = 0x6086,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
+		.idx = 0x78c2,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 3,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Motion profile type"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_INTEGER16,
+			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i16 = CO_INTEGER16_MIN },
-			.max = { .i16 = CO_INTEGER16_MAX },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .i16 = 0 },
+			.def = { .u8 = 0x02 },
 #endif
-			.val = { .i16 = 0 },
-			.access = CO_ACCESS_RWW,
-			.pdo_mapping = 1,
+			.val = { .u8 = 0x02 },
+			.access = CO_ACCESS_CONST,
+			.pdo_mapping = 0,
 			.flags = 0
-		}}
-	}, {
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Homing method"),
+			.name = CO_SDEV_STRING("Interpolation time period value"),
 #endif
-		.idx = 0x6098,
-		.code = CO_OBJECT_VAR,
-		.nsub = 1,
-		.subs = (const struct co_ssub[]){{
+			.subidx = 0x01,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x01 },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Homing method"),
+			.name = CO_SDEV_STRING("Interpolation time index"),
 #endif
-			.subidx = 0x00,
+			.subidx = 0x02,
 			.type = CO_DEFTYPE_INTEGER8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i8 = CO_INTEGER8_MIN },
-			.max = { .i8 = CO_INTEGER8_MAX },
+			.min = { .i8 = -6 },
+			.max = { .i8 = -3 },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .i8 = 0 },
+			.def = { .i8 = -3 },
 #endif
-			.val = { .i8 = 0 },
-			.access = CO_ACCESS_RWW,
-			.pdo_mapping = 1,
+			.val = { .i8 = -3 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Homing speeds"),
+		.name = CO_SDEV_STRING("Interpolation data configuration axis 4"),
 #endif
-		.idx = 0x6099,
-		.code = CO_OBJECT_ARRAY,
-		.nsub = 3,
+		.idx = 0x78c4,
+		.code = CO_OBJECT_RECORD,
+		.nsub = 7,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Number of Entries"),
+			.name = CO_SDEV_STRING("Highest sub-index supported"),
 #endif
 			.subidx = 0x00,
 			.type = CO_DEFTYPE_UNSIGNED8,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u8 = 0x02 },
-			.max = { .u8 = 0x02 },
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u8 = 0x02 },
+			.def = { .u8 = 0x06 },
 #endif
-			.val = { .u8 = 0x02 },
-			.access = CO_ACCESS_RO,
+			.val = { .u8 = 0x06 },
+			.access = CO_ACCESS_CONST,
 			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Homing velocity (fast)"),
+			.name = CO_SDEV_STRING("Maximum buffer size"),
 #endif
 			.subidx = 0x01,
-			.type = CO_DEFTYPE_INTEGER32,
+			.type = CO_DEFTYPE_UNSIGNED32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i32 = 0l },
-			.max = { .i32 = 500000000l },
+			.min = { .u32 = CO_UNSIGNED32_MIN },
+			.max = { .u32 = CO_UNSIGNED32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .i32 = 0l },
+			.def = { .u32 = 0x00000400lu },
 #endif
-			.val = { .i32 = 0l },
-			.access = CO_ACCESS_RWW,
-			.pdo_mapping = 1,
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RO,
+			.pdo_mapping = 0,
 			.flags = 0
 		}, {
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Homing velocity (slow)"),
+			.name = CO_SDEV_STRING("Actual buffer size"),
 #endif
 			.subidx = 0x02,
+			.type = CO_DEFTYPE_UNSIGNED32,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u32 = 0x00000001lu },
+			.max = { .u32 = 0x00000400lu },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u32 = 0x00000400lu },
+#endif
+			.val = { .u32 = 0x00000400lu },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer organization"),
+#endif
+			.subidx = 0x03,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = CO_UNSIGNED8_MIN },
+#endif
+			.val = { .u8 = CO_UNSIGNED8_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer position"),
+#endif
+			.subidx = 0x04,
+			.type = CO_DEFTYPE_UNSIGNED16,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u16 = CO_UNSIGNED16_MIN },
+			.max = { .u16 = CO_UNSIGNED16_MAX },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u16 = CO_UNSIGNED16_MIN },
+#endif
+			.val = { .u16 = CO_UNSIGNED16_MIN },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Size of data record"),
+#endif
+			.subidx = 0x05,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = 0x04 },
+			.max = { .u8 = 0x04 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x04 },
+#endif
+			.val = { .u8 = 0x04 },
+			.access = CO_ACCESS_RW,
+			.pdo_mapping = 0,
+			.flags = 0
+		}, {
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Buffer clear"),
+#endif
+			.subidx = 0x06,
+			.type = CO_DEFTYPE_UNSIGNED8,
+#if !LELY_NO_CO_OBJ_LIMITS
+			.min = { .u8 = CO_UNSIGNED8_MIN },
+			.max = { .u8 = 0x01 },
+#endif
+#if !LELY_NO_CO_OBJ_DEFAULT
+			.def = { .u8 = 0x01 },
+#endif
+			.val = { .u8 = 0x01 },
+			.access = CO_ACCESS_WO,
+			.pdo_mapping = 0,
+			.flags = 0
+		}}
+	}, {
+#if !LELY_NO_CO_OBJ_NAME
+		.name = CO_SDEV_STRING("Following error actual value axis 4"),
+#endif
+		.idx = 0x78f4,
+		.code = CO_OBJECT_VAR,
+		.nsub = 1,
+		.subs = (const struct co_ssub[]){{
+#if !LELY_NO_CO_OBJ_NAME
+			.name = CO_SDEV_STRING("Following error actual value axis 4"),
+#endif
+			.subidx = 0x00,
 			.type = CO_DEFTYPE_INTEGER32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .i32 = 0l },
-			.max = { .i32 = 500000000l },
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
 			.def = { .i32 = 0l },
 #endif
 			.val = { .i32 = 0l },
-			.access = CO_ACCESS_RWW,
+			.access = CO_ACCESS_RO,
 			.pdo_mapping = 1,
 			.flags = 0
 		}}
 	}, {
 #if !LELY_NO_CO_OBJ_NAME
-		.name = CO_SDEV_STRING("Homing acceleration"),
+		.name = CO_SDEV_STRING("Target velocity axis 4"),
 #endif
-		.idx = 0x609a,
+		.idx = 0x78ff,
 		.code = CO_OBJECT_VAR,
 		.nsub = 1,
 		.subs = (const struct co_ssub[]){{
 #if !LELY_NO_CO_OBJ_NAME
-			.name = CO_SDEV_STRING("Homing acceleration"),
+			.name = CO_SDEV_STRING("Target velocity axis 4"),
 #endif
 			.subidx = 0x00,
-			.type = CO_DEFTYPE_UNSIGNED32,
+			.type = CO_DEFTYPE_INTEGER32,
 #if !LELY_NO_CO_OBJ_LIMITS
-			.min = { .u32 = CO_UNSIGNED32_MIN },
-			.max = { .u32 = CO_UNSIGNED32_MAX },
+			.min = { .i32 = CO_INTEGER32_MIN },
+			.max = { .i32 = CO_INTEGER32_MAX },
 #endif
 #if !LELY_NO_CO_OBJ_DEFAULT
-			.def = { .u32 = CO_UNSIGNED32_MIN },
+			.def = { .i32 = 0l },
 #endif
-			.val = { .u32 = CO_UNSIGNED32_MIN },
+			.val = { .i32 = 0l },
 			.access = CO_ACCESS_RWW,
 			.pdo_mapping = 1,
 			.flags = 0
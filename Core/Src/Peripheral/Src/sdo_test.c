@@ -0,0 +1,86 @@
+#include "sdo_test.h"
+
+#include <lely/co/obj.h>
+#include <lely/co/sdo.h>
+#include <stdint.h>
+
+#define SDO_TEST_CHUNK_SIZE     256
+
+static co_dev_t *sdo_test_dev = NULL;
+
+static uint8_t sdo_test_chunk[SDO_TEST_CHUNK_SIZE];
+static uint32_t sdo_test_rx_bytes = 0;
+static uint32_t sdo_test_rx_errors = 0;
+
+static co_unsigned32_t on_read_domain(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_domain(co_sub_t *sub, struct co_sdo_req *req, void *data);
+
+static inline uint8_t sdo_test_pattern(uint32_t offset) {
+    return (uint8_t)(offset * 7 + (offset >> 8));
+}
+
+void sdo_test_init(co_dev_t *dev) {
+    sdo_test_dev = dev;
+
+    co_sub_t *sub = co_dev_find_sub(dev, SDO_TEST_OBJ_DOMAIN, 0x00);
+    co_sub_set_up_ind(sub, &on_read_domain, NULL);
+    co_sub_set_dn_ind(sub, &on_write_domain, NULL);
+}
+
+/**
+ * @brief SDO upload of 0x2102. Lely calls this again for the next chunk
+ *        (with req->offset advanced) each time the previous one is sent.
+ */
+static co_unsigned32_t on_read_domain(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    (void)data;
+
+    if (co_sdo_req_first(req)) {
+        req->size = co_dev_get_val_u32(sdo_test_dev, SDO_TEST_OBJ_CONFIG, 0x01);
+    }
+
+    size_t n = req->size - req->offset;
+    if (n > SDO_TEST_CHUNK_SIZE) {
+        n = SDO_TEST_CHUNK_SIZE;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        sdo_test_chunk[i] = sdo_test_pattern(req->offset + i);
+    }
+
+    req->buf = sdo_test_chunk;
+    req->nbyt = n;
+    return 0;
+}
+
+/**
+ * @brief SDO download to 0x2102. Each call carries the bytes received since
+ *        the previous one; they are verified and dropped.
+ */
+static co_unsigned32_t on_write_domain(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    (void)data;
+
+    if (co_sdo_req_first(req)) {
+        sdo_test_rx_bytes = 0;
+        sdo_test_rx_errors = 0;
+    }
+
+    const uint8_t *bytes = req->buf;
+    for (size_t i = 0; i < req->nbyt; i++) {
+        if (bytes[i] != sdo_test_pattern(req->offset + i)) {
+            sdo_test_rx_errors++;
+        }
+    }
+    sdo_test_rx_bytes += req->nbyt;
+
+    if (co_sdo_req_last(req)) {
+        co_dev_set_val_u32(sdo_test_dev, SDO_TEST_OBJ_CONFIG, 0x02, sdo_test_rx_bytes);
+        co_dev_set_val_u32(sdo_test_dev, SDO_TEST_OBJ_CONFIG, 0x03, sdo_test_rx_errors);
+        if (sdo_test_rx_errors) {
+            return CO_SDO_AC_DATA;
+        }
+    }
+
+    return 0;
+}
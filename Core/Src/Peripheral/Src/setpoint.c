@@ -0,0 +1,36 @@
+#include "setpoint.h"
+
+_Static_assert((SETPOINT_FIFO_DEPTH & (SETPOINT_FIFO_DEPTH - 1)) == 0, "SETPOINT_FIFO_DEPTH must be a power of two");
+
+void setpoint_clear(struct setpoint_fifo *fifo) {
+    fifo->tail = fifo->head;
+}
+
+bool setpoint_push(struct setpoint_fifo *fifo, const struct setpoint *sp) {
+    if (setpoint_is_full(fifo)) {
+        return false;
+    }
+    fifo->entries[fifo->head % SETPOINT_FIFO_DEPTH] = *sp;
+    fifo->head++;
+    return true;
+}
+
+const struct setpoint *setpoint_peek(const struct setpoint_fifo *fifo) {
+    if (fifo->head == fifo->tail) {
+        return NULL;
+    }
+    return &fifo->entries[fifo->tail % SETPOINT_FIFO_DEPTH];
+}
+
+bool setpoint_pop(struct setpoint_fifo *fifo, struct setpoint *sp) {
+    if (fifo->head == fifo->tail) {
+        return false;
+    }
+    *sp = fifo->entries[fifo->tail % SETPOINT_FIFO_DEPTH];
+    fifo->tail++;
+    return true;
+}
+
+size_t setpoint_count(const struct setpoint_fifo *fifo) {
+    return fifo->head - fifo->tail;
+}
@@ -2,10 +2,33 @@
 #include "rcc.h"
 #include "gpio.h"
 
+// Chip select of each TMC5160, active low
+struct spi1_cs_pin {
+    GPIO_TypeDef *port;
+    uint8_t pin;
+};
+
+// DMA2 requests of SPI1, both on channel 3
+#define SPI1_DMA_RX         DMA2_Stream0
+#define SPI1_DMA_TX         DMA2_Stream3
+#define SPI1_DMA_CHANNEL    (3u << DMA_SxCR_CHSEL_Pos)
+#define SPI1_DMA_FLAGS      (DMA_LIFCR_CTCIF0 | DMA_LIFCR_CHTIF0 | DMA_LIFCR_CTEIF0 | DMA_LIFCR_CDMEIF0 | \
+                             DMA_LIFCR_CFEIF0 | DMA_LIFCR_CTCIF3 | DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTEIF3 | \
+                             DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3)
+
+static const struct spi1_cs_pin spi1_cs_pins[SPI1_CS_COUNT] = {
+    { GPIOA, 4 }, // Axis 1
+    { GPIOE, 7 }, // Axis 2
+    { GPIOE, 8 }, // Axis 3
+    { GPIOE, 9 }, // Axis 4
+};
+
 void spi1_init(void) {
     // 1. Enable peripheral clocks
     rcc_gpio_port_clock_enable(GPIOA);
+    rcc_gpio_port_clock_enable(GPIOE);
     RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
 
     // 2. Configure GPIO pins using our GPIO driver
     // AF5 is the alternate function for SPI1 on STM32F407
@@ -13,9 +36,11 @@ void spi1_init(void) {
     gpio_configure_alternate_function(GPIOA, 6, 5); // PA6 (MISO)
     gpio_configure_alternate_function(GPIOA, 7, 5); // PA7 (MOSI)
 
-    // 3. Configure CSN pin (PA4) as a standard output
-    gpio_configure_output_pin(GPIOA, 4);
-    spi1_cs_deselect(); // Initialize CS pin to high (deselected)
+    // 3. Configure the CSN pins (PA4, PE7-PE9) as standard outputs
+    for (uint8_t cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        gpio_configure_output_pin(spi1_cs_pins[cs].port, spi1_cs_pins[cs].pin);
+        spi1_cs_deselect(cs); // Initialize CS pin to high (deselected)
+    }
 
     // 4. Configure the SPI1 peripheral
     SPI1->CR1 &= ~SPI_CR1_SPE; // Ensure peripheral is disabled
@@ -38,16 +63,16 @@ void spi1_init(void) {
     SPI1->CR1 |= SPI_CR1_SPE;
 }
 
-void spi1_cs_select(void) {
-    // Atomically set PA4 low using the Bit Set/Reset Register (BSRR)
+void spi1_cs_select(uint8_t cs) {
+    // Atomically set the pin low using the Bit Set/Reset Register (BSRR)
     // The upper 16 bits of BSRR are for resetting bits
-    GPIOA->BSRR = (1 << (4 + 16));
+    spi1_cs_pins[cs].port->BSRR = (1u << (spi1_cs_pins[cs].pin + 16));
 }
 
-void spi1_cs_deselect(void) {
-    // Atomically set PA4 high using the Bit Set/Reset Register (BSRR)
+void spi1_cs_deselect(uint8_t cs) {
+    // Atomically set the pin high using the Bit Set/Reset Register (BSRR)
     // The lower 16 bits of BSRR are for setting bits
-    GPIOA->BSRR = (1 << 4);
+    spi1_cs_pins[cs].port->BSRR = (1u << spi1_cs_pins[cs].pin);
 }
 
 uint8_t spi1_transfer(uint8_t data) {
@@ -64,3 +89,52 @@ uint8_t spi1_transfer(uint8_t data) {
     // This also clears the RXNE flag
     return SPI1->DR;
 }
+
+void spi1_transfer_dma(uint8_t cs, const uint8_t *tx, uint8_t *rx, size_t n) {
+    // Both streams must be idle before they can be set up
+    SPI1_DMA_RX->CR = 0;
+    SPI1_DMA_TX->CR = 0;
+    while ((SPI1_DMA_RX->CR | SPI1_DMA_TX->CR) & DMA_SxCR_EN);
+    DMA2->LIFCR = SPI1_DMA_FLAGS;
+
+    // A byte left in DR would be taken as the first one received
+    while (SPI1->SR & SPI_SR_RXNE) {
+        (void)SPI1->DR;
+    }
+
+    SPI1_DMA_RX->PAR = (uint32_t)(uintptr_t)&SPI1->DR;
+    SPI1_DMA_RX->M0AR = (uint32_t)(uintptr_t)rx;
+    SPI1_DMA_RX->NDTR = n;
+    SPI1_DMA_RX->CR = SPI1_DMA_CHANNEL | DMA_SxCR_MINC; // Peripheral to memory, bytes
+
+    SPI1_DMA_TX->PAR = (uint32_t)(uintptr_t)&SPI1->DR;
+    SPI1_DMA_TX->M0AR = (uint32_t)(uintptr_t)tx;
+    SPI1_DMA_TX->NDTR = n;
+    SPI1_DMA_TX->CR = SPI1_DMA_CHANNEL | DMA_SxCR_MINC | DMA_SxCR_DIR_0; // Memory to peripheral
+
+    spi1_cs_select(cs);
+
+    // RX first, so no received byte can be missed; TXE then starts the frame
+    SPI1_DMA_RX->CR |= DMA_SxCR_EN;
+    SPI1_DMA_TX->CR |= DMA_SxCR_EN;
+    SPI1->CR2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+
+    // The last byte received means the last one was clocked out as well
+    while (!(DMA2->LISR & DMA_LISR_TCIF0));
+    while (SPI1->SR & SPI_SR_BSY);
+
+    spi1_cs_deselect(cs);
+    SPI1->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+}
+
+uint32_t spi1_lock(void) {
+    uint32_t key = __get_BASEPRI();
+
+    // BASEPRI_MAX only ever raises the mask, so nested locks keep the outer one
+    __set_BASEPRI_MAX(SPI1_LOCK_PRIORITY << (8 - __NVIC_PRIO_BITS));
+    return key;
+}
+
+void spi1_unlock(uint32_t key) {
+    __set_BASEPRI(key);
+}
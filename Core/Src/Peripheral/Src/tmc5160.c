@@ -2,101 +2,222 @@
 #include "spi.h" // We depend on the SPI driver for communication
 #include <stdbool.h>
 
-void tmc5160_write_register(uint8_t address, int32_t value) {
-    uint8_t address_byte = address | 0x80;
-    volatile uint8_t dummy_read; // Used to clear the RXNE flag
+// Most TMC5160s one batch call serves
+#define TMC5160_BATCH_MAX   SPI1_CS_COUNT
 
-    spi1_cs_select();
+// Daisy chain: one frame of 40 bits per chained TMC5160 per chip select cycle
+#define TMC5160_CHAIN_LENGTH    SPI1_DAISY_CHAIN_LENGTH
+#define TMC5160_DATAGRAM_SIZE   5
+#define TMC5160_NOP             TMC5160_GCONF // Read access for the chips a frame does not address
 
-    // Send address byte and clear the buffer
-    dummy_read = spi1_transfer(address_byte);
+_Static_assert(TMC5160_CHAIN_LENGTH <= TMC5160_BATCH_MAX, "More chained TMC5160s than axes");
 
-    // Send the 32-bit value, MSB first, and clear the buffer each time
-    dummy_read = spi1_transfer((value >> 24) & 0xFF);
-    dummy_read = spi1_transfer((value >> 16) & 0xFF);
-    dummy_read = spi1_transfer((value >> 8)  & 0xFF);
-    dummy_read = spi1_transfer(value & 0xFF);
+#if TMC5160_CHAIN_LENGTH
 
-    (void)dummy_read; // Suppress "unused variable" warning
+static uint8_t tmc5160_chain_tx[TMC5160_DATAGRAM_SIZE * TMC5160_CHAIN_LENGTH];
+static uint8_t tmc5160_chain_rx[TMC5160_DATAGRAM_SIZE * TMC5160_CHAIN_LENGTH];
 
-    spi1_cs_deselect();
+/**
+ * @brief Datagram slot of a chained TMC5160 in the frame. The bits sent
+ *        first are shifted on to the end of the chain, and its reply
+ *        arrives first.
+ */
+static uint8_t *tmc5160_chain_slot(uint8_t *frame, uint8_t position) {
+    return &frame[TMC5160_DATAGRAM_SIZE * (TMC5160_CHAIN_LENGTH - 1 - position)];
 }
 
-int32_t tmc5160_read_register(uint8_t address) {
-    uint8_t address_byte = address & 0x7F;
+/**
+ * @brief Sends the same address byte with one value per chip to 'n' chips
+ *        and returns the data requested by their previous datagrams.
+ *
+ * All chained chips get their datagram in one DMA frame; those 'drvs' does
+ * not name read GCONF, which has no side effects. Chips beyond the chain
+ * read 0.
+ */
+static void tmc5160_exchange(struct tmc5160 *const *drvs, size_t n, uint8_t address_byte,
+                             const int32_t *values, int32_t *replies) {
+    for (uint8_t position = 0; position < TMC5160_CHAIN_LENGTH; position++) {
+        uint8_t *slot = tmc5160_chain_slot(tmc5160_chain_tx, position);
+        slot[0] = TMC5160_NOP;
+        slot[1] = slot[2] = slot[3] = slot[4] = 0;
+    }
+    for (size_t c = 0; c < n; c++) {
+        if (drvs[c]->cs >= TMC5160_CHAIN_LENGTH) {
+            continue;
+        }
+        uint8_t *slot = tmc5160_chain_slot(tmc5160_chain_tx, drvs[c]->cs);
+        uint32_t value = values ? (uint32_t)values[c] : 0;
+        slot[0] = address_byte;
+        slot[1] = (uint8_t)(value >> 24);
+        slot[2] = (uint8_t)(value >> 16);
+        slot[3] = (uint8_t)(value >> 8);
+        slot[4] = (uint8_t)value;
+    }
+
+    spi1_transfer_dma(0, tmc5160_chain_tx, tmc5160_chain_rx, TMC5160_DATAGRAM_SIZE * TMC5160_CHAIN_LENGTH);
+
+    for (size_t c = 0; c < n; c++) {
+        if (drvs[c]->cs >= TMC5160_CHAIN_LENGTH) {
+            replies[c] = 0;
+            continue;
+        }
+        const uint8_t *slot = tmc5160_chain_slot(tmc5160_chain_rx, drvs[c]->cs);
+        drvs[c]->status = slot[0];
+        replies[c] = (int32_t)(((uint32_t)slot[1] << 24) | ((uint32_t)slot[2] << 16) |
+                               ((uint32_t)slot[3] << 8) | slot[4]);
+    }
+}
+
+#else
+
+/**
+ * @brief One 40-bit datagram: sends the address byte and 'value', returns
+ *        the data requested by the previous datagram to the same chip and
+ *        stores the SPI_STATUS byte sent with it.
+ */
+static int32_t tmc5160_datagram(struct tmc5160 *drv, uint8_t address_byte, int32_t value) {
     int32_t received_value = 0;
-    volatile uint8_t dummy_read;
+    uint8_t cs = drv->cs;
+
+    spi1_cs_select(cs);
+    drv->status = spi1_transfer(address_byte);
+    received_value |= ((int32_t)spi1_transfer((value >> 24) & 0xFF) << 24);
+    received_value |= ((int32_t)spi1_transfer((value >> 16) & 0xFF) << 16);
+    received_value |= ((int32_t)spi1_transfer((value >> 8) & 0xFF) << 8);
+    received_value |= (int32_t)spi1_transfer(value & 0xFF);
+    spi1_cs_deselect(cs);
 
-    // --- Transaction 1: Request the register data ---
-    spi1_cs_select();
-    dummy_read = spi1_transfer(address_byte);
-    dummy_read = spi1_transfer(0x00);
-    dummy_read = spi1_transfer(0x00);
-    dummy_read = spi1_transfer(0x00);
-    dummy_read = spi1_transfer(0x00);
-    spi1_cs_deselect();
+    return received_value;
+}
 
+/**
+ * @brief Sends the same address byte with one value per chip to 'n' chips,
+ *        one chip select cycle each, and returns the data requested by
+ *        their previous datagrams.
+ */
+static void tmc5160_exchange(struct tmc5160 *const *drvs, size_t n, uint8_t address_byte,
+                             const int32_t *values, int32_t *replies) {
+    for (size_t c = 0; c < n; c++) {
+        replies[c] = tmc5160_datagram(drvs[c], address_byte, values ? values[c] : 0);
+    }
+}
+
+#endif
+
+static void tmc5160_delay(void) {
     for (volatile int i = 0; i < 100; i++); // Delay singkat
+}
 
-    // --- Transaction 2: Clock out the requested data ---
-    spi1_cs_select();
-    dummy_read = spi1_transfer(address_byte);
-    received_value |= ((int32_t)spi1_transfer(0x00) << 24);
-    received_value |= ((int32_t)spi1_transfer(0x00) << 16);
-    received_value |= ((int32_t)spi1_transfer(0x00) << 8);
-    received_value |= (int32_t)spi1_transfer(0x00);
-    spi1_cs_deselect();
+void tmc5160_write_register(struct tmc5160 *drv, uint8_t address, int32_t value) {
+    tmc5160_write_registers_batch(&drv, 1, address, &value);
+}
 
-    (void)dummy_read; // Hindari warning "unused variable"
+void tmc5160_write_registers_batch(struct tmc5160 *const *drvs, size_t n, uint8_t address, const int32_t *values) {
+    int32_t replies[TMC5160_BATCH_MAX];
 
-    return received_value;
+    if (n == 0 || n > TMC5160_BATCH_MAX) {
+        return;
+    }
+
+    uint32_t key = spi1_lock();
+    // The address's MSB marks a write access
+    tmc5160_exchange(drvs, n, address | 0x80, values, replies);
+    for (size_t c = 0; c < n; c++) {
+        drvs[c]->writes++;
+    }
+    spi1_unlock(key);
+}
+
+int32_t tmc5160_read_register(struct tmc5160 *drv, uint8_t address) {
+    int32_t value = 0;
+
+    tmc5160_read_registers(drv, &address, &value, 1);
+    return value;
 }
 
-void tmc5160_init(void) {
+void tmc5160_read_registers(struct tmc5160 *drv, const uint8_t *addresses, int32_t *values, size_t count) {
+    tmc5160_read_registers_batch(&drv, 1, addresses, values, count);
+}
+
+void tmc5160_read_registers_batch(struct tmc5160 *const *drvs, size_t n,
+                                  const uint8_t *addresses, int32_t *values, size_t count) {
+    int32_t replies[TMC5160_BATCH_MAX];
+
+    if (count == 0 || n == 0 || n > TMC5160_BATCH_MAX) {
+        return;
+    }
+
+    // A datagram of the motion timer in between would take the reply
+    uint32_t key = spi1_lock();
+
+    // --- Datagram 0: request the first register, discard the stale reply ---
+    tmc5160_exchange(drvs, n, addresses[0] & 0x7F, NULL, replies);
+
+    // --- Datagram i: request register i, clock out the data of register i-1 ---
+    // The final datagram re-requests the last address only to clock its data out.
+    // On separate chip selects the other chips fill the pause a single chip
+    // would need between the two; a chain frame serves them all at once.
+    for (size_t i = 1; i <= count; i++) {
+        uint8_t address_byte = addresses[(i < count) ? i : count - 1] & 0x7F;
+
+        if (n == 1 || TMC5160_CHAIN_LENGTH) {
+            tmc5160_delay();
+        }
+        tmc5160_exchange(drvs, n, address_byte, NULL, replies);
+        for (size_t c = 0; c < n; c++) {
+            values[c * count + i - 1] = replies[c];
+        }
+    }
+    spi1_unlock(key);
+}
+
+bool tmc5160_is_present(struct tmc5160 *drv) {
+    return TMC5160_IOIN_VERSION(tmc5160_read_register(drv, TMC5160_IOIN)) == TMC5160_VERSION;
+}
+
+void tmc5160_write_driver_config(struct tmc5160 *drv) {
+    int32_t chopconf = (int32_t)drv->config.chopconf;
+
+    if (!drv->driver_enabled) {
+        chopconf &= ~TMC5160_CHOPCONF_TOFF_MASK;
+    }
+
+    // 1. Chopper (CHOPCONF). TOFF = 0 keeps the bridges off.
+    tmc5160_write_register(drv, TMC5160_CHOPCONF, chopconf);
+
+    // 2. Run/hold current and the delay before current reduction (IHOLD_IRUN)
+    tmc5160_write_register(drv, TMC5160_IHOLD_IRUN, (int32_t)drv->config.ihold_irun);
+
+    // 3. Standstill delay before the driver reduces current to IHOLD (TPOWERDOWN)
+    tmc5160_write_register(drv, TMC5160_TPOWERDOWN, (int32_t)drv->config.tpowerdown);
+
+    // 4. StealthChop enable, en_pwm_mode = bit 2 (GCONF)
+    tmc5160_write_register(drv, TMC5160_GCONF, (int32_t)drv->config.gconf);
+
+    // 5. Speed above which the driver switches from StealthChop to SpreadCycle (TPWMTHRS)
+    tmc5160_write_register(drv, TMC5160_TPWMTHRS, (int32_t)drv->config.tpwmthrs);
+}
+
+void tmc5160_init(struct tmc5160 *drv, const struct tmc5160_driver_config *config) {
     // This sequence is based on the TMC5160 Datasheet Section 23.1 Initialization Examples.
-    // It configures the driver for SpreadCycle and enables StealthChop below a certain speed.
-
-    // 1. Configure Chopper (CHOPCONF Register)
-    // A known-good starting value for many motors.
-    // TOFF=3, HSTRT=4, HEND=1, TBL=2, CHM=0 (SpreadCycle)
-    tmc5160_write_register(TMC5160_CHOPCONF, 0x000100C3);
-
-    // 2. Configure Driver Current (IHOLD_IRUN Register)
-    // Sets the run current to the maximum (31/31) and the hold current to a lower value.
-    // IRUN = 31 (max current)
-    // IHOLD = 10 (approx 1/3 of max current)
-    // IHOLDDELAY = 6 (delay before current reduction)
-    tmc5160_write_register(TMC5160_IHOLD_IRUN, 0x00061F0A);
-
-    // 3. Configure Standstill Power-Down Delay (TPOWERDOWN Register)
-    // Sets the delay after standstill before the driver reduces current to IHOLD.
-    // TPOWERDOWN = 10 (approx. 0.8 seconds with 12MHz clock)
-    tmc5160_write_register(TMC5160_TPOWERDOWN, 0x0000000A);
-
-    // 4. Enable StealthChop (GCONF Register)
-    // Set en_pwm_mode (bit 2) to 1. This enables voltage-PWM mode (StealthChop).
-    tmc5160_write_register(TMC5160_GCONF, 0x00000004);
-
-    // 5. Set StealthChop threshold speed (TPWMTHRS Register)
-    // The driver will switch from StealthChop to SpreadCycle when speed exceeds this value.
-    // TPWM_THRS = 500 (a low speed value)
-    tmc5160_write_register(TMC5160_TPWMTHRS, 0x000001F4);
+    drv->config = *config;
+    drv->driver_enabled = true;
+    tmc5160_write_driver_config(drv);
 }
 
-void tmc5160_set_driver_enabled(bool enable) {
-    // Baca nilai CHOPCONF saat ini
-    int32_t chopconf = tmc5160_read_register(TMC5160_CHOPCONF);
-
-    if (enable) {
-        // Untuk mengaktifkan, kita perlu mengembalikan TOFF ke nilai operasinya.
-        // Kita menggunakan nilai default dari tmc5160_init(), yaitu 3.
-        chopconf |= 0x00000003; // Set TOFF bits [3:0] to 3
-    } else {
-        // Untuk menonaktifkan, kita set TOFF ke 0.
-        // Ini akan menonaktifkan semua bridge driver.
-        chopconf &= ~0x0000000F; // Clear TOFF bits [3:0]
+void tmc5160_configure(struct tmc5160 *drv, const struct tmc5160_driver_config *config) {
+    drv->config = *config;
+    tmc5160_write_driver_config(drv);
+}
+
+void tmc5160_set_driver_enabled(struct tmc5160 *drv, bool enable) {
+    int32_t chopconf = (int32_t)drv->config.chopconf;
+
+    // TOFF = 0 disables all bridge drivers; enabling restores the configured TOFF.
+    if (!enable) {
+        chopconf &= ~TMC5160_CHOPCONF_TOFF_MASK;
     }
 
-    // Tulis kembali nilai yang telah dimodifikasi
-    tmc5160_write_register(TMC5160_CHOPCONF, chopconf);
+    drv->driver_enabled = enable;
+    tmc5160_write_register(drv, TMC5160_CHOPCONF, chopconf);
 }
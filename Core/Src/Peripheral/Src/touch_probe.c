@@ -0,0 +1,161 @@
+#include "touch_probe.h"
+#include "tmc5160.h"
+
+// Per probe: input and latch bits of the TMC5160
+struct touch_probe_input {
+    uint32_t active;        // RAMP_STAT status_stop_x: input active
+    uint32_t latched;       // RAMP_STAT status_latch_x: XLATCH taken
+    uint32_t latch_active;  // SW_MODE latch_x_active
+    uint32_t latch_inactive;
+};
+
+static const struct touch_probe_input touch_probe_inputs[TOUCH_PROBE_COUNT] = {
+    { TMC5160_RAMP_STAT_STATUS_STOP_L, TMC5160_RAMP_STAT_STATUS_LATCH_L,
+      TMC5160_SW_MODE_LATCH_L_ACTIVE, TMC5160_SW_MODE_LATCH_L_INACTIVE },
+    { TMC5160_RAMP_STAT_STATUS_STOP_R, TMC5160_RAMP_STAT_STATUS_LATCH_R,
+      TMC5160_SW_MODE_LATCH_R_ACTIVE, TMC5160_SW_MODE_LATCH_R_INACTIVE },
+};
+
+#define TOUCH_PROBE_LATCH_FLAGS (TMC5160_RAMP_STAT_STATUS_LATCH_L | TMC5160_RAMP_STAT_STATUS_LATCH_R)
+
+static uint16_t probe_bits(uint16_t value, unsigned int probe) {
+    return (uint16_t)((value >> (8 * probe)) & 0xFF);
+}
+
+/**
+ * @brief Edges of 'probe' that still want a value.
+ */
+static uint32_t wanted_edges(const struct touch_probe *tp, unsigned int probe) {
+    uint16_t fn = probe_bits(tp->function, probe);
+    uint16_t st = probe_bits(tp->st, probe);
+    uint32_t edges = 0;
+
+    if (!(fn & TOUCH_PROBE_FN_ENABLE)) {
+        return 0;
+    }
+    if ((fn & TOUCH_PROBE_FN_POSITIVE_EDGE) &&
+        ((fn & TOUCH_PROBE_FN_CONTINUOUS) || !(st & TOUCH_PROBE_ST_POSITIVE_STORED))) {
+        edges |= TOUCH_PROBE_FN_POSITIVE_EDGE;
+    }
+    if ((fn & TOUCH_PROBE_FN_NEGATIVE_EDGE) &&
+        ((fn & TOUCH_PROBE_FN_CONTINUOUS) || !(st & TOUCH_PROBE_ST_NEGATIVE_STORED))) {
+        edges |= TOUCH_PROBE_FN_NEGATIVE_EDGE;
+    }
+    return edges;
+}
+
+/**
+ * @brief Arms one edge per probe. XLATCH does not tell which edge it took,
+ *        so with both edges wanted only the one that can come next (from
+ *        the present input level) is armed.
+ */
+static void arm(struct touch_probe *tp, uint32_t ramp_stat, bool force) {
+    uint32_t sw_mode = tp->polarity;
+
+    for (unsigned int probe = 0; probe < TOUCH_PROBE_COUNT; probe++) {
+        const struct touch_probe_input *in = &touch_probe_inputs[probe];
+        uint32_t edges = wanted_edges(tp, probe);
+
+        if (edges == (TOUCH_PROBE_FN_POSITIVE_EDGE | TOUCH_PROBE_FN_NEGATIVE_EDGE)) {
+            edges = (ramp_stat & in->active) ? TOUCH_PROBE_FN_NEGATIVE_EDGE : TOUCH_PROBE_FN_POSITIVE_EDGE;
+        }
+        tp->armed[probe] = edges;
+
+        if (edges & TOUCH_PROBE_FN_POSITIVE_EDGE) {
+            sw_mode |= in->latch_active;
+        }
+        if (edges & TOUCH_PROBE_FN_NEGATIVE_EDGE) {
+            sw_mode |= in->latch_inactive;
+        }
+    }
+
+    if (force || sw_mode != tp->sw_mode) {
+        tmc5160_write_register(tp->drv, TMC5160_SW_MODE, (int32_t)sw_mode);
+        tp->sw_mode = sw_mode;
+    }
+}
+
+void touch_probe_init(struct touch_probe *tp, struct tmc5160 *drv) {
+    *tp = (struct touch_probe){ .drv = drv };
+}
+
+void touch_probe_configure(struct touch_probe *tp, uint16_t function, uint32_t polarity) {
+    uint16_t enabled = (uint16_t)(function & ~tp->function);
+
+    for (unsigned int probe = 0; probe < TOUCH_PROBE_COUNT; probe++) {
+        uint16_t fn = probe_bits(function, probe);
+        uint16_t rising = probe_bits(enabled, probe);
+        uint16_t clear = 0;
+
+        if (!(fn & TOUCH_PROBE_FN_ENABLE)) {
+            clear = 0xFF;
+        } else {
+            if (rising & (TOUCH_PROBE_FN_ENABLE | TOUCH_PROBE_FN_POSITIVE_EDGE)) {
+                clear |= TOUCH_PROBE_ST_POSITIVE_STORED | TOUCH_PROBE_ST_POSITIVE_TOGGLE;
+            }
+            if (rising & (TOUCH_PROBE_FN_ENABLE | TOUCH_PROBE_FN_NEGATIVE_EDGE)) {
+                clear |= TOUCH_PROBE_ST_NEGATIVE_STORED | TOUCH_PROBE_ST_NEGATIVE_TOGGLE;
+            }
+        }
+        tp->st &= (uint16_t)~(clear << (8 * probe));
+        if (fn & TOUCH_PROBE_FN_ENABLE) {
+            tp->st |= (uint16_t)(TOUCH_PROBE_ST_ENABLED << (8 * probe));
+        }
+    }
+
+    tp->function = function;
+    tp->polarity = polarity;
+
+    // Latches from before belong to no probe
+    tmc5160_write_register(tp->drv, TMC5160_RAMP_STAT, TOUCH_PROBE_LATCH_FLAGS);
+    arm(tp, (uint32_t)tmc5160_read_register(tp->drv, TMC5160_RAMP_STAT), true);
+}
+
+bool touch_probe_poll(struct touch_probe *tp) {
+    uint32_t ramp_stat = (uint32_t)tmc5160_read_register(tp->drv, TMC5160_RAMP_STAT);
+    uint32_t latched = ramp_stat & TOUCH_PROBE_LATCH_FLAGS;
+
+    if (latched == 0) {
+        return false;
+    }
+
+    int32_t xlatch = tmc5160_read_register(tp->drv, TMC5160_XLATCH);
+    tmc5160_write_register(tp->drv, TMC5160_RAMP_STAT, latched);
+
+    // Both inputs share XLATCH: with both flags set it holds only the later
+    // position, and which one that is cannot be told. Both are dropped.
+    bool changed = false;
+    if (latched != TOUCH_PROBE_LATCH_FLAGS) {
+        for (unsigned int probe = 0; probe < TOUCH_PROBE_COUNT; probe++) {
+            if (!(latched & touch_probe_inputs[probe].latched) || tp->armed[probe] == 0) {
+                continue;
+            }
+            bool negative = (tp->armed[probe] == TOUCH_PROBE_FN_NEGATIVE_EDGE);
+            uint16_t stored = negative ? TOUCH_PROBE_ST_NEGATIVE_STORED : TOUCH_PROBE_ST_POSITIVE_STORED;
+            uint16_t toggle = negative ? TOUCH_PROBE_ST_NEGATIVE_TOGGLE : TOUCH_PROBE_ST_POSITIVE_TOGGLE;
+
+            tp->values[probe][negative] = xlatch;
+            tp->st |= (uint16_t)(stored << (8 * probe));
+            if (probe_bits(tp->function, probe) & TOUCH_PROBE_FN_CONTINUOUS) {
+                tp->st ^= (uint16_t)(toggle << (8 * probe));
+            }
+            changed = true;
+        }
+    }
+
+    // The input level after the edge selects the next edge to arm
+    arm(tp, ramp_stat, false);
+    return changed;
+}
+
+bool touch_probe_is_enabled(const struct touch_probe *tp) {
+    return (tp->function & (TOUCH_PROBE_FN_ENABLE | (TOUCH_PROBE_FN_ENABLE << 8))) != 0;
+}
+
+uint16_t touch_probe_status(const struct touch_probe *tp) {
+    return tp->st;
+}
+
+int32_t touch_probe_value(const struct touch_probe *tp, unsigned int probe, bool negative) {
+    return tp->values[probe][negative];
+}
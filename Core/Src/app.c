@@ -0,0 +1,3053 @@
+#include "app.h"
+#include "can.h"
+#include "sdev.h"
+#include "systick.h"
+#include "tmc5160.h"
+#include "scope.h"
+#include "sdo_test.h"
+#include "concise_dcf.h"
+#include "nvparam.h"
+#include "boot_time.h"
+#include "setpoint.h"
+#include "motion_profile.h"
+#include "homing.h"
+#include "touch_probe.h"
+#include "encoder.h"
+#include "interpolation.h"
+#include "motion_queue.h"
+#include "motion_timer.h"
+#include "heartbeat.h"
+#include "drive_fault.h"
+#include "gearing.h"
+#include "factor_group.h"
+#include "spi.h"       // SPI1_CS_COUNT, SPI1_LOCK_PRIORITY
+#include "stm32f4xx.h" // NVIC_SystemReset()
+
+// --- Lely CANopen Includes ---
+#include <lely/co/dev.h>
+#include <lely/co/emcy.h>
+#include <lely/co/nmt.h>
+#include <lely/co/sdo.h>
+#include <lely/co/rpdo.h>
+#include <lely/co/tpdo.h>
+#include <lely/co/time.h>
+#include <lely/co/val.h>
+
+// --- C Standard Library Includes ---
+#include <limits.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+// Jumlah frame CAN yang diambil dari ring buffer per panggilan can_recv()
+#define CAN_RX_BATCH             8
+
+// NMT State constants
+#define CO_NMT_ST_BOOTUP         0x00
+#define CO_NMT_ST_STOP           0x04  // PRE-OPERATIONAL
+#define CO_NMT_ST_START          0x05  // OPERATIONAL
+
+// [STATE MACHINE] Definisi state CiA 402, sesuai diagram
+typedef enum {
+    PDS_STATE_NOT_READY_TO_SWITCH_ON,
+    PDS_STATE_SWITCH_ON_DISABLED,
+    PDS_STATE_READY_TO_SWITCH_ON,
+    PDS_STATE_SWITCHED_ON,
+    PDS_STATE_OPERATION_ENABLED,
+    PDS_STATE_QUICK_STOP_ACTIVE,
+    PDS_STATE_FAULT_REACTION_ACTIVE,
+    PDS_STATE_FAULT
+} pds_state_t;
+
+// [STATE MACHINE] Bit-bit penting di Statusword (Objek 0x6041)
+#define SW_READY_TO_SWITCH_ON   (1 << 0)
+#define SW_SWITCHED_ON          (1 << 1)
+#define SW_OPERATION_ENABLED    (1 << 2)
+#define SW_FAULT                (1 << 3)
+#define SW_VOLTAGE_ENABLED      (1 << 4)
+#define SW_QUICK_STOP           (1 << 5)
+#define SW_SWITCH_ON_DISABLED   (1 << 6)
+#define SW_TARGET_REACHED       (1 << 10)
+#define SW_SETPOINT_ACK         (1 << 12) // PP mode: new set-point accepted
+#define SW_HOMING_ATTAINED      (1 << 12) // Homing mode
+#define SW_HOMING_ERROR         (1 << 13) // Homing mode
+#define SW_FOLLOWING_VELOCITY   (1 << 12) // CSV mode: the target velocity is followed
+#define SW_IP_MODE_ACTIVE       (1 << 12) // IP mode: the buffered points are followed
+#define SW_FOLLOWING_MASTER     (1 << 12) // Electronic gearing: the master position is followed
+
+// [STATE MACHINE] Perintah dari Controlword (Objek 0x6040)
+#define CW_CMD_SHUTDOWN         0x0006
+#define CW_CMD_SWITCH_ON        0x0007
+#define CW_CMD_DISABLE_VOLTAGE  0x0000
+#define CW_CMD_QUICK_STOP       0x0002
+#define CW_CMD_DISABLE_OP       0x0007
+#define CW_CMD_ENABLE_OP        0x000F
+#define CW_CMD_FAULT_RESET      0x0080
+#define CW_NEW_SETPOINT         0x0010 // PP mode: bit 4; homing mode: start
+#define CW_CHANGE_IMMEDIATELY   0x0020 // PP mode: bit 5, abort the current set-point
+#define CW_CHANGE_ON_SETPOINT   0x0200 // PP mode: bit 9, do not stop at the previous target
+#define CW_HALT                 0x0100 // Bit 8: stop with the halt option code (0x605D)
+
+// Relevant bits of each command (CiA 402); the others are mode specific
+#define CW_MASK_SHUTDOWN        0x0087
+#define CW_MASK_SWITCH_ON       0x008F
+#define CW_MASK_DISABLE_VOLTAGE 0x0082
+#define CW_MASK_QUICK_STOP      0x0086
+
+// Quick stop option code (0x605A) and halt option code (0x605D)
+#define STOP_OPTION_DISABLE_DRIVE   0 // Quick stop only: power stage off at once
+#define STOP_OPTION_SLOW_DOWN       1 // Profile deceleration (0x6084)
+#define STOP_OPTION_QUICK_STOP      2 // Quick stop deceleration (0x6085)
+#define STOP_OPTION_STAY_SLOW_DOWN  5 // Quick stop only: as 1/2, then stay in QUICK STOP ACTIVE
+#define STOP_OPTION_STAY_QUICK_STOP 6
+
+// Manufacturer-specific mode of operation (0x6060)
+#define MODE_ELECTRONIC_GEARING     (-1) // Follows the master position of 0x2005:01
+
+// Abort connection option code (0x6007): reaction to a lost heartbeat
+#define ABORT_OPTION_NO_ACTION      0
+#define ABORT_OPTION_FAULT          1 // Fault reaction, then FAULT
+#define ABORT_OPTION_DISABLE_VOLTAGE 2 // Device control command 'disable voltage'
+#define ABORT_OPTION_QUICK_STOP     3 // Device control command 'quick stop'
+
+// COB-ID of the heartbeat of a node (0x700 + node-ID)
+#define HEARTBEAT_COB_ID        0x700
+
+
+// Communication errors Lely reports itself (0x81xx), pushed again when the
+// error stack is rebuilt
+#define EEC_COMMUNICATION_MASK  0xFF00
+#define EEC_COMMUNICATION       0x8100
+#define COMMUNICATION_ERROR_MAX 8
+
+// Following error check (0x6065/0x6066) from XACTUAL - X_ENC, in ms
+#define FOLLOWING_ERROR_POLL_INTERVAL_MS 1
+
+// Axes: one TMC5160 each, on the chip selects of SPI1 (axis 1 = PA4)
+#define AXIS_COUNT              SPI1_CS_COUNT
+
+// Object Dictionary distance between the objects of two axes (CiA 402:
+// 0x6000-0x67FF for axis 1, 0x6800 for axis 2, ...; 0x2000-0x2002 likewise)
+#define AXIS_OD_OFFSET          0x800
+
+// PDO numbers per axis: axis n (0-based) uses RPDO 4n+1..4n+4, TPDO 4n+1..4n+4
+// and the synchronous TPDO 17+n (CSV mode: statusword, velocity actual value)
+#define AXIS_PDO_COUNT          4
+
+// Index of a per-axis object for 'ax'
+#define AXIS_OBJ(ax, idx)       ((co_unsigned16_t)((idx) + (ax)->n * AXIS_OD_OFFSET))
+
+// The motion timer writes the TMC5160s: main loop SPI accesses must mask it
+_Static_assert(MOTION_TIMER_IRQ_PRIORITY >= SPI1_LOCK_PRIORITY, "Motion timer not masked by spi1_lock()");
+
+// A homing step is posted as one command of the motion tick budget
+_Static_assert(HOMING_LOAD_DATAGRAMS <= MOTION_COMMAND_DATAGRAMS_MAX, "Homing step larger than a motion command");
+
+// [STATE MACHINE] Bit-bit penting di RAMP_STAT TMC5160
+#define RAMP_STAT_POSITION_REACHED (1 << 9)
+
+// GSTAT: the power stage was shut down (overtemperature, short) or the charge pump failed;
+// cleared by a fault reset
+#define GSTAT_DRIVER_FAULTS     (TMC5160_GSTAT_DRV_ERR | TMC5160_GSTAT_UV_CP)
+
+/**
+ * @brief TMC5160 registers of one axis, read at the end of a motion tick
+ *        (one axis per tick, in turn), shared by the statusword, set-point,
+ *        stop and following error logic and the SDO and PDO callbacks.
+ */
+struct axis_sample {
+    uint32_t ramp_stat;
+    int32_t xactual;
+    int32_t vactual;    // Sign-extended
+    int32_t x_enc;
+    uint32_t tail;      // motion_queue.tail when read: the commands before it show
+};
+
+/**
+ * @brief One CiA 402 axis: its TMC5160, state machine and motion state.
+ */
+struct axis {
+    uint8_t n;                      // 0 = axis 1: objects at 0x6000 + n * AXIS_OD_OFFSET
+    bool is_present;                // A TMC5160 answers on the chip select
+    struct tmc5160 drv;
+    struct axis_sample sample;      // Copy of the last sample the motion tick published
+
+    // [STATE MACHINE] Variabel untuk state machine
+    pds_state_t state;
+    uint16_t statusword;
+    uint16_t tpdo_statusword;       // Statusword carried by the last TPDO event
+    uint16_t previous_controlword;
+    int8_t mode_op;
+
+    bool is_setpoint_acknowledged;  // PP mode: bit 12 until bit 4 of the controlword drops
+    bool is_move_active;            // PP mode: XTARGET set from a set-point that is not yet reached
+    struct setpoint active_setpoint; // The set-point being executed
+    struct setpoint_fifo setpoints;
+    struct tmc5160_ramp profile_ramp; // Ramp of the motion profile of the last set-point
+    struct tmc5160_ramp ramp;       // Ramp registers in effect, for the blending distance
+    bool is_ramp_written;           // 'ramp' matches the TMC5160 registers
+    bool is_halted;                 // PP mode: bit 8 stopped the motion, resumed when it drops
+    int16_t quick_stop_option;      // 0x605A at the quick stop command
+    bool is_reset_flag_cleared;     // GSTAT reset write-1-to-clear posted, status byte not clear yet
+    uint32_t errors;                // DRIVE_ERROR_BIT()s reported by EMCY and not yet gone
+
+    struct homing homing;
+    struct touch_probe touch_probe;
+    bool is_touch_probe_pending;    // 0x60B8 or 0x2001:02 written, applied by poll_touch_probe()
+
+    bool is_encoder_enabled;        // 0x2002 describes an encoder: the actual position is X_ENC
+    struct following_error following_error;
+    uint32_t last_following_error_time;
+
+    bool is_velocity_mode;          // CSV mode: the ramp generator runs in velocity mode
+    bool is_velocity_stopping;      // Ramping down to rest, then back to positioning
+    int32_t csv_velocity;           // CSV mode: set-point of the last SYNC, signed VMAX units
+
+    struct interpolation ip;        // IP mode: point buffer, consumed by on_motion_tick()
+    uint8_t ip_partial[4];          // 0x2004: bytes of a point split across SDO segments
+    uint8_t ip_partial_size;
+
+    struct gearing gearing;         // Electronic gearing: unwrapped master position, demand position
+    bool is_gearing_engaged;        // The demand position has been posted since the last stop
+
+    struct factor_group factors;    // 0x608F/0x6091/0x6092: user units to usteps and TMC5160 units
+
+    bool is_motion_posted;          // Commands posted to the motion tick are not all executed
+    uint32_t motion_index;          // Queue position of the last one
+
+    int16_t abort_option;           // 0x6007, for the motion tick
+    uint32_t abort_decel;           // Its stop ramp; 0: power stage off at once
+    bool is_stopped_on_loss;        // Stopped by the motion tick, transition still to make
+};
+
+static struct axis axes[AXIS_COUNT];
+static struct interpolation_buffer ip_buffers[AXIS_COUNT] __attribute__((section(".ccm_noinit")));
+
+// Motion side effects of the callbacks, executed by the motion tick
+static struct motion_queue motion_queue = { .cycles = &boot_time_cycles };
+static volatile uint32_t motion_tick_max_cycles = 0;
+static uint32_t sync_marks = 0; // MOTION_COMMAND_MARKs of on_sync() published in 0x2106
+static bool is_drive_configured = false; // TMC5160s are configured after the boot-up message
+static uint32_t last_sync_cycles = 0;    // Reception of the previous SYNC, for its period
+static volatile bool is_motion_stats_reset = false; // 0x2107:04 written 0, for the next tick
+
+// Registers of every axis, read by the motion tick after its commands; the
+// sequence counts the samples published
+static struct axis_sample published_samples[AXIS_COUNT];
+static volatile uint32_t sample_sequence = 0;
+static size_t next_sample_axis = 0; // Motion tick: the axis it samples next
+
+// Datagrams of the commands per tick (0x2107:01 and the fitted axes, see
+// motion_tick_budget()), set by the main loop
+static volatile unsigned int motion_tick_command_budget = 0;
+
+// Heartbeat consumers (0x1016), checked by the motion tick, which starts
+// the reaction of every axis (0x6007) to a loss; the main loop completes it
+static struct heartbeat_consumer heartbeat_consumers[HEARTBEAT_CONSUMER_COUNT];
+static uint32_t heartbeat_entries[HEARTBEAT_CONSUMER_COUNT]; // 0x1016 values in effect
+static uint32_t motion_clock_us = 0;            // From the cycle counter, at every motion tick
+static uint32_t motion_clock_base_us = 0;       // motion_clock_us at motion_clock_base_cycles
+static uint32_t motion_clock_base_cycles = 0;
+static volatile uint32_t heartbeat_losses = 0;
+static uint32_t heartbeat_losses_handled = 0;
+static volatile uint32_t heartbeat_loss_base = 0; // 0x2108:03 = heartbeat_losses - heartbeat_loss_base
+static volatile bool is_heartbeat_stats_reset = false; // 0x2108:03 written 0, for the next tick
+static volatile uint8_t heartbeat_lost_node = 0;
+static volatile uint32_t heartbeat_reaction_us = 0;     // Expiry to the stop ramp, last loss
+static volatile uint32_t heartbeat_reaction_max_us = 0;
+
+// Active errors of the axes, newest first: Lely's error stack, and with it
+// the error register (0x1001) and the pre-defined error field (0x1003), is
+// rebuilt from them when one goes
+struct active_error {
+    co_unsigned16_t code;
+    co_unsigned8_t error_register;
+    uint8_t axis;
+    co_unsigned8_t msef[5];
+};
+static struct active_error active_errors[AXIS_COUNT * DRIVE_ERROR_COUNT];
+static size_t active_error_count = 0;
+
+// Global pointers for the Lely CANopen stack components
+static can_net_t *net = NULL;
+static co_dev_t *dev = NULL;
+static co_nmt_t *nmt = NULL;
+
+// Time of the last periodic TPDO2 event
+static uint32_t last_tpdo_time = 0;
+
+static int on_can_send(const struct can_msg *msg, void *data);
+static void on_nmt_cs(co_nmt_t *nmt, co_unsigned8_t cs, void *data);
+static void on_time(co_time_t *time, const struct timespec *tp, void *data);
+static co_unsigned32_t on_read_actual_pos(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_velocity_actual(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static void on_sync(co_nmt_t *nmt, co_unsigned8_t cnt, void *data);
+static co_unsigned32_t on_write_target_pos(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_statusword(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_controlword(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_mode_op(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_driver_config(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_touch_probe(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_encoder(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_factor(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static void read_driver_config(const struct axis *ax, struct tmc5160_driver_config *config);
+static void init_axis(struct axis *ax, uint8_t n);
+static void configure_drive(struct axis *ax);
+static void sample_axis(void);
+static const struct axis_sample *axis_sample(struct axis *ax);
+static void update_statusword(struct axis *ax);
+static void send_statusword(struct axis *ax);
+static co_tpdo_t *axis_tpdo(const struct axis *ax, int pdo);
+
+// Core logic functions (shared between SDO and PDO)
+static bool process_controlword(struct axis *ax, uint16_t command);
+static void process_mode_of_operation(struct axis *ax, int8_t mode);
+static bool process_target_position(struct axis *ax, int32_t target_pos);
+static void accept_setpoint(struct axis *ax, uint16_t command);
+static void execute_setpoint(struct axis *ax, const struct setpoint *sp);
+static void release_setpoint_ack(struct axis *ax);
+static void poll_setpoints(struct axis *ax);
+static uint32_t stop_deceleration(const struct axis *ax, int16_t option);
+static void start_stop_ramp(struct axis *ax, uint32_t decel);
+static void start_quick_stop(struct axis *ax);
+static void disable_operation(struct axis *ax, pds_state_t state);
+static void enter_fault(struct axis *ax, uint32_t errors);
+static void raise_errors(struct axis *ax, uint32_t errors, uint32_t drv_status);
+static void clear_errors(struct axis *ax, uint32_t errors);
+static void poll_stop(struct axis *ax);
+static void poll_driver_faults(struct axis *ax);
+static void start_homing(struct axis *ax);
+static void load_homing(void *context, int32_t value);
+static void stop_homing(void *context, int32_t value);
+static void poll_homing(struct axis *ax);
+static uint32_t switch_polarity(const struct axis *ax);
+static void publish_touch_probe(struct axis *ax);
+static void poll_touch_probe(struct axis *ax);
+static void read_encoder_config(const struct axis *ax, struct encoder_config *config);
+static void read_factor_config(const struct axis *ax, struct factor_group_config *config);
+static void configure_encoder(struct axis *ax);
+static void sync_encoder(struct axis *ax);
+static void align_position(struct axis *ax);
+static int32_t actual_position(struct axis *ax);
+static void poll_following_error(struct axis *ax);
+static void stop_velocity_mode(struct axis *ax, uint32_t decel);
+static void leave_velocity_mode(struct axis *ax);
+static void poll_velocity_mode(struct axis *ax);
+static void record_sync_latency(uint32_t cycles);
+static void start_interpolation(struct axis *ax);
+static void stop_interpolation(struct axis *ax);
+static void on_motion_tick(void);
+static void post_command(struct axis *ax, const struct motion_command *cmd);
+static void post_write(struct axis *ax, uint8_t address, int32_t value);
+static void post_copy(struct axis *ax, uint8_t address, uint8_t source);
+static void post_driver_enabled(struct axis *ax, bool enable);
+static void post_call(struct axis *ax, void (*call)(void *context, int32_t value), void *context, int32_t value,
+                      uint8_t datagrams);
+static void flush_motion(void);
+static bool is_motion_pending(struct axis *ax);
+static bool is_any_axis_enabled(void);
+static unsigned int fitted_axes(void);
+static uint32_t min_motion_period(void);
+static void set_motion_period(uint32_t period_us);
+static void clamp_motion_period(void);
+static co_unsigned32_t on_write_motion_tick(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_motion_tick(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static void configure_heartbeat_consumers(void);
+static void advance_motion_clock(void);
+static void prepare_abort_connection(struct axis *ax);
+static void check_heartbeats(void);
+static void stop_on_connection_loss(struct axis *ax);
+static void poll_connection_loss(void);
+static co_unsigned32_t on_write_heartbeat_loss(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_heartbeat_loss(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_ip_data(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_ip_config(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_write_ip_burst(co_sub_t *sub, struct co_sdo_req *req, void *data);
+static co_unsigned32_t on_read_ip_status(const co_sub_t *sub, struct co_sdo_req *req, void *data);
+static bool can_follow_master(const struct axis *ax);
+static void post_gearing_target(struct axis *ax);
+static void poll_gearing(struct axis *ax);
+static co_unsigned32_t on_write_master_position(co_sub_t *sub, struct co_sdo_req *req, void *data);
+
+// PDO callback functions
+static void on_rpdo1_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data);
+static void on_rpdo2_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data);
+static void on_rpdo3_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data);
+static void register_rpdo_callbacks(struct axis *ax);
+
+/**
+ * @brief Retrieves the current system time in milliseconds and converts it
+ *        to the 'struct timespec' format required by Lely.
+ * @param tp Pointer to the timespec structure to be filled.
+ */
+static void get_time(struct timespec *tp) {
+    uint32_t ms = millis();
+    tp->tv_sec = ms / 1000;
+    tp->tv_nsec = (ms % 1000) * 1000000;
+}
+
+void app_init(uint32_t t) {
+    // Create the CANopen device from our static Object Dictionary and load the
+    // stored parameters (0x1010) into it, before anything is configured from it.
+    dev = co_dev_create_from_sdev(&slave_sdev);
+    t = boot_time_record(BOOT_PHASE_OD, t);
+
+    nvparam_init(dev, &is_any_axis_enabled);
+    t = boot_time_record(BOOT_PHASE_RESTORE, t);
+
+    // --- Lely CANopen Stack Initialization ---
+    // The boot-up message goes out first; the TMC5160 is configured afterwards
+    // (configure_drive() in app_poll()), so the master sees the node early.
+
+    // 1. Create the network interface
+    net = can_net_create();
+
+    // 2. Set the function that Lely will call to send a CAN frame
+    can_net_set_send_func(net, &on_can_send, NULL);
+
+    // 3. Create and start the NMT (Network Management) service
+    nmt = co_nmt_create(net, dev);
+
+    // Start the NMT service by resetting the node (triggers boot-up message).
+    co_nmt_cs_ind(nmt, CO_NMT_CS_RESET_NODE);
+    boot_time_record(BOOT_PHASE_NMT, t);
+    boot_time_init(dev);
+
+    // Set the NMT indication function to handle commands from the master.
+    co_nmt_set_cs_ind(nmt, &on_nmt_cs, NULL);
+
+    // Set the TIME indication function.
+    co_time_set_ind(co_nmt_get_time(nmt), &on_time, NULL);
+
+    // SYNC: CSV velocities, after the synchronous PDOs. The receive interrupt
+    // records when the SYNC came in, for the latency in 0x2106.
+    co_nmt_set_sync_ind(nmt, &on_sync, NULL);
+    can_set_sync_id(co_dev_get_val_u32(dev, 0x1005, 0x00) & CAN_MASK_BID);
+
+    // Every axis has its own objects and PDOs; the callbacks get the axis.
+    // Whether its TMC5160 is fitted is known once the drives are configured.
+    for (uint8_t n = 0; n < AXIS_COUNT; n++) {
+        init_axis(&axes[n], n);
+    }
+
+    scope_init(dev, &axes[0].drv);
+    sdo_test_init(dev);
+    concise_dcf_init(dev);
+
+    // Motion tick (0x2107): executes the TMC5160 accesses the callbacks
+    // post, and takes the Interpolated Position points
+    co_sub_set_dn_ind(co_dev_find_sub(dev, 0x2107, 0x01), &on_write_motion_tick, NULL);
+    co_sub_set_dn_ind(co_dev_find_sub(dev, 0x2107, 0x04), &on_write_motion_tick, NULL);
+    for (co_unsigned8_t subidx = 0x02; subidx <= 0x04; subidx++) {
+        co_sub_set_up_ind(co_dev_find_sub(dev, 0x2107, subidx), &on_read_motion_tick, NULL);
+    }
+    motion_timer_start(co_dev_get_val_u16(dev, 0x2107, 0x01), &on_motion_tick);
+    clamp_motion_period();
+
+    // Heartbeat loss reaction (0x2108): times and count of the losses
+    co_sub_set_dn_ind(co_dev_find_sub(dev, 0x2108, 0x03), &on_write_heartbeat_loss, NULL);
+    for (co_unsigned8_t subidx = 0x01; subidx <= 0x04; subidx++) {
+        co_sub_set_up_ind(co_dev_find_sub(dev, 0x2108, subidx), &on_read_heartbeat_loss, NULL);
+    }
+}
+
+/**
+ * @brief Sets up axis 'n' (0-based) and registers the callbacks of its
+ *        objects and RPDOs. It stays NOT READY TO SWITCH ON until
+ *        configure_drive() has found its TMC5160.
+ */
+static void init_axis(struct axis *ax, uint8_t n) {
+    *ax = (struct axis){
+        .n = n,
+        .drv = { .cs = n },
+        .state = PDS_STATE_NOT_READY_TO_SWITCH_ON,
+        .quick_stop_option = STOP_OPTION_QUICK_STOP,
+    };
+    homing_init(&ax->homing, &ax->drv);
+    touch_probe_init(&ax->touch_probe, &ax->drv);
+    interpolation_init(&ax->ip, &ip_buffers[n]);
+    interpolation_set_size(&ax->ip, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x60C4), 0x02));
+
+    // Stored factors that do not compute (e.g. 0) leave the default of 1:1
+    struct factor_group_config factor_config;
+    read_factor_config(ax, &factor_config);
+    if (!factor_group_compute(&ax->factors, &factor_config)) {
+        factor_group_compute(&ax->factors, &(struct factor_group_config){ 1, 1, 1, 1, 1, 1 });
+    }
+
+    co_sub_set_up_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x6064), 0x00), &on_read_actual_pos, ax);
+
+    co_sub_set_up_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x606C), 0x00), &on_read_velocity_actual, ax);
+
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x607A), 0x00), &on_write_target_pos, ax);
+
+    co_sub_set_up_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x6041), 0x00), &on_read_statusword, ax);
+
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x6040), 0x00), &on_write_controlword, ax);
+
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x6060), 0x00), &on_write_mode_op, ax);
+
+    for (co_unsigned8_t subidx = 0x01; subidx <= 0x05; subidx++) {
+        co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2000), subidx), &on_write_driver_config, ax);
+    }
+
+    // Touch probe function, and the input polarity it shares with homing
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x60B8), 0x00), &on_write_touch_probe, ax);
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2001), 0x02), &on_write_touch_probe, ax);
+
+    for (co_unsigned8_t subidx = 0x01; subidx <= 0x03; subidx++) {
+        co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2002), subidx), &on_write_encoder, ax);
+    }
+
+    // Interpolated Position: points one at a time (SDO or a mapped RPDO) or
+    // as a burst, the buffer configuration, and the fill level for the TPDO
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x60C1), 0x01), &on_write_ip_data, ax);
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x60C4), 0x02), &on_write_ip_config, ax);
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x60C4), 0x06), &on_write_ip_config, ax);
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2004), 0x00), &on_write_ip_burst, ax);
+    co_sub_set_up_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2003), 0x01), &on_read_ip_status, ax);
+    co_sub_set_up_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2003), 0x02), &on_read_ip_status, ax);
+
+    // Electronic gearing: the master position, by SDO or a mapped RPDO
+    co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, 0x2005), 0x01), &on_write_master_position, ax);
+
+    // Factor group: position encoder resolution, gear ratio, feed constant
+    static const co_unsigned16_t factor_objects[] = { 0x608F, 0x6091, 0x6092 };
+    for (size_t i = 0; i < sizeof(factor_objects) / sizeof(factor_objects[0]); i++) {
+        for (co_unsigned8_t subidx = 0x01; subidx <= 0x02; subidx++) {
+            co_sub_set_dn_ind(co_dev_find_sub(dev, AXIS_OBJ(ax, factor_objects[i]), subidx), &on_write_factor, ax);
+        }
+    }
+
+    register_rpdo_callbacks(ax);
+    update_statusword(ax);
+}
+
+void app_poll(void) {
+    // Deferred from start-up: done once, before the first received frame
+    // is processed, so SDO/PDO access always finds a configured driver.
+    if (!is_drive_configured) {
+        uint32_t start = boot_time_cycles();
+        for (size_t n = 0; n < AXIS_COUNT; n++) {
+            configure_drive(&axes[n]);
+        }
+        is_drive_configured = true;
+        boot_time_record(BOOT_PHASE_DRIVE, start);
+
+        // Every fitted axis takes its share of the motion tick
+        clamp_motion_period();
+    }
+
+    // A heartbeat loss stopped the axes in the motion tick: the state
+    // machines follow before any frame can post new motion
+    poll_connection_loss();
+    configure_heartbeat_consumers();
+
+    // 3. Get the current time and process any time-based events in the Lely stack
+    struct timespec now;
+    get_time(&now);
+    can_net_set_time(net, &now);
+
+    struct can_msg rx_msgs[CAN_RX_BATCH];
+    size_t rx_count;
+
+    // 1. Drain our CAN driver's ring buffer. SDO block transfers send up to
+    //    127 segments back-to-back, so one frame per loop is not enough.
+    while ((rx_count = can_recv(rx_msgs, CAN_RX_BATCH)) > 0) {
+        // 2. Pass every message to the Lely stack for processing
+        for (size_t i = 0; i < rx_count; i++) {
+            can_net_recv(net, &rx_msgs[i]);
+        }
+    }
+
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        struct axis *ax = &axes[n];
+        if (!ax->is_present) {
+            continue;
+        }
+
+        // Feed the next buffered set-point once the current one is done. The
+        // ramp state means nothing while commands wait for the motion tick.
+        if (!is_motion_pending(ax)) {
+            poll_setpoints(ax);
+        }
+        poll_homing(ax);
+        poll_touch_probe(ax);
+
+        // Quick stop / fault reaction ramp finished, driver errors, lost steps
+        if (!is_motion_pending(ax)) {
+            poll_velocity_mode(ax);
+            poll_stop(ax);
+        }
+        poll_driver_faults(ax);
+        poll_following_error(ax);
+        poll_gearing(ax);
+        prepare_abort_connection(ax);
+
+        // 4. Update statusword. Every change goes out on TPDO1 at once, so the
+        //    master sees 'target reached' without waiting for the periodic TPDO2.
+        update_statusword(ax);
+        if (ax->statusword != ax->tpdo_statusword) {
+            send_statusword(ax);
+        }
+    }
+
+    // CSV: the velocities of a SYNC have been written
+    if (motion_queue.marks != sync_marks) {
+        sync_marks = motion_queue.marks;
+        record_sync_latency(motion_queue.mark_latency);
+    }
+
+    // Sample the motion recorder (no-op unless armed)
+    scope_poll();
+
+    // Erase the spare parameter sector while no axis can be disturbed
+    nvparam_poll();
+
+    // 5. ← TAMBAHAN BARU: Trigger TPDO secara periodic (setiap 100ms)
+    uint32_t current_time = millis();
+    if (current_time - last_tpdo_time >= 100) {
+        last_tpdo_time = current_time;
+
+        // ✨ Check NMT state before sending TPDO
+        co_unsigned8_t nmt_state = co_nmt_get_st(nmt);
+
+        if (nmt_state == CO_NMT_ST_START) {  // Only in OPERATIONAL
+            for (size_t n = 0; n < AXIS_COUNT; n++) {
+                struct axis *ax = &axes[n];
+                co_tpdo_t *tpdo2 = axis_tpdo(ax, 2);
+                if (ax->is_present && tpdo2) {
+                    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x6064), 0x00,
+                                       factor_scale(&ax->factors.position_inv, actual_position(ax)));
+                    co_tpdo_event(tpdo2);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief TPDO 'pdo' (1-4) of an axis: TPDO 4n + pdo.
+ */
+static co_tpdo_t *axis_tpdo(const struct axis *ax, int pdo) {
+    return co_nmt_get_tpdo(nmt, (co_unsigned16_t)(AXIS_PDO_COUNT * ax->n + pdo));
+}
+
+static const uint8_t sample_addresses[] = { TMC5160_RAMP_STAT, TMC5160_XACTUAL, TMC5160_VACTUAL, TMC5160_X_ENC };
+#define SAMPLE_REGS (sizeof(sample_addresses) / sizeof(sample_addresses[0]))
+
+_Static_assert(SAMPLE_REGS + 1 == MOTION_TICK_SAMPLE_DATAGRAMS, "Sample not in the motion tick budget");
+
+/**
+ * @brief Reads the sample registers of the next fitted TMC5160 and
+ *        publishes them (motion tick). One axis per tick keeps the tick
+ *        within its budget; each is sampled every 'fitted axes' ticks.
+ *        The commands the tick has executed show in the sample.
+ */
+static void sample_axis(void) {
+    int32_t regs[SAMPLE_REGS];
+
+    for (size_t i = 0; i < AXIS_COUNT; i++) {
+        struct axis *ax = &axes[next_sample_axis];
+        next_sample_axis = (next_sample_axis + 1) % AXIS_COUNT;
+        if (!ax->is_present) {
+            continue;
+        }
+
+        tmc5160_read_registers(&ax->drv, sample_addresses, regs, SAMPLE_REGS);
+        struct axis_sample *sample = &published_samples[ax->n];
+        sample->ramp_stat = (uint32_t)regs[0];
+        sample->xactual = regs[1];
+        sample->vactual = (int32_t)((uint32_t)regs[2] << 8) >> 8; // 24-bit two's complement
+        sample->x_enc = regs[3];
+        sample->tail = motion_queue.tail;
+        atomic_signal_fence(memory_order_release);
+        sample_sequence++;
+        return;
+    }
+}
+
+/**
+ * @brief The last sample the motion tick published, without an SPI access.
+ *        A tick that publishes a new one during the copy is seen by its
+ *        sequence, and the copy is taken again.
+ */
+static const struct axis_sample *axis_sample(struct axis *ax) {
+    uint32_t sequence;
+
+    do {
+        sequence = sample_sequence;
+        atomic_signal_fence(memory_order_acquire);
+        ax->sample = published_samples[ax->n];
+        atomic_signal_fence(memory_order_acquire);
+    } while (sequence != sample_sequence);
+    return &ax->sample;
+}
+
+/**
+ * @brief Wrapper function to bridge our can_send() to Lely's can_send_func_t.
+ * @param msg  Pointer to the CAN message provided by Lely.
+ * @param data User-defined data pointer (unused).
+ * @return 0 on success, -1 on failure.
+ */
+static int on_can_send(const struct can_msg *msg, void *data) {
+    (void)data;
+    if (can_send(msg) == 1) {
+        return 0; // Success
+    }
+    return -1; // Failure
+}
+
+/**
+ * @brief Callback function executed by Lely when an NMT command is received.
+ * @param cs The command specifier (e.g., CO_NMT_CS_RESET_NODE).
+ */
+static void on_nmt_cs(co_nmt_t *nmt, co_unsigned8_t cs, void *data) {
+    (void)nmt;
+    (void)data;
+
+    if (cs == CO_NMT_CS_RESET_NODE || cs == CO_NMT_CS_RESET_COMM) {
+        NVIC_SystemReset();
+    }
+}
+
+/**
+ * @brief TIME stamp service indication function.
+ * @note  This is a placeholder, as the Discovery board does not have a
+ *        battery-backed Real-Time Clock to be set.
+ */
+static void on_time(co_time_t *time, const struct timespec *tp, void *data)
+{
+	(void)time;
+	(void)tp;
+	(void)data;
+}
+
+/**
+ * @brief Callback function executed by Lely on an SDO read request for object 0x6064.
+ *        This function reads the actual motor position from the TMC5160 (the
+ *        encoder position if there is one) and provides it to the Lely stack
+ *        to be sent back to the master, in user position units.
+ */
+static co_unsigned32_t on_read_actual_pos(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub; // Unused
+    struct axis *ax = data;
+
+    co_unsigned32_t ac = 0; // Abort Code, 0 = success
+
+    int32_t actual_pos = factor_scale(&ax->factors.position_inv, actual_position(ax));
+
+    co_sdo_req_up_val(req, CO_DEFTYPE_INTEGER32, &actual_pos, &ac);
+
+    return ac;
+}
+
+/**
+ * @brief Callback executed by Lely on a read of the velocity actual value
+ *        (0x606C), by SDO or for the synchronous TPDO: VACTUAL in user
+ *        velocity units.
+ */
+static co_unsigned32_t on_read_velocity_actual(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    int32_t vactual = factor_scale(&ax->factors.velocity_inv, axis_sample(ax)->vactual);
+    co_sdo_req_up_val(req, CO_DEFTYPE_INTEGER32, &vactual, &ac);
+
+    return ac;
+}
+
+/**
+ * @brief Callback executed on SDO write to Target Position (0x607A)
+ */
+static co_unsigned32_t on_write_target_pos(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    int32_t target_pos;
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_INTEGER32, &target_pos, &ac) == -1) {
+        return ac;
+    }
+
+    // HANYA SIMPAN, tidak eksekusi
+    if (!process_target_position(ax, target_pos)) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief [STATE MACHINE] Updates the 'statusword' of an axis based on its current state.
+ *        This function also includes logic for other dynamic bits like 'Target Reached'.
+ */
+static void update_statusword(struct axis *ax) {
+    uint16_t base_sw = 0;
+
+    // 1. Tentukan status dasar berdasarkan State Machine (PDS State)
+    switch (ax->state) {
+        case PDS_STATE_NOT_READY_TO_SWITCH_ON:
+            base_sw = 0;
+            break;
+        case PDS_STATE_SWITCH_ON_DISABLED:
+            base_sw = SW_SWITCH_ON_DISABLED;
+            break;
+        case PDS_STATE_READY_TO_SWITCH_ON:
+            base_sw = SW_READY_TO_SWITCH_ON | SW_QUICK_STOP;
+            break;
+        case PDS_STATE_SWITCHED_ON:
+            base_sw = SW_READY_TO_SWITCH_ON | SW_SWITCHED_ON | SW_QUICK_STOP;
+            break;
+        case PDS_STATE_OPERATION_ENABLED:
+            base_sw = SW_READY_TO_SWITCH_ON | SW_SWITCHED_ON | SW_OPERATION_ENABLED | SW_QUICK_STOP | SW_VOLTAGE_ENABLED;
+            break;
+        case PDS_STATE_QUICK_STOP_ACTIVE:
+            base_sw = SW_READY_TO_SWITCH_ON | SW_SWITCHED_ON | SW_OPERATION_ENABLED;
+            break;
+        case PDS_STATE_FAULT_REACTION_ACTIVE:
+            base_sw = SW_READY_TO_SWITCH_ON | SW_SWITCHED_ON | SW_OPERATION_ENABLED | SW_FAULT;
+            break;
+        case PDS_STATE_FAULT:
+            base_sw = SW_FAULT;
+            break;
+    }
+
+    // 2. Logika Tambahan (Hanya jika drive aktif/Enabled)
+    if (ax->state == PDS_STATE_OPERATION_ENABLED) {
+        // A. Cek Status Fisik Hardware (Apakah motor berhenti?)
+        //    With set-points still buffered the final target is not reached yet.
+        //    While halted, bit 10 reports that the halt ramp has finished.
+        //    Homing runs in velocity mode, where the flag means nothing.
+        //    CSV runs in velocity mode, where the flag means nothing either.
+        //    In IP mode the last buffered point has to be taken as well.
+        uint32_t ramp_stat = axis_sample(ax)->ramp_stat;
+        if ((ramp_stat & RAMP_STAT_POSITION_REACHED) && (setpoint_count(&ax->setpoints) == 0 || ax->is_halted) &&
+            !homing_is_moving(&ax->homing) && !ax->is_velocity_mode && !is_motion_pending(ax) &&
+            (ax->mode_op != 7 || interpolation_count(&ax->ip) == 0 || ax->is_halted)) {
+            base_sw |= SW_TARGET_REACHED;
+        }
+
+        // B. Set-point acknowledge (Profile Position)
+        if (ax->mode_op == 1 && ax->is_setpoint_acknowledged) {
+            base_sw |= SW_SETPOINT_ACK;
+        }
+
+        // C. Cek Logika Khusus Mode Homing: bit 10 alone = not started or
+        //    interrupted, none = in progress, 10 + 12 = attained, 13 = error
+        if (ax->mode_op == 6) {
+            enum homing_status homing = homing_get_status(&ax->homing);
+            if (homing == HOMING_ATTAINED) {
+                base_sw |= SW_HOMING_ATTAINED | SW_TARGET_REACHED;
+            } else if (homing == HOMING_ERROR) {
+                base_sw |= SW_HOMING_ERROR;
+            }
+        }
+
+        // D. Cyclic Synchronous Velocity: bit 12 while the SYNCs are followed
+        if (ax->mode_op == 9 && !ax->is_halted && !ax->is_velocity_stopping) {
+            base_sw |= SW_FOLLOWING_VELOCITY;
+        }
+
+        // E. Interpolated Position: bit 12 while the interpolation runs
+        if (ax->mode_op == 7 && ax->ip.is_enabled) {
+            base_sw |= SW_IP_MODE_ACTIVE;
+        }
+
+        // F. Electronic gearing: bit 12 while the master position is followed
+        if (ax->mode_op == MODE_ELECTRONIC_GEARING && ax->is_gearing_engaged) {
+            base_sw |= SW_FOLLOWING_MASTER;
+        }
+    } else if (ax->state == PDS_STATE_QUICK_STOP_ACTIVE) {
+        // Quick stop ramp finished (option codes 5/6 stay in this state)
+        if ((axis_sample(ax)->ramp_stat & RAMP_STAT_POSITION_REACHED) && !homing_is_moving(&ax->homing) &&
+            !ax->is_velocity_mode) {
+            base_sw |= SW_TARGET_REACHED;
+        }
+    }
+
+    // 3. Update statusword
+    ax->statusword = base_sw;
+
+    // 4. Update OD (tapi TIDAK trigger TPDO di sini!)
+    // TPDO akan di-trigger secara manual di tempat yang tepat
+    co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x6041), 0x00, ax->statusword);
+}
+
+/**
+ * @brief Sends the current statusword on the TPDO1 of the axis (event-driven).
+ */
+static void send_statusword(struct axis *ax) {
+    co_tpdo_t *tpdo1 = axis_tpdo(ax, 1);
+
+    ax->tpdo_statusword = ax->statusword;
+    if (tpdo1) {
+        co_tpdo_event(tpdo1);
+    }
+}
+
+/**
+ * @brief [GLUE LOGIC] Callback executed on SDO read for Statusword (0x6041).
+ */
+static co_unsigned32_t on_read_statusword(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    struct axis *ax = data;
+
+    co_unsigned32_t ac = 0;
+
+    uint16_t sw_copy = ax->statusword;
+
+    // Sediakan nilai dari 'statusword' axis ini saat ini.
+    co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED16, &sw_copy, &ac);
+
+    return ac;
+}
+
+/**
+ * @brief [STATE MACHINE] Callback executed on SDO write to Controlword (0x6040).
+ *        This is the core of the CiA 402 state machine logic.
+ */
+static co_unsigned32_t on_write_controlword(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    uint16_t command;
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED16, &command, &ac) == -1) {
+        return ac;
+    }
+
+    co_sub_dn(sub, &command);
+
+    if (!process_controlword(ax, command)) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    return 0;
+}
+
+// Callback saat Master menulis ke 0x6060 (Modes of Operation)
+// Hapus 'const' pada parameter pertama (co_sub_t *sub)
+static co_unsigned32_t on_write_mode_op(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+    int8_t mode;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_INTEGER8, &mode, &ac) == -1) {
+        return ac;
+    }
+
+    co_sub_dn(sub, &mode);
+    process_mode_of_operation(ax, mode);
+
+    return 0;
+}
+
+/**
+ * @brief Reads the TMC5160 chopper/current settings from object 0x2000.
+ */
+static void read_driver_config(const struct axis *ax, struct tmc5160_driver_config *config) {
+    config->gconf = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x01);
+    config->chopconf = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x02);
+    config->ihold_irun = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x03);
+    config->tpowerdown = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x04);
+    config->tpwmthrs = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x05);
+}
+
+/**
+ * @brief Writes the ramp registers that differ from the ones in effect
+ *        (motion tick).
+ */
+static void write_ramp(struct axis *ax, const struct tmc5160_ramp *next_ramp) {
+    struct tmc5160_ramp next = *next_ramp;
+
+    if (!ax->is_ramp_written || next.vmax != ax->ramp.vmax) {
+        post_write(ax, TMC5160_VMAX, (int32_t)next.vmax);
+    }
+    if (!ax->is_ramp_written || next.v1 != ax->ramp.v1) {
+        post_write(ax, TMC5160_V1, (int32_t)next.v1);
+    }
+    if (!ax->is_ramp_written || next.a1 != ax->ramp.a1) {
+        post_write(ax, TMC5160_A1, (int32_t)next.a1);
+    }
+    if (!ax->is_ramp_written || next.amax != ax->ramp.amax) {
+        post_write(ax, TMC5160_AMAX, (int32_t)next.amax);
+    }
+    if (!ax->is_ramp_written || next.dmax != ax->ramp.dmax) {
+        post_write(ax, TMC5160_DMAX, (int32_t)next.dmax);
+    }
+    if (!ax->is_ramp_written || next.d1 != ax->ramp.d1) {
+        post_write(ax, TMC5160_D1, (int32_t)next.d1);
+    }
+
+    ax->ramp = next;
+    ax->is_ramp_written = true;
+}
+
+/**
+ * @brief Computes the ramp registers of a motion profile (0x6086, jerk limit
+ *        0x60A4:01) and writes those that differ from the ones in effect.
+ */
+static void apply_motion_profile(struct axis *ax, uint32_t velocity, uint32_t accel, uint32_t decel,
+                                 int16_t type, uint32_t jerk) {
+    motion_profile_compute(&ax->profile_ramp, type, velocity, accel, decel, jerk);
+    write_ramp(ax, &ax->profile_ramp);
+}
+
+/**
+ * @brief Configures the TMC5160 of an axis (driver settings from 0x2000,
+ *        encoder from 0x2002, motion profile) and zeroes its position
+ *        counters. An axis without a TMC5160 stays NOT READY TO SWITCH ON.
+ */
+static void configure_drive(struct axis *ax) {
+    flush_motion();
+    ax->is_present = tmc5160_is_present(&ax->drv);
+    if (!ax->is_present) {
+        return;
+    }
+
+    struct tmc5160_driver_config driver_config;
+    read_driver_config(ax, &driver_config);
+    tmc5160_init(&ax->drv, &driver_config);
+
+    tmc5160_write_register(&ax->drv, TMC5160_XACTUAL, 0);
+    configure_encoder(ax);
+
+    // --- Motion Profile Configuration ---
+    // Stored profile values (0x6081/0x6083/0x6084) if set, otherwise the defaults below
+    // (in TMC5160 units)
+    int32_t profile_velocity = factor_scale(&ax->factors.velocity, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x6081), 0x00));
+    uint32_t profile_accel = factor_scale_u32(&ax->factors.acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6083), 0x00));
+    uint32_t profile_decel = factor_scale_u32(&ax->factors.acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6084), 0x00));
+
+    ax->is_ramp_written = false;
+    apply_motion_profile(ax, (profile_velocity > 0) ? (uint32_t)profile_velocity : 51200,
+                         profile_accel ? profile_accel : 1000,
+                         profile_decel ? profile_decel : 1000,
+                         co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x6086), 0x00),
+                         factor_scale_u32(&ax->factors.position, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x60A4), 0x01)));
+    tmc5160_write_register(&ax->drv, TMC5160_VSTOP, 100);
+
+    // Add a zero-wait time for smooth direction reversals
+    tmc5160_write_register(&ax->drv, TMC5160_TZEROWAIT, 5000);
+
+    // Set RAMPMODE to Positioning Mode
+    tmc5160_write_register(&ax->drv, TMC5160_RAMPMODE, 0);
+
+    // Reference switch polarity and the touch probe latches (SW_MODE)
+    ax->is_touch_probe_pending = false;
+    touch_probe_configure(&ax->touch_probe, co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x60B8), 0x00), switch_polarity(ax));
+
+    ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+}
+
+/**
+ * @brief Callback executed on SDO write to the TMC5160 driver configuration
+ *        (0x2000:01..05). The new value is applied to the driver immediately.
+ */
+static co_unsigned32_t on_write_driver_config(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    // Default download, including the range check against the OD limits
+    if (co_sub_on_dn(sub, req, &ac) == -1) {
+        return ac;
+    }
+
+    // Written by the motion tick, after the accesses already posted
+    if (ax->is_present) {
+        read_driver_config(ax, &ax->drv.config);
+        post_command(ax, &(struct motion_command){
+            .drv = &ax->drv,
+            .posted = boot_time_cycles(),
+            .type = MOTION_COMMAND_CONFIGURE,
+        });
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Core logic untuk memproses Controlword
+ * @param command Nilai Controlword yang baru
+ * @return true jika berhasil, false jika ditolak
+ */
+static bool process_controlword(struct axis *ax, uint16_t command) {
+    // No TMC5160 on this chip select: the axis stays NOT READY TO SWITCH ON
+    if (!ax->is_present) {
+        return false;
+    }
+
+    // --- HOMING MODE ---
+    // A rising edge of bit 4 starts the homing method (0x6098), a falling
+    // edge interrupts it with the ramp of the halt option code.
+    if (ax->mode_op == 6 && ax->state == PDS_STATE_OPERATION_ENABLED) {
+        bool bit4_previous = (ax->previous_controlword & CW_NEW_SETPOINT) != 0;
+        bool bit4_current = (command & CW_NEW_SETPOINT) != 0;
+
+        if (!bit4_previous && bit4_current && !(command & CW_HALT) && !homing_is_moving(&ax->homing)) {
+            start_homing(ax);
+        } else if (bit4_previous && !bit4_current && homing_is_moving(&ax->homing)) {
+            start_stop_ramp(ax, stop_deceleration(ax, co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x605D), 0x00)));
+        }
+    }
+
+    if (ax->mode_op != 6) {
+        ax->statusword &= ~(1 << 12);
+        co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x6041), 0x00, ax->statusword);
+    }
+
+    // --- HALT (bit 8) ---
+    // The motion stops with the ramp of the halt option code and continues
+    // to the same target when bit 8 drops again. Homing is interrupted; CSV
+    // follows the SYNCs again, IP the buffered points (below), electronic
+    // gearing the master position (poll_gearing()).
+    if ((ax->mode_op == 1 || ax->mode_op == 6 || ax->mode_op == 7 || ax->mode_op == 9 ||
+         ax->mode_op == MODE_ELECTRONIC_GEARING) &&
+        ax->state == PDS_STATE_OPERATION_ENABLED &&
+        (command & CW_MASK_SWITCH_ON) == CW_CMD_ENABLE_OP) {
+        bool halt = (command & CW_HALT) != 0;
+        if (halt && !ax->is_halted) {
+            ax->is_halted = true;
+            start_stop_ramp(ax, stop_deceleration(ax, co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x605D), 0x00)));
+        } else if (!halt && ax->is_halted) {
+            ax->is_halted = false;
+            if (ax->is_move_active) {
+                execute_setpoint(ax, &ax->active_setpoint);
+            }
+        }
+    }
+
+    // --- INTERPOLATED POSITION MODE ---
+    // Bit 4 enables the interpolation: the buffered points are followed
+    // while it is set, and the motor stops at the last point taken when it
+    // drops. After a halt the interpolation goes on from where it stopped.
+    if (ax->mode_op == 7 && ax->state == PDS_STATE_OPERATION_ENABLED &&
+        (command & CW_MASK_SWITCH_ON) == CW_CMD_ENABLE_OP) {
+        bool enable = (command & CW_NEW_SETPOINT) && !ax->is_halted;
+        if (enable && !ax->ip.is_enabled) {
+            start_interpolation(ax);
+        } else if (!enable) {
+            stop_interpolation(ax);
+        }
+    }
+
+    // --- PROFILE POSITION MODE - DETEKSI RISING EDGE BIT 4 ---
+    // Set-point handshake: a rising edge of bit 4 hands a set-point to the
+    // drive and sets the set-point acknowledge (statusword bit 12). Bit 12
+    // drops once the master clears bit 4 and the buffer has room again.
+	if (ax->mode_op == 1) {  // Profile Position Mode
+		bool bit4_previous = (ax->previous_controlword & CW_NEW_SETPOINT) != 0;
+		bool bit4_current = (command & CW_NEW_SETPOINT) != 0;
+
+		// Rising edge terdeteksi: 0 → 1
+		if (!bit4_previous && bit4_current && ax->state == PDS_STATE_OPERATION_ENABLED) {
+			accept_setpoint(ax, command);
+		}
+	}
+
+    // --- STATE MACHINE TRANSITIONS ---
+    bool is_shutdown = (command & CW_MASK_SHUTDOWN) == CW_CMD_SHUTDOWN;
+    bool is_switch_on = (command & CW_MASK_SWITCH_ON) == CW_CMD_SWITCH_ON;
+    bool is_enable_op = (command & CW_MASK_SWITCH_ON) == CW_CMD_ENABLE_OP;
+    bool is_disable_voltage = (command & CW_MASK_DISABLE_VOLTAGE) == CW_CMD_DISABLE_VOLTAGE;
+    bool is_quick_stop = (command & CW_MASK_QUICK_STOP) == CW_CMD_QUICK_STOP;
+    bool is_fault_reset = (command & CW_CMD_FAULT_RESET) && !(ax->previous_controlword & CW_CMD_FAULT_RESET);
+
+    switch (ax->state) {
+        case PDS_STATE_SWITCH_ON_DISABLED:
+            if (is_shutdown) {
+                ax->state = PDS_STATE_READY_TO_SWITCH_ON;
+            }
+            break;
+
+        case PDS_STATE_READY_TO_SWITCH_ON:
+            if (is_switch_on) {
+                ax->state = PDS_STATE_SWITCHED_ON;
+            } else if (is_disable_voltage || is_quick_stop) {
+                ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+            }
+            break;
+
+        case PDS_STATE_SWITCHED_ON:
+            if (is_enable_op) {
+                align_position(ax);
+                ax->state = PDS_STATE_OPERATION_ENABLED;
+                post_driver_enabled(ax, true);
+            } else if (is_shutdown) {
+                ax->state = PDS_STATE_READY_TO_SWITCH_ON;
+            } else if (is_disable_voltage || is_quick_stop) {
+                ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+            }
+            break;
+
+        case PDS_STATE_OPERATION_ENABLED:
+            if (is_quick_stop) {
+                start_quick_stop(ax);
+            } else if (is_switch_on) {  // Disable operation
+                disable_operation(ax, PDS_STATE_SWITCHED_ON);
+            } else if (is_shutdown) {
+                disable_operation(ax, PDS_STATE_READY_TO_SWITCH_ON);
+            } else if (is_disable_voltage) {
+                disable_operation(ax, PDS_STATE_SWITCH_ON_DISABLED);
+            }
+            break;
+
+        case PDS_STATE_QUICK_STOP_ACTIVE:
+            // Back to operation only for the option codes that stay here
+            if (is_disable_voltage) {
+                ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+                post_driver_enabled(ax, false);
+                leave_velocity_mode(ax);
+            } else if (is_enable_op && ax->quick_stop_option >= STOP_OPTION_STAY_SLOW_DOWN) {
+                align_position(ax);
+                ax->state = PDS_STATE_OPERATION_ENABLED;
+            }
+            break;
+
+        case PDS_STATE_FAULT:
+            if (is_fault_reset) {
+                post_write(ax, TMC5160_GSTAT, GSTAT_DRIVER_FAULTS);  // Write 1 to clear
+                clear_errors(ax, ax->errors);
+                ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+            }
+            break;
+
+        default:
+            // FAULT REACTION ACTIVE ignores commands until the drive has stopped
+            break;
+    }
+
+    ax->previous_controlword = command;
+    release_setpoint_ack(ax);
+
+    update_statusword(ax);
+
+    // ← TAMBAHAN BARU: Trigger TPDO setelah state transition
+    send_statusword(ax);
+    return true;
+}
+
+/**
+ * @brief Core logic untuk memproses Mode of Operation
+ * @param mode Mode baru (1=PP, 6=Homing, dll)
+ */
+static void process_mode_of_operation(struct axis *ax, int8_t mode) {
+    // Entering homing mode starts a new homing cycle: 'homing attained'
+    // (bit 12) only reports a homing run in this mode.
+    if (mode == 6 && ax->mode_op != 6) {
+        homing_reset(&ax->homing);
+    } else if (mode != 6 && homing_is_moving(&ax->homing) && homing_abort(&ax->homing)) {
+        post_call(ax, &stop_homing, &ax->homing, (int32_t)stop_deceleration(ax, STOP_OPTION_QUICK_STOP),
+                  HOMING_LOAD_DATAGRAMS);
+    }
+    // Leaving IP: the motor stops at the last point taken
+    if (mode != 7) {
+        stop_interpolation(ax);
+    }
+    // Entering electronic gearing: the next master position is taken as it is
+    if (mode == MODE_ELECTRONIC_GEARING && ax->mode_op != MODE_ELECTRONIC_GEARING) {
+        gearing_reset(&ax->gearing);
+    }
+    // Leaving CSV: the velocity mode motion ramps down with the quick stop deceleration
+    if (mode != 9 && ax->is_velocity_mode && !ax->is_velocity_stopping) {
+        stop_velocity_mode(ax, stop_deceleration(ax, STOP_OPTION_QUICK_STOP));
+    }
+    // Buffered set-points and the halt belong to Profile Position mode
+    if (mode != 1) {
+        setpoint_clear(&ax->setpoints);
+        ax->is_move_active = false;
+        ax->is_halted = false;
+    }
+    ax->mode_op = mode;
+
+    co_sub_t *sub_disp = (co_sub_t *)co_dev_find_sub(dev, AXIS_OBJ(ax, 0x6061), 0x00);
+    if (sub_disp) {
+        co_sub_set_val_i8(sub_disp, mode);
+    }
+}
+
+/**
+ * @brief Menyimpan target position baru ke OD, TANPA menggerakkan motor
+ * @param target_pos Posisi target dalam pulses
+ * @return true jika diterima, false jika ditolak
+ */
+static bool process_target_position(struct axis *ax, int32_t target_pos) {
+    if (ax->state != PDS_STATE_OPERATION_ENABLED) {
+        return false;
+    }
+
+    // Hanya simpan ke Object Dictionary, BELUM gerakkan motor
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x607A), 0x00, target_pos);
+
+    // Clear bit Target Reached karena ada setpoint baru (belum dieksekusi)
+    ax->statusword &= ~SW_TARGET_REACHED;
+    co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x6041), 0x00, ax->statusword);
+
+    return true;
+}
+
+/**
+ * @brief Takes the set-point in 0x607A/0x6081/0x6083/0x6084 (with the
+ *        profile type 0x6086 and jerk 0x60A4:01), converted from user units
+ *        by the factor group, on a rising edge of controlword bit 4. With bit 5 (change set immediately) or when
+ *        idle it is executed at once, otherwise it waits in the buffer.
+ * @note  A full buffer does not acknowledge it; bit 12 is still set from the
+ *        previous set-point then, so the master waits before sending it.
+ */
+static void accept_setpoint(struct axis *ax, uint16_t command) {
+    const struct factor_group *f = &ax->factors;
+    struct setpoint sp = {
+        .target = factor_scale(&f->position, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x607A), 0x00)),
+        .velocity = factor_scale(&f->velocity, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x6081), 0x00)),
+        .accel = factor_scale_u32(&f->acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6083), 0x00)),
+        .decel = factor_scale_u32(&f->acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6084), 0x00)),
+        .profile_type = co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x6086), 0x00),
+        .jerk = factor_scale_u32(&f->position, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x60A4), 0x01)),
+        .blend = (command & CW_CHANGE_ON_SETPOINT) != 0,
+    };
+
+    if ((command & CW_CHANGE_IMMEDIATELY) || !ax->is_move_active) {
+        setpoint_clear(&ax->setpoints);
+        ax->is_setpoint_acknowledged = true;
+        if (ax->is_halted) {
+            // Started when the halt is released
+            ax->active_setpoint = sp;
+            ax->is_move_active = true;
+        } else {
+            execute_setpoint(ax, &sp);  // SEKARANG baru eksekusi!
+        }
+    } else if (setpoint_push(&ax->setpoints, &sp)) {
+        ax->is_setpoint_acknowledged = true;
+    }
+}
+
+/**
+ * @brief Clears the set-point acknowledge once the master has dropped bit 4
+ *        and the buffer can take another set-point.
+ */
+static void release_setpoint_ack(struct axis *ax) {
+    if (ax->is_setpoint_acknowledged && !(ax->previous_controlword & CW_NEW_SETPOINT) && !setpoint_is_full(&ax->setpoints)) {
+        ax->is_setpoint_acknowledged = false;
+    }
+}
+
+/**
+ * @brief EKSEKUSI gerakan ke target position dari set-point
+ */
+static void execute_setpoint(struct axis *ax, const struct setpoint *sp) {
+    // ✨ Apply parameter ke TMC5160 (jika tidak 0)
+    // Kita cek != 0 karena default value di OD adalah 0
+    apply_motion_profile(ax, (sp->velocity > 0) ? (uint32_t)sp->velocity : ax->profile_ramp.vmax,
+                         sp->accel ? sp->accel : ax->profile_ramp.amax,
+                         sp->decel ? sp->decel : ax->profile_ramp.dmax,
+                         sp->profile_type, sp->jerk);
+
+    // EKSEKUSI gerakan fisik. A new XTARGET while moving is taken on the fly
+    // by the ramp generator, which only brakes if the target requires it.
+    post_write(ax, TMC5160_XTARGET, sp->target);
+    ax->active_setpoint = *sp;
+    ax->is_move_active = true;
+
+    // Start of a new move of axis 1 is the scope trigger
+    if (ax->n == 0) {
+        scope_trigger();
+    }
+
+    // Clear bit Target Reached karena gerakan baru dimulai; the same TPDO
+    // carries the set-point acknowledge.
+    ax->statusword &= ~SW_TARGET_REACHED;
+    if (ax->is_setpoint_acknowledged) {
+        ax->statusword |= SW_SETPOINT_ACK;
+    }
+    co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x6041), 0x00, ax->statusword);
+
+    // Trigger TPDO untuk broadcast perubahan status. Sent even when the move
+    // is already complete in the next poll, so the master sees the bit drop.
+    send_statusword(ax);
+}
+
+/**
+ * @brief Whether the next set-point should take over before the active
+ *        target is reached: it continues in the same direction and the
+ *        ramp would start braking for the active target within about 1 ms.
+ * @param xactual Current position (XACTUAL).
+ * @param vactual Current velocity (VACTUAL, sign-extended).
+ * @param next    The next set-point.
+ */
+static bool is_blend_point(struct axis *ax, int32_t xactual, int32_t vactual, const struct setpoint *next) {
+    int64_t remaining = (int64_t)ax->active_setpoint.target - xactual;
+    int64_t beyond = (int64_t)next->target - ax->active_setpoint.target;
+
+    // A reversal has to stop at the target anyway
+    if (remaining == 0 || beyond == 0 || (remaining > 0) != (beyond > 0)) {
+        return false;
+    }
+
+    // Braking distance of the ramp in effect (DMAX, and D1 below V1), plus 1 ms of travel
+    int64_t speed = (vactual < 0) ? -(int64_t)vactual : vactual;
+    int64_t brake = motion_profile_brake_distance(&ax->ramp, (uint32_t)speed);
+    int64_t margin = (speed * (TMC5160_FCLK / 1000)) >> 24;
+
+    return ((remaining < 0) ? -remaining : remaining) <= brake + margin;
+}
+
+/**
+ * @brief Feeds the next buffered set-point to the ramp generator when the
+ *        active one is reached, or earlier for a blended set-point (bit 9),
+ *        so consecutive segments run through without stopping.
+ */
+static void poll_setpoints(struct axis *ax) {
+    if (!ax->is_move_active || ax->is_halted || ax->mode_op != 1 || ax->state != PDS_STATE_OPERATION_ENABLED) {
+        return;
+    }
+
+    const struct setpoint *next = setpoint_peek(&ax->setpoints);
+    const struct axis_sample *sample = axis_sample(ax);
+
+    bool reached = (sample->ramp_stat & RAMP_STAT_POSITION_REACHED) != 0;
+    if (next == NULL) {
+        ax->is_move_active = !reached;
+        return;
+    }
+
+    if (reached || (next->blend && is_blend_point(ax, sample->xactual, sample->vactual, next))) {
+        struct setpoint sp;
+        setpoint_pop(&ax->setpoints, &sp);
+        release_setpoint_ack(ax);
+        execute_setpoint(ax, &sp);
+    }
+}
+
+/**
+ * @brief Deceleration of a halt or quick stop option code: the profile
+ *        deceleration (0x6084) for the slow down ramp, otherwise the quick
+ *        stop deceleration (0x6085).
+ */
+static uint32_t stop_deceleration(const struct axis *ax, int16_t option) {
+    if (option == STOP_OPTION_SLOW_DOWN || option == STOP_OPTION_STAY_SLOW_DOWN) {
+        return ax->profile_ramp.dmax;
+    }
+    uint32_t decel = factor_scale_u32(&ax->factors.acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6085), 0x00));
+    return decel ? decel : ax->profile_ramp.dmax;
+}
+
+/**
+ * @brief Brings the motor to rest with a linear ramp of 'decel': loads it
+ *        into AMAX/DMAX/D1 and moves XTARGET to where that ramp ends, as
+ *        seen by the motion tick. The motion profile is written again with
+ *        the next set-point.
+ */
+static void start_stop_ramp(struct axis *ax, uint32_t decel) {
+    struct tmc5160_ramp stop;
+
+    // No more points: the ramp below ends short of the last one taken
+    stop_interpolation(ax);
+
+    // Homing moves in velocity mode, which stops with AMAX = 'decel'
+    if (homing_is_moving(&ax->homing)) {
+        if (homing_abort(&ax->homing)) {
+            post_call(ax, &stop_homing, &ax->homing, (int32_t)decel, HOMING_LOAD_DATAGRAMS);
+        }
+        return;
+    }
+    if (ax->is_velocity_mode) {
+        stop_velocity_mode(ax, decel);
+        return;
+    }
+
+    motion_profile_stop_ramp(&stop, ax->profile_ramp.vmax, decel);
+    write_ramp(ax, &stop);
+
+    // XTARGET from XACTUAL/VACTUAL when the tick gets to it, never past the
+    // target the motor was heading for
+    post_command(ax, &(struct motion_command){
+        .drv = &ax->drv,
+        .posted = boot_time_cycles(),
+        .type = MOTION_COMMAND_STOP,
+        .value = (int32_t)decel,
+    });
+}
+
+/**
+ * @brief Quick stop command in OPERATION ENABLED: stops with the ramp of the
+ *        quick stop option code (0x605A). Buffered set-points are dropped.
+ */
+static void start_quick_stop(struct axis *ax) {
+    ax->quick_stop_option = co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x605A), 0x00);
+
+    setpoint_clear(&ax->setpoints);
+    ax->is_move_active = false;
+    ax->is_halted = false;
+
+    if (ax->quick_stop_option == STOP_OPTION_DISABLE_DRIVE) {
+        stop_interpolation(ax);
+        ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+        post_driver_enabled(ax, false);
+        leave_velocity_mode(ax);
+        return;
+    }
+
+    ax->state = PDS_STATE_QUICK_STOP_ACTIVE;
+    start_stop_ramp(ax, stop_deceleration(ax, ax->quick_stop_option));
+}
+
+/**
+ * @brief Leaves OPERATION ENABLED without a stop ramp (disable operation,
+ *        shutdown, disable voltage): the power stage goes off and the motion
+ *        of every mode is dropped.
+ */
+static void disable_operation(struct axis *ax, pds_state_t state) {
+    ax->state = state;
+    post_driver_enabled(ax, false);
+
+    stop_interpolation(ax);
+    setpoint_clear(&ax->setpoints);
+    ax->is_move_active = false;
+    ax->is_halted = false;
+    if (homing_abort(&ax->homing)) {
+        post_call(ax, &stop_homing, &ax->homing, (int32_t)stop_deceleration(ax, STOP_OPTION_QUICK_STOP),
+                  HOMING_LOAD_DATAGRAMS);
+    }
+    leave_velocity_mode(ax);
+}
+
+/**
+ * @brief Fault reaction: a drive with the power stage on stops with the
+ *        quick stop deceleration (0x6085) in FAULT REACTION ACTIVE and then
+ *        enters FAULT with the power stage off (see poll_stop()).
+ * @param errors DRIVE_ERROR_BIT()s of the cause, reported by EMCY until the
+ *               fault reset; 0 if the stack reports it (heartbeat loss).
+ */
+static void enter_fault(struct axis *ax, uint32_t errors) {
+    if (ax->state == PDS_STATE_FAULT || ax->state == PDS_STATE_FAULT_REACTION_ACTIVE) {
+        return;
+    }
+    raise_errors(ax, errors, 0);
+
+    setpoint_clear(&ax->setpoints);
+    ax->is_move_active = false;
+    ax->is_halted = false;
+
+    if (ax->state == PDS_STATE_OPERATION_ENABLED || ax->state == PDS_STATE_QUICK_STOP_ACTIVE) {
+        ax->state = PDS_STATE_FAULT_REACTION_ACTIVE;
+        start_stop_ramp(ax, stop_deceleration(ax, STOP_OPTION_QUICK_STOP));
+    } else {
+        ax->state = PDS_STATE_FAULT;
+        post_driver_enabled(ax, false);
+    }
+
+    update_statusword(ax);
+    send_statusword(ax);
+}
+
+/**
+ * @brief Completes a quick stop or fault reaction once the stop ramp has
+ *        reached its target.
+ */
+static void poll_stop(struct axis *ax) {
+    if (ax->state != PDS_STATE_QUICK_STOP_ACTIVE && ax->state != PDS_STATE_FAULT_REACTION_ACTIVE) {
+        return;
+    }
+    if (homing_is_moving(&ax->homing) || ax->is_velocity_mode ||
+        !(axis_sample(ax)->ramp_stat & RAMP_STAT_POSITION_REACHED)) {
+        return;
+    }
+
+    if (ax->state == PDS_STATE_FAULT_REACTION_ACTIVE) {
+        ax->state = PDS_STATE_FAULT;
+        post_driver_enabled(ax, false);
+    } else if (ax->quick_stop_option < STOP_OPTION_STAY_SLOW_DOWN) {
+        ax->state = PDS_STATE_SWITCH_ON_DISABLED;
+        post_driver_enabled(ax, false);
+    }
+}
+
+/**
+ * @brief Reports the errors of the TMC5160 by EMCY and enters the fault
+ *        reaction on a driver error or uv_cp while the power stage is on.
+ *
+ * GSTAT and DRV_STATUS are read only when the SPI status byte of the last
+ * datagram, e.g. of the motion tick's sample, shows drv_err or the reset
+ * flag; there is no periodic read competing with the tick for SPI1. The
+ * warnings (overtemperature pre-warning, open load) and uv_cp are not in
+ * the status byte and are therefore taken from those reads only; the fault
+ * reset ends them as well. The reset flag is cleared after its read so
+ * that it can trigger again.
+ */
+static void poll_driver_faults(struct axis *ax) {
+    static const uint8_t addresses[] = { TMC5160_GSTAT, TMC5160_DRV_STATUS };
+    bool is_powered = (ax->state == PDS_STATE_OPERATION_ENABLED || ax->state == PDS_STATE_QUICK_STOP_ACTIVE ||
+                       ax->state == PDS_STATE_FAULT_REACTION_ACTIVE);
+    uint8_t status = ax->drv.status;
+    bool is_new_fault = is_powered && (status & TMC5160_SPI_STATUS_DRIVER_ERROR) &&
+                        !(ax->errors & ~DRIVE_ERROR_WARNINGS);
+    bool is_reset = (status & TMC5160_SPI_STATUS_RESET) != 0;
+
+    if (!is_reset) {
+        ax->is_reset_flag_cleared = false;
+    }
+    if (!is_new_fault && (!is_reset || ax->is_reset_flag_cleared)) {
+        return;
+    }
+    if (is_reset) {
+        post_write(ax, TMC5160_GSTAT, TMC5160_GSTAT_RESET);  // Write 1 to clear
+        ax->is_reset_flag_cleared = true;
+    }
+
+    int32_t regs[2];
+    tmc5160_read_registers(&ax->drv, addresses, regs, 2);
+    uint32_t drv_status = (uint32_t)regs[1];
+    uint32_t errors = drive_error_decode((uint32_t)regs[0], drv_status);
+
+    clear_errors(ax, ax->errors & DRIVE_ERROR_WARNINGS & ~errors);
+    if (!is_powered) {
+        errors &= DRIVE_ERROR_WARNINGS;
+    }
+    raise_errors(ax, errors, drv_status);
+    if (errors & ~DRIVE_ERROR_WARNINGS) {
+        enter_fault(ax, 0);
+    }
+}
+
+/**
+ * @brief Pushes an EMCY for each of 'errors' the axis does not report yet;
+ *        Lely sends it and spaces the messages by the inhibit time (0x1015).
+ *        The manufacturer field carries the axis (1-4) and DRV_STATUS.
+ */
+static void raise_errors(struct axis *ax, uint32_t errors, uint32_t drv_status) {
+    co_emcy_t *emcy = co_nmt_get_emcy(nmt);
+    const co_unsigned8_t msef[5] = {
+        (co_unsigned8_t)(ax->n + 1), (co_unsigned8_t)drv_status, (co_unsigned8_t)(drv_status >> 8),
+        (co_unsigned8_t)(drv_status >> 16), (co_unsigned8_t)(drv_status >> 24),
+    };
+
+    errors &= ~ax->errors;
+    if (errors == 0) {
+        return;
+    }
+    for (int e = 0; e < DRIVE_ERROR_COUNT; e++) {
+        if (!(errors & DRIVE_ERROR_BIT(e))) {
+            continue;
+        }
+        const struct drive_error_code *error = drive_error_code((enum drive_error)e);
+        if (emcy) {
+            co_emcy_push(emcy, error->code, error->error_register, msef);
+        }
+        co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x603F), 0x00, error->code);
+        ax->errors |= DRIVE_ERROR_BIT(e);
+
+        memmove(&active_errors[1], &active_errors[0], active_error_count * sizeof(active_errors[0]));
+        active_errors[0] = (struct active_error){
+            .code = error->code,
+            .error_register = error->error_register,
+            .axis = (uint8_t)ax->n,
+        };
+        memcpy(active_errors[0].msef, msef, sizeof(msef));
+        active_error_count++;
+    }
+}
+
+/**
+ * @brief Takes the error 'code' of the axis off the active errors. Lely's
+ *        error stack keeps it until rebuild_error_stack().
+ */
+static void emcy_remove(const struct axis *ax, co_unsigned16_t code) {
+    size_t i = 0;
+
+    while (i < active_error_count && (active_errors[i].code != code || active_errors[i].axis != ax->n)) {
+        i++;
+    }
+    if (i == active_error_count) {
+        return;
+    }
+    active_error_count--;
+    memmove(&active_errors[i], &active_errors[i + 1], (active_error_count - i) * sizeof(active_errors[0]));
+}
+
+/**
+ * @brief Rebuilds Lely's error stack from the active errors after some
+ *        went. Popping the stack empty sends the 'error reset' EMCY; the
+ *        communication errors (0x81xx) and the active errors, oldest first,
+ *        are then pushed again. Every EMCY goes through Lely and keeps to
+ *        the inhibit time (0x1015), and 0x1001 and 0x1003 follow the stack.
+ */
+static void rebuild_error_stack(void) {
+    co_emcy_t *emcy = co_nmt_get_emcy(nmt);
+    co_unsigned16_t communication[COMMUNICATION_ERROR_MAX];
+    co_unsigned8_t communication_er[COMMUNICATION_ERROR_MAX];
+    size_t count = 0;
+    co_unsigned16_t eec;
+    co_unsigned8_t er;
+
+    if (!emcy) {
+        return;
+    }
+    co_emcy_peek(emcy, &eec, NULL);
+    while (eec != 0) {
+        co_emcy_pop(emcy, &eec, &er);
+        if ((eec & EEC_COMMUNICATION_MASK) == EEC_COMMUNICATION && count < COMMUNICATION_ERROR_MAX) {
+            communication[count] = eec;
+            communication_er[count] = er;
+            count++;
+        }
+        co_emcy_peek(emcy, &eec, NULL);
+    }
+
+    while (count > 0) {
+        count--;
+        co_emcy_push(emcy, communication[count], communication_er[count], NULL);
+    }
+    for (size_t i = active_error_count; i > 0; i--) {
+        const struct active_error *error = &active_errors[i - 1];
+        co_emcy_push(emcy, error->code, error->error_register, error->msef);
+    }
+}
+
+/**
+ * @brief Ends the report of 'errors' of the axis: off the EMCY error stack
+ *        and out of the error code (0x603F), which then shows the error
+ *        left, if any.
+ */
+static void clear_errors(struct axis *ax, uint32_t errors) {
+    errors &= ax->errors;
+    if (errors == 0) {
+        return;
+    }
+
+    co_unsigned16_t code = 0;
+    for (int e = 0; e < DRIVE_ERROR_COUNT; e++) {
+        if (errors & DRIVE_ERROR_BIT(e)) {
+            emcy_remove(ax, drive_error_code((enum drive_error)e)->code);
+            ax->errors &= ~DRIVE_ERROR_BIT(e);
+        } else if (ax->errors & DRIVE_ERROR_BIT(e)) {
+            code = drive_error_code((enum drive_error)e)->code;
+        }
+    }
+    rebuild_error_stack();
+    co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x603F), 0x00, code);
+}
+
+/**
+ * @brief MOTION_COMMAND_CALL of start_homing(): loads step 'value' of the
+ *        run in the tick.
+ */
+static void load_homing(void *context, int32_t value) {
+    homing_load(context, (unsigned int)value);
+}
+
+/**
+ * @brief MOTION_COMMAND_CALL of an interrupted homing run: 'value' is the
+ *        deceleration.
+ */
+static void stop_homing(void *context, int32_t value) {
+    homing_load_stop(context, (uint32_t)value);
+}
+
+/**
+ * @brief Starts the homing method (0x6098) with the speeds (0x6099), the
+ *        acceleration (0x609A) and the home offset (0x607C), all in user
+ *        units. Speeds and acceleration of 0 take the values of the motion
+ *        profile.
+ */
+static void start_homing(struct axis *ax) {
+    const struct factor_group *f = &ax->factors;
+    int32_t fast = factor_scale(&f->velocity, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x6099), 0x01));
+    int32_t slow = factor_scale(&f->velocity, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x6099), 0x02));
+    uint32_t accel = factor_scale_u32(&f->acceleration, co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x609A), 0x00));
+
+    struct homing_config config = {
+        .method = co_dev_get_val_i8(dev, AXIS_OBJ(ax, 0x6098), 0x00),
+        .fast = (fast > 0) ? (uint32_t)fast : ax->profile_ramp.vmax,
+        .slow = (slow > 0) ? (uint32_t)slow : ax->profile_ramp.vmax / 8,
+        .accel = accel ? accel : ax->profile_ramp.amax,
+        .offset = factor_scale(&f->position, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x607C), 0x00)),
+        .sgt = co_dev_get_val_i8(dev, AXIS_OBJ(ax, 0x2001), 0x01),
+        .switch_polarity = co_dev_get_val_u8(dev, AXIS_OBJ(ax, 0x2001), 0x02),
+        .gconf = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2000), 0x01),
+    };
+
+    // Homing loads its own ramp; the next set-point writes the profile again
+    ax->is_ramp_written = false;
+    ax->is_move_active = false;
+    if (homing_start(&ax->homing, &config)) {
+        for (unsigned int step = 0; step < HOMING_LOAD_STEPS; step++) {
+            post_call(ax, &load_homing, &ax->homing, (int32_t)step, HOMING_LOAD_DATAGRAMS);
+        }
+    }
+
+    // The current position methods set XACTUAL at once
+    if (homing_get_status(&ax->homing) == HOMING_ATTAINED) {
+        sync_encoder(ax);
+    }
+
+    update_statusword(ax);
+    send_statusword(ax);
+}
+
+/**
+ * @brief Advances a homing run and publishes the StallGuard2 value of a
+ *        StallGuard homing in 0x2001:03 when it ends.
+ */
+static void poll_homing(struct axis *ax) {
+    // Until the tick has loaded the search, the TMC5160 shows the old motion
+    if (!homing_is_moving(&ax->homing) || is_motion_pending(ax)) {
+        return;
+    }
+
+    homing_poll(&ax->homing);
+    if (!homing_is_moving(&ax->homing)) {
+        co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x2001), 0x03, homing_sg_result(&ax->homing));
+        if (homing_get_status(&ax->homing) == HOMING_ATTAINED) {
+            sync_encoder(ax);
+        }
+
+        // Homing has used SW_MODE and the latch: arm the touch probes again
+        ax->is_touch_probe_pending = false;
+        touch_probe_configure(&ax->touch_probe, co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x60B8), 0x00), switch_polarity(ax));
+        publish_touch_probe(ax);
+    }
+}
+
+/**
+ * @brief SW_MODE polarity bits of the reference inputs (0x2001:02).
+ */
+static uint32_t switch_polarity(const struct axis *ax) {
+    uint8_t polarity = co_dev_get_val_u8(dev, AXIS_OBJ(ax, 0x2001), 0x02);
+    uint32_t sw_mode = 0;
+
+    if (polarity & HOMING_SWITCH_REFL_ACTIVE_LOW) {
+        sw_mode |= TMC5160_SW_MODE_POL_STOP_L;
+    }
+    if (polarity & HOMING_SWITCH_REFR_ACTIVE_LOW) {
+        sw_mode |= TMC5160_SW_MODE_POL_STOP_R;
+    }
+    return sw_mode;
+}
+
+/**
+ * @brief Callback executed on SDO write to the touch probe function
+ *        (0x60B8) or the input polarity (0x2001:02): the latches are armed
+ *        by poll_touch_probe().
+ */
+static co_unsigned32_t on_write_touch_probe(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    if (co_sub_on_dn(sub, req, &ac) == -1) {
+        return ac;
+    }
+
+    ax->is_touch_probe_pending = true;
+    return 0;
+}
+
+/**
+ * @brief Copies the touch probe status and positions (0x60B9-0x60BD, in
+ *        user units) into the Object Dictionary and sends them on the
+ *        TPDO3/TPDO4 of the axis.
+ */
+static void publish_touch_probe(struct axis *ax) {
+    const struct factor *f = &ax->factors.position_inv;
+
+    co_dev_set_val_u16(dev, AXIS_OBJ(ax, 0x60B9), 0x00, touch_probe_status(&ax->touch_probe));
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60BA), 0x00, factor_scale(f, touch_probe_value(&ax->touch_probe, 0, false)));
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60BB), 0x00, factor_scale(f, touch_probe_value(&ax->touch_probe, 0, true)));
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60BC), 0x00, factor_scale(f, touch_probe_value(&ax->touch_probe, 1, false)));
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60BD), 0x00, factor_scale(f, touch_probe_value(&ax->touch_probe, 1, true)));
+
+    for (int n = 3; n <= 4; n++) {
+        co_tpdo_t *tpdo = axis_tpdo(ax, n);
+        if (tpdo) {
+            co_tpdo_event(tpdo);
+        }
+    }
+}
+
+/**
+ * @brief Arms the latches after a write of the touch probe function, and
+ *        takes a position latched by the TMC5160 on a touch probe edge.
+ *        The position is captured in hardware; the poll only collects it.
+ */
+static void poll_touch_probe(struct axis *ax) {
+    // While homing owns SW_MODE, a new function is applied when it ends
+    if (homing_is_moving(&ax->homing)) {
+        return;
+    }
+    if (ax->is_touch_probe_pending) {
+        ax->is_touch_probe_pending = false;
+        touch_probe_configure(&ax->touch_probe, co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x60B8), 0x00), switch_polarity(ax));
+        publish_touch_probe(ax);
+    }
+    if (!touch_probe_is_enabled(&ax->touch_probe)) {
+        return;
+    }
+    if (touch_probe_poll(&ax->touch_probe)) {
+        publish_touch_probe(ax);
+    }
+}
+
+/**
+ * @brief Reads the encoder configuration from object 0x2002.
+ */
+static void read_encoder_config(const struct axis *ax, struct encoder_config *config) {
+    config->resolution = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2002), 0x01);
+    config->motor_resolution = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2002), 0x02);
+    config->inverted = co_dev_get_val_u8(dev, AXIS_OBJ(ax, 0x2002), 0x03) != 0;
+}
+
+static void read_factor_config(const struct axis *ax, struct factor_group_config *config) {
+    config->encoder_increments = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x608F), 0x01);
+    config->motor_revolutions = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x608F), 0x02);
+    config->gear_motor_revolutions = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6091), 0x01);
+    config->gear_shaft_revolutions = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6091), 0x02);
+    config->feed = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6092), 0x01);
+    config->feed_shaft_revolutions = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6092), 0x02);
+}
+
+/**
+ * @brief Callback executed on SDO write to the factor group (0x608F, 0x6091,
+ *        0x6092, :01/:02). The factors are computed here, off the hot path;
+ *        a value whose reduced fractions do not fit 64 bits is refused.
+ *        Set-points already taken keep the factors they were converted with.
+ */
+static co_unsigned32_t on_write_factor(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+    co_unsigned32_t value;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &value, &ac) == -1) {
+        return ac;
+    }
+    if (value == 0) {
+        return CO_SDO_AC_PARAM_LO;
+    }
+
+    struct factor_group_config config;
+    read_factor_config(ax, &config);
+    co_unsigned16_t idx = co_obj_get_idx(co_sub_get_obj(sub));
+    bool is_revolutions = co_sub_get_subidx(sub) == 0x02;
+    if (idx == AXIS_OBJ(ax, 0x608F)) {
+        *(is_revolutions ? &config.motor_revolutions : &config.encoder_increments) = value;
+    } else if (idx == AXIS_OBJ(ax, 0x6091)) {
+        *(is_revolutions ? &config.gear_shaft_revolutions : &config.gear_motor_revolutions) = value;
+    } else {
+        *(is_revolutions ? &config.feed_shaft_revolutions : &config.feed) = value;
+    }
+
+    if (!factor_group_compute(&ax->factors, &config)) {
+        return CO_SDO_AC_PARAM_VAL;
+    }
+    co_sub_dn(sub, &value);
+    return 0;
+}
+
+/**
+ * @brief Sets up the encoder interface from 0x2002 and starts X_ENC at
+ *        XACTUAL. Without an encoder the actual position is XACTUAL.
+ */
+static void configure_encoder(struct axis *ax) {
+    struct encoder_config config;
+    struct encoder_regs regs;
+
+    read_encoder_config(ax, &config);
+    ax->is_encoder_enabled = encoder_compute(&regs, &config);
+    if (ax->is_encoder_enabled) {
+        post_write(ax, TMC5160_ENCMODE, (int32_t)regs.encmode);
+        post_write(ax, TMC5160_ENC_CONST, regs.enc_const);
+        sync_encoder(ax);
+    }
+    following_error_reset(&ax->following_error);
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60F4), 0x00, 0);
+}
+
+/**
+ * @brief X_ENC = XACTUAL, after XACTUAL has been set (homing).
+ */
+static void sync_encoder(struct axis *ax) {
+    if (ax->is_encoder_enabled) {
+        post_copy(ax, TMC5160_X_ENC, TMC5160_XACTUAL);
+    }
+}
+
+/**
+ * @brief XACTUAL = X_ENC before the power stage is enabled, so a motor
+ *        that has lost steps (or was moved by hand) starts without a
+ *        following error. Hold mode keeps the ramp generator from moving
+ *        between the writes of XACTUAL and XTARGET.
+ */
+static void align_position(struct axis *ax) {
+    if (!ax->is_encoder_enabled) {
+        return;
+    }
+
+    post_write(ax, TMC5160_RAMPMODE, TMC5160_RAMPMODE_HOLD);
+    post_copy(ax, TMC5160_XACTUAL, TMC5160_X_ENC);
+    post_copy(ax, TMC5160_XTARGET, TMC5160_XACTUAL);
+    post_write(ax, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+
+    following_error_reset(&ax->following_error);
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60F4), 0x00, 0);
+}
+
+/**
+ * @brief Actual position (0x6064): X_ENC with an encoder, else XACTUAL.
+ */
+static int32_t actual_position(struct axis *ax) {
+    const struct axis_sample *sample = axis_sample(ax);
+    return ax->is_encoder_enabled ? sample->x_enc : sample->xactual;
+}
+
+/**
+ * @brief Callback executed on SDO write to the encoder configuration
+ *        (0x2002:01..03). Resolutions that give more than 32767 usteps per
+ *        count are refused; the new value is applied immediately.
+ */
+static co_unsigned32_t on_write_encoder(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+    co_unsigned8_t subidx = co_sub_get_subidx(sub);
+
+    if (subidx == 0x03) {
+        if (co_sub_on_dn(sub, req, &ac) == -1) {
+            return ac;
+        }
+    } else {
+        struct encoder_config config;
+        struct encoder_regs regs;
+        co_unsigned32_t value;
+
+        if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &value, &ac) == -1) {
+            return ac;
+        }
+        read_encoder_config(ax, &config);
+        if (subidx == 0x01) {
+            config.resolution = value;
+        } else {
+            config.motor_resolution = value;
+        }
+        if (config.motor_resolution == 0) {
+            return CO_SDO_AC_PARAM_LO;
+        }
+        if (config.resolution != 0 && !encoder_compute(&regs, &config)) {
+            return CO_SDO_AC_PARAM_VAL;
+        }
+        co_sub_dn(sub, &value);
+    }
+
+    if (ax->is_present) {
+        configure_encoder(ax);
+    }
+    return 0;
+}
+
+/**
+ * @brief Following error monitoring: enters the fault reaction when
+ *        XACTUAL - X_ENC (0x60F4) stays outside the following error window
+ *        (0x6065) for the time out (0x6066). Both objects are in user
+ *        units; the check runs in usteps. Not while homing, which may
+ *        stall the motor on purpose.
+ */
+static void poll_following_error(struct axis *ax) {
+    if (!ax->is_encoder_enabled) {
+        return;
+    }
+    if ((ax->state != PDS_STATE_OPERATION_ENABLED && ax->state != PDS_STATE_QUICK_STOP_ACTIVE) ||
+        homing_is_moving(&ax->homing)) {
+        following_error_reset(&ax->following_error);
+        return;
+    }
+
+    uint32_t now = millis();
+    if (now - ax->last_following_error_time < FOLLOWING_ERROR_POLL_INTERVAL_MS) {
+        return;
+    }
+    ax->last_following_error_time = now;
+
+    const struct axis_sample *sample = axis_sample(ax);
+    int32_t error = (int32_t)((uint32_t)sample->xactual - (uint32_t)sample->x_enc);
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x60F4), 0x00, factor_scale(&ax->factors.position_inv, error));
+
+    uint32_t window = co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x6065), 0x00);
+    ax->following_error.window = (window == FOLLOWING_ERROR_WINDOW_OFF) ? window
+                                 : factor_scale_u32(&ax->factors.position, window);
+    ax->following_error.timeout = co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x6066), 0x00);
+    if (following_error_update(&ax->following_error, error, now)) {
+        enter_fault(ax, DRIVE_ERROR_BIT(DRIVE_ERROR_FOLLOWING_ERROR));
+    }
+}
+
+/**
+ * @brief Ramps a velocity mode motion (CSV) down to rest with 'decel'.
+ *        poll_velocity_mode() returns to positioning once it is stopped.
+ */
+static void stop_velocity_mode(struct axis *ax, uint32_t decel) {
+    struct tmc5160_ramp stop;
+
+    // Velocity mode decelerates with AMAX
+    motion_profile_stop_ramp(&stop, 0, decel);
+    post_write(ax, TMC5160_AMAX, (int32_t)stop.amax);
+    post_write(ax, TMC5160_VMAX, 0);
+    ax->csv_velocity = 0;
+    ax->is_velocity_stopping = true;
+}
+
+/**
+ * @brief Back to positioning mode on the current position, as at the end
+ *        of homing. Stops the ramp generator at once: only for a motor at
+ *        rest or a power stage that is off.
+ */
+static void leave_velocity_mode(struct axis *ax) {
+    if (!ax->is_velocity_mode) {
+        return;
+    }
+
+    post_write(ax, TMC5160_RAMPMODE, TMC5160_RAMPMODE_HOLD);
+    post_write(ax, TMC5160_VMAX, 0);
+    post_copy(ax, TMC5160_XTARGET, TMC5160_XACTUAL);
+    post_write(ax, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+
+    // CSV has used VMAX/AMAX: the next set-point writes the profile again
+    ax->is_ramp_written = false;
+    ax->is_velocity_mode = false;
+    ax->is_velocity_stopping = false;
+    ax->csv_velocity = 0;
+}
+
+/**
+ * @brief Ends a velocity mode stop (halt, quick stop, fault reaction,
+ *        change of mode) once the motor has come to rest.
+ */
+static void poll_velocity_mode(struct axis *ax) {
+    if (ax->is_velocity_stopping && (axis_sample(ax)->ramp_stat & TMC5160_RAMP_STAT_VZERO)) {
+        leave_velocity_mode(ax);
+    }
+}
+
+/**
+ * @brief SYNC indication, after Lely has sent the synchronous TPDOs and
+ *        taken over the synchronous RPDOs: posts the velocity of every
+ *        axis in Cyclic Synchronous Velocity mode (0x60FF + 0x60B1). The
+ *        same three batched writes (AMAX, RAMPMODE, VMAX) every SYNC keep
+ *        the latency independent of the set-points; a mark behind them
+ *        times them from the SYNC reception.
+ */
+static void on_sync(co_nmt_t *nmt, co_unsigned8_t cnt, void *data) {
+    (void)nmt;
+    (void)cnt;
+    (void)data;
+
+    struct axis *csv[AXIS_COUNT];
+    int32_t amax[AXIS_COUNT];
+    int32_t rampmode[AXIS_COUNT];
+    int32_t vmax[AXIS_COUNT];
+    size_t count = 0;
+
+    // SYNC period: 0x1006, or the time since the previous SYNC
+    uint32_t received = can_sync_cycles();
+    uint32_t period_us = co_dev_get_val_u32(dev, 0x1006, 0x00);
+    if (period_us == 0 && last_sync_cycles != 0) {
+        period_us = boot_time_cycles_to_us(received - last_sync_cycles);
+    }
+    last_sync_cycles = received;
+    can_set_sync_id(co_dev_get_val_u32(dev, 0x1005, 0x00) & CAN_MASK_BID);
+
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        struct axis *ax = &axes[n];
+        if (!ax->is_present || ax->mode_op != 9 || ax->state != PDS_STATE_OPERATION_ENABLED ||
+            ax->is_halted || ax->is_velocity_stopping) {
+            continue;
+        }
+
+        // The first SYNC takes over from the motion in progress
+        if (!ax->is_velocity_mode) {
+            ax->csv_velocity = axis_sample(ax)->vactual;
+            ax->is_velocity_mode = true;
+            ax->is_ramp_written = false;
+        }
+
+        const struct factor *f = &ax->factors.velocity;
+        int32_t velocity = motion_profile_csv_velocity(factor_scale(f, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x60FF), 0x00)),
+                                                       factor_scale(f, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x60B1), 0x00)));
+        csv[count] = ax;
+        amax[count] = (int32_t)motion_profile_csv_accel(ax->csv_velocity, velocity, period_us);
+        rampmode[count] = (velocity < 0) ? TMC5160_RAMPMODE_VELOCITY_NEG : TMC5160_RAMPMODE_VELOCITY_POS;
+        vmax[count] = (velocity < 0) ? -velocity : velocity;
+        ax->csv_velocity = velocity;
+        count++;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // One register of all axes after the other: the tick batches them
+    static const uint8_t addresses[] = { TMC5160_AMAX, TMC5160_RAMPMODE, TMC5160_VMAX };
+    const int32_t *values[] = { amax, rampmode, vmax };
+    for (size_t r = 0; r < sizeof(addresses); r++) {
+        for (size_t i = 0; i < count; i++) {
+            post_command(csv[i], &(struct motion_command){
+                .drv = &csv[i]->drv,
+                .posted = received,
+                .type = MOTION_COMMAND_WRITE,
+                .address = addresses[r],
+                .value = values[r][i],
+            });
+        }
+    }
+    while (!motion_queue_post(&motion_queue, &(struct motion_command){ .posted = received, .type = MOTION_COMMAND_MARK },
+                              NULL)) {
+    }
+}
+
+/**
+ * @brief Publishes the time from the reception of a SYNC to the last SPI
+ *        write of the CSV velocities in 0x2106: last, minimum and maximum
+ *        in microseconds, and the number of SYNCs (writing 0 restarts).
+ */
+static void record_sync_latency(uint32_t cycles) {
+    uint32_t us = boot_time_cycles_to_us(cycles);
+    uint32_t count = co_dev_get_val_u32(dev, 0x2106, 0x04);
+    uint32_t min = co_dev_get_val_u32(dev, 0x2106, 0x02);
+    uint32_t max = co_dev_get_val_u32(dev, 0x2106, 0x03);
+
+    co_dev_set_val_u32(dev, 0x2106, 0x01, us);
+    co_dev_set_val_u32(dev, 0x2106, 0x02, (count == 0 || us < min) ? us : min);
+    co_dev_set_val_u32(dev, 0x2106, 0x03, (count == 0 || us > max) ? us : max);
+    co_dev_set_val_u32(dev, 0x2106, 0x04, count + 1);
+}
+
+/**
+ * @brief Starts following the buffered points (IP mode) from the current
+ *        position, one every interpolation period (0x60C2). The ramp is
+ *        linear with the profile acceleration and deceleration; every point
+ *        brings its own VMAX.
+ */
+static void start_interpolation(struct axis *ax) {
+    struct tmc5160_ramp ramp;
+    uint32_t period_us = interpolation_period_us(co_dev_get_val_u8(dev, AXIS_OBJ(ax, 0x60C2), 0x01),
+                                                 co_dev_get_val_i8(dev, AXIS_OBJ(ax, 0x60C2), 0x02));
+
+    motion_profile_compute(&ramp, MOTION_PROFILE_LINEAR, 0, ax->profile_ramp.amax, ax->profile_ramp.dmax, 0);
+    write_ramp(ax, &ramp);
+    interpolation_start(&ax->ip, axis_sample(ax)->xactual, period_us, motion_timer_period_us());
+}
+
+/**
+ * @brief Stops taking points; the motor comes to rest at the last point
+ *        taken. The buffered points stay for the next start.
+ */
+static void stop_interpolation(struct axis *ax) {
+    if (!ax->ip.is_enabled) {
+        return;
+    }
+
+    interpolation_stop(&ax->ip);
+    post_write(ax, TMC5160_XTARGET, interpolation_position(&ax->ip));
+
+    // The timer has written VMAX: the next set-point writes the profile again
+    ax->is_ramp_written = false;
+}
+
+/**
+ * @brief Motion timer interrupt (0x2107:01): checks the consumed
+ *        heartbeats, executes the commands posted by the main loop, then takes the next point of every axis whose
+ *        interpolation period has come and writes VMAX, then XTARGET, each
+ *        in one batch over the axes. Last it samples one axis for the main
+ *        loop. The commands get what is left of the SPI budget of the tick
+ *        (motion_tick_budget()). Main loop SPI accesses keep it out
+ *        (spi1_lock()); it touches no Lely object.
+ */
+static void on_motion_tick(void) {
+    struct tmc5160 *drvs[AXIS_COUNT];
+    int32_t vmax[AXIS_COUNT];
+    int32_t xtarget[AXIS_COUNT];
+    size_t count = 0;
+    uint32_t start = boot_time_cycles();
+
+    if (is_motion_stats_reset) {
+        motion_queue_reset_stats(&motion_queue);
+        motion_tick_max_cycles = 0;
+        is_motion_stats_reset = false;
+    }
+
+    // A lost heartbeat stops the axes before anything else is written
+    check_heartbeats();
+    motion_queue_execute(&motion_queue, motion_tick_command_budget);
+
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        struct interpolation_step step;
+        if (interpolation_tick(&axes[n].ip, &step)) {
+            drvs[count] = &axes[n].drv;
+            vmax[count] = (int32_t)step.vmax;
+            xtarget[count] = step.xtarget;
+            count++;
+        }
+    }
+    if (count) {
+        tmc5160_write_registers_batch(drvs, count, TMC5160_VMAX, vmax);
+        tmc5160_write_registers_batch(drvs, count, TMC5160_XTARGET, xtarget);
+    }
+    sample_axis();
+
+    uint32_t duration = boot_time_cycles() - start;
+    if (duration > motion_tick_max_cycles) {
+        motion_tick_max_cycles = duration;
+    }
+}
+
+/**
+ * @brief Posts a TMC5160 access of 'ax' to the motion tick. A full queue
+ *        is waited for: the tick empties it within a few periods. Never
+ *        called with the motion tick masked.
+ */
+static void post_command(struct axis *ax, const struct motion_command *cmd) {
+    while (!motion_queue_post(&motion_queue, cmd, &ax->motion_index)) {
+    }
+    ax->is_motion_posted = true;
+}
+
+static void post_write(struct axis *ax, uint8_t address, int32_t value) {
+    post_command(ax, &(struct motion_command){
+        .drv = &ax->drv,
+        .posted = boot_time_cycles(),
+        .type = MOTION_COMMAND_WRITE,
+        .address = address,
+        .value = value,
+    });
+}
+
+/**
+ * @brief Posts 'address' = the register 'source', read by the motion tick.
+ */
+static void post_copy(struct axis *ax, uint8_t address, uint8_t source) {
+    post_command(ax, &(struct motion_command){
+        .drv = &ax->drv,
+        .posted = boot_time_cycles(),
+        .type = MOTION_COMMAND_COPY,
+        .address = address,
+        .value = source,
+    });
+}
+
+/**
+ * @brief Posts the power stage on or off (CHOPCONF TOFF).
+ */
+static void post_driver_enabled(struct axis *ax, bool enable) {
+    post_command(ax, &(struct motion_command){
+        .drv = &ax->drv,
+        .posted = boot_time_cycles(),
+        .type = MOTION_COMMAND_ENABLE,
+        .value = enable,
+    });
+}
+
+/**
+ * @brief Posts a call of 'call'('context', 'value') for the accesses of a
+ *        module of the axis (homing), which sends 'datagrams' at most.
+ */
+static void post_call(struct axis *ax, void (*call)(void *context, int32_t value), void *context, int32_t value,
+                      uint8_t datagrams) {
+    post_command(ax, &(struct motion_command){
+        .drv = &ax->drv,
+        .posted = boot_time_cycles(),
+        .type = MOTION_COMMAND_CALL,
+        .value = value,
+        .datagrams = datagrams,
+        .call = call,
+        .context = context,
+    });
+}
+
+/**
+ * @brief Executes the posted commands now, with the motion tick masked:
+ *        before the main loop configures the drives itself at start-up,
+ *        so older commands cannot overtake it.
+ */
+static void flush_motion(void) {
+    if (motion_queue_is_empty(&motion_queue)) {
+        return;
+    }
+
+    uint32_t key = spi1_lock();
+    while (motion_queue_execute(&motion_queue, UINT_MAX)) {
+    }
+    spi1_unlock(key);
+}
+
+/**
+ * @brief Whether commands posted for 'ax' still wait for the motion tick,
+ *        or for the first sample of the axis after them: until then the
+ *        sample does not show their effect.
+ */
+static bool is_motion_pending(struct axis *ax) {
+    if (ax->is_motion_posted && motion_queue_is_done(&motion_queue, ax->motion_index) &&
+        (int32_t)(axis_sample(ax)->tail - ax->motion_index) > 0) {
+        ax->is_motion_posted = false;
+    }
+    return ax->is_motion_posted;
+}
+
+/**
+ * @brief Whether the power stage of an axis is on (the motor may move), so
+ *        the MCU must not stall for a flash erase.
+ */
+static bool is_any_axis_enabled(void) {
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        pds_state_t state = axes[n].state;
+        if (state == PDS_STATE_OPERATION_ENABLED || state == PDS_STATE_QUICK_STOP_ACTIVE ||
+            state == PDS_STATE_FAULT_REACTION_ACTIVE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Number of axes whose TMC5160 answers (0 until configured).
+ */
+static unsigned int fitted_axes(void) {
+    unsigned int fitted = 0;
+
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        fitted += axes[n].is_present;
+    }
+    return fitted;
+}
+
+/**
+ * @brief Shortest motion tick period for the fitted TMC5160s: the tick
+ *        serves every one of them and the largest command within its SPI
+ *        budget. A daisy chain may need more than the timer allows.
+ */
+static uint32_t min_motion_period(void) {
+    uint32_t period = motion_tick_min_period_us(fitted_axes());
+    return (period < MOTION_TIMER_PERIOD_MAX_US) ? period : MOTION_TIMER_PERIOD_MAX_US;
+}
+
+/**
+ * @brief Sets the motion tick period and the datagrams its commands get.
+ */
+static void set_motion_period(uint32_t period_us) {
+    motion_timer_set_period(period_us);
+    motion_tick_command_budget = motion_tick_budget(period_us, fitted_axes());
+}
+
+/**
+ * @brief Raises the motion tick period (0x2107:01) to the shortest one the
+ *        fitted axes allow, at start-up and once the drives are configured.
+ */
+static void clamp_motion_period(void) {
+    uint32_t period = motion_timer_period_us();
+    uint32_t min = min_motion_period();
+
+    if (period < min) {
+        period = min;
+        co_dev_set_val_u16(dev, 0x2107, 0x01, (co_unsigned16_t)period);
+    }
+    set_motion_period(period);
+}
+
+/**
+ * @brief Callback executed on SDO write to the motion tick period
+ *        (0x2107:01), refused while an axis interpolates or below the
+ *        period the fitted axes need, and to the command count
+ *        (0x2107:04), where 0 restarts the statistics.
+ */
+static co_unsigned32_t on_write_motion_tick(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+
+    if (co_sub_get_subidx(sub) == 0x01) {
+        co_unsigned16_t period;
+
+        if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED16, &period, &ac) == -1) {
+            return ac;
+        }
+        if (period < MOTION_TIMER_PERIOD_MIN_US || period < min_motion_period()) {
+            return CO_SDO_AC_PARAM_LO;
+        }
+        if (period > MOTION_TIMER_PERIOD_MAX_US) {
+            return CO_SDO_AC_PARAM_HI;
+        }
+        for (size_t n = 0; n < AXIS_COUNT; n++) {
+            if (axes[n].ip.is_enabled) {
+                return CO_SDO_AC_DATA_DEV;
+            }
+        }
+        set_motion_period(period);
+        co_sub_dn(sub, &period);
+    } else {
+        co_unsigned32_t count;
+
+        if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &count, &ac) == -1) {
+            return ac;
+        }
+        if (count != 0) {
+            return CO_SDO_AC_PARAM_HI;
+        }
+        // Applied by the next tick, which owns the statistics
+        is_motion_stats_reset = true;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Callback executed on a read of the motion tick statistics
+ *        (0x2107:02..04): worst latency from posting a command (for CSV,
+ *        from the SYNC) to its TMC5160 access and longest tick in
+ *        microseconds, and the commands executed.
+ */
+static co_unsigned32_t on_read_motion_tick(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+    co_unsigned32_t value;
+
+    switch (co_sub_get_subidx(sub)) {
+        case 0x02:
+            value = boot_time_cycles_to_us(motion_queue.max_latency);
+            break;
+        case 0x03:
+            value = boot_time_cycles_to_us(motion_tick_max_cycles);
+            break;
+        default:
+            value = motion_queue.executed;
+            break;
+    }
+    co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED32, &value, &ac);
+    return ac;
+}
+
+/**
+ * @brief Follows the consumer heartbeat times (0x1016:01..04): a changed
+ *        entry restarts its monitoring, with the motion tick masked.
+ */
+static void configure_heartbeat_consumers(void) {
+    for (unsigned int slot = 0; slot < HEARTBEAT_CONSUMER_COUNT; slot++) {
+        uint32_t entry = co_dev_get_val_u32(dev, 0x1016, (co_unsigned8_t)(slot + 1));
+        if (entry == heartbeat_entries[slot]) {
+            continue;
+        }
+        heartbeat_entries[slot] = entry;
+
+        uint32_t key = spi1_lock();
+        struct heartbeat_consumer *c = &heartbeat_consumers[slot];
+        uint32_t cycles;
+        can_watch(slot, CAN_WATCH_NONE);
+        heartbeat_consumer_configure(c, entry, can_watch_count(slot, &cycles));
+        if (c->node_id) {
+            can_watch(slot, HEARTBEAT_COB_ID + c->node_id);
+        }
+        spi1_unlock(key);
+    }
+}
+
+/**
+ * @brief Keeps the reaction of the motion tick to a heartbeat loss in line
+ *        with 0x6007 and the stop objects: the deceleration of the fault
+ *        reaction or of the quick stop option code (0x605A), or none for
+ *        the power stage off at once.
+ */
+static void prepare_abort_connection(struct axis *ax) {
+    int16_t option = co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x6007), 0x00);
+    uint32_t decel = 0;
+
+    if (option == ABORT_OPTION_FAULT) {
+        decel = stop_deceleration(ax, STOP_OPTION_QUICK_STOP);
+    } else if (option == ABORT_OPTION_QUICK_STOP) {
+        int16_t quick_stop_option = co_dev_get_val_i16(dev, AXIS_OBJ(ax, 0x605A), 0x00);
+        if (quick_stop_option != STOP_OPTION_DISABLE_DRIVE) {
+            decel = stop_deceleration(ax, quick_stop_option);
+        }
+    }
+
+    if (option != ax->abort_option || decel != ax->abort_decel) {
+        uint32_t key = spi1_lock();
+        ax->abort_option = option;
+        ax->abort_decel = decel;
+        spi1_unlock(key);
+    }
+}
+
+/**
+ * @brief Takes the heartbeat clock from the free-running cycle counter, so
+ *        ticks that overrun their period do not slow it down. The base is
+ *        moved on well before the counter wraps (25 s at 168 MHz); the
+ *        fraction of a microsecond lost then is negligible.
+ */
+static void advance_motion_clock(void) {
+    uint32_t now = boot_time_cycles();
+    uint32_t elapsed = now - motion_clock_base_cycles;
+
+    motion_clock_us = motion_clock_base_us + boot_time_cycles_to_us(elapsed);
+    if (elapsed >= (1u << 30)) {
+        motion_clock_base_us = motion_clock_us;
+        motion_clock_base_cycles = now;
+    }
+}
+
+/**
+ * @brief Checks the consumed heartbeats (motion tick). When one is lost,
+ *        every axis in OPERATION ENABLED with an abort connection option
+ *        code starts its stop at once, and the time from the expiry of the
+ *        heartbeat time to the stop is recorded. The receive interrupt
+ *        counts the heartbeats, so the main loop is not involved.
+ */
+static void check_heartbeats(void) {
+    advance_motion_clock();
+
+    // The count keeps running for the main loop (heartbeat_losses_handled)
+    if (is_heartbeat_stats_reset) {
+        heartbeat_reaction_us = 0;
+        heartbeat_reaction_max_us = 0;
+        heartbeat_lost_node = 0;
+        heartbeat_loss_base = heartbeat_losses;
+        is_heartbeat_stats_reset = false;
+    }
+
+    for (unsigned int slot = 0; slot < HEARTBEAT_CONSUMER_COUNT; slot++) {
+        struct heartbeat_consumer *c = &heartbeat_consumers[slot];
+        uint32_t cycles;
+        uint32_t count = can_watch_count(slot, &cycles);
+        uint32_t now = boot_time_cycles();
+
+        if (!heartbeat_consumer_check(c, count, motion_clock_us - boot_time_cycles_to_us(now - cycles),
+                                      motion_clock_us)) {
+            continue;
+        }
+
+        for (size_t n = 0; n < AXIS_COUNT; n++) {
+            stop_on_connection_loss(&axes[n]);
+        }
+
+        uint32_t reaction = heartbeat_consumer_overdue_us(c, motion_clock_us) +
+                            boot_time_cycles_to_us(boot_time_cycles() - now);
+        heartbeat_reaction_us = reaction;
+        if (reaction > heartbeat_reaction_max_us) {
+            heartbeat_reaction_max_us = reaction;
+        }
+        heartbeat_lost_node = c->node_id;
+        heartbeat_losses++;
+    }
+}
+
+/**
+ * @brief Reaction of one axis to a heartbeat loss (motion tick): no more
+ *        points, and the commands still posted for it are dropped. The
+ *        power stage goes off, or the ramp generator stops with the
+ *        prepared deceleration: in positioning mode on the XTARGET of a
+ *        stop ramp, in velocity mode (CSV, homing) with VMAX = 0. The mode
+ *        is read from the TMC5160, as commands changing it may be dropped.
+ */
+static void stop_on_connection_loss(struct axis *ax) {
+    struct tmc5160_ramp stop;
+
+    if (!ax->is_present || ax->abort_option == ABORT_OPTION_NO_ACTION ||
+        ax->state != PDS_STATE_OPERATION_ENABLED) {
+        return;
+    }
+
+    interpolation_stop(&ax->ip);
+    motion_queue.discarded |= 1u << ax->drv.cs;
+    ax->is_stopped_on_loss = true;
+
+    if (ax->abort_decel == 0) {
+        tmc5160_set_driver_enabled(&ax->drv, false);
+        return;
+    }
+
+    motion_profile_stop_ramp(&stop, 0, ax->abort_decel);
+    if (tmc5160_read_register(&ax->drv, TMC5160_RAMPMODE) != TMC5160_RAMPMODE_POSITION) {
+        tmc5160_write_register(&ax->drv, TMC5160_AMAX, (int32_t)stop.amax);
+        tmc5160_write_register(&ax->drv, TMC5160_VMAX, 0);
+        return;
+    }
+
+    tmc5160_write_register(&ax->drv, TMC5160_V1, (int32_t)stop.v1);
+    tmc5160_write_register(&ax->drv, TMC5160_AMAX, (int32_t)stop.amax);
+    tmc5160_write_register(&ax->drv, TMC5160_DMAX, (int32_t)stop.dmax);
+    tmc5160_write_register(&ax->drv, TMC5160_D1, (int32_t)stop.d1);
+    motion_command_execute(&(struct motion_command){
+        .drv = &ax->drv,
+        .type = MOTION_COMMAND_STOP,
+        .value = (int32_t)ax->abort_decel,
+    });
+}
+
+/**
+ * @brief Completes the reaction to a heartbeat loss: the commands posted
+ *        before it are dropped, then every axis the motion tick stopped
+ *        takes the transition of its abort connection option code (0x6007).
+ *        The stop the motion tick started is posted again on the same ramp.
+ *        The transition bypasses the controlword, so the edges of bits 4
+ *        and 7 still refer to the last controlword of the master.
+ */
+static void poll_connection_loss(void) {
+    if (heartbeat_losses == heartbeat_losses_handled) {
+        return;
+    }
+    heartbeat_losses_handled = heartbeat_losses;
+
+    bool is_stopped[AXIS_COUNT];
+
+    uint32_t key = spi1_lock();
+    while (motion_queue_execute(&motion_queue, UINT_MAX)) {
+    }
+    motion_queue.discarded = 0;
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        is_stopped[n] = axes[n].is_stopped_on_loss;
+        axes[n].is_stopped_on_loss = false;
+    }
+    spi1_unlock(key);
+
+    for (size_t n = 0; n < AXIS_COUNT; n++) {
+        struct axis *ax = &axes[n];
+        // Axes the master took out of operation meanwhile keep their state
+        if (!is_stopped[n] || ax->state != PDS_STATE_OPERATION_ENABLED) {
+            continue;
+        }
+
+        // The ramp registers may have been written behind write_ramp()
+        ax->is_ramp_written = false;
+
+        switch (ax->abort_option) {
+            case ABORT_OPTION_FAULT:
+                enter_fault(ax, 0);
+                break;
+            case ABORT_OPTION_DISABLE_VOLTAGE:
+                disable_operation(ax, PDS_STATE_SWITCH_ON_DISABLED);
+                update_statusword(ax);
+                send_statusword(ax);
+                break;
+            case ABORT_OPTION_QUICK_STOP:
+                start_quick_stop(ax);
+                update_statusword(ax);
+                send_statusword(ax);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Callback executed on SDO write to the heartbeat loss count
+ *        (0x2108:03): 0 restarts the count and the reaction times.
+ */
+static co_unsigned32_t on_write_heartbeat_loss(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    (void)data;
+    co_unsigned32_t ac = 0;
+    co_unsigned32_t count;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &count, &ac) == -1) {
+        return ac;
+    }
+    if (count != 0) {
+        return CO_SDO_AC_PARAM_HI;
+    }
+
+    // Applied by the next tick, which owns the statistics
+    is_heartbeat_stats_reset = true;
+    return 0;
+}
+
+/**
+ * @brief Callback executed on a read of the heartbeat loss reaction
+ *        (0x2108:01..04): time from the expiry of the heartbeat time to the
+ *        stop of the axes in microseconds, last and worst, the losses, and
+ *        the node of the last one.
+ */
+static co_unsigned32_t on_read_heartbeat_loss(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)data;
+    co_unsigned32_t ac = 0;
+
+    if (co_sub_get_subidx(sub) == 0x04) {
+        co_unsigned8_t node_id = heartbeat_lost_node;
+        co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED8, &node_id, &ac);
+        return ac;
+    }
+
+    co_unsigned32_t value;
+    switch (co_sub_get_subidx(sub)) {
+        case 0x01:
+            value = heartbeat_reaction_us;
+            break;
+        case 0x02:
+            value = heartbeat_reaction_max_us;
+            break;
+        default:
+            value = heartbeat_losses - heartbeat_loss_base;
+            break;
+    }
+    co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED32, &value, &ac);
+    return ac;
+}
+
+/**
+ * @brief Callback executed on a write to the interpolation data record
+ *        (0x60C1:01), by SDO or a mapped RPDO: appends the point, in usteps,
+ *        to the buffer. Refused while access is disabled or the buffer is full.
+ */
+static co_unsigned32_t on_write_ip_data(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+    int32_t point;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_INTEGER32, &point, &ac) == -1) {
+        return ac;
+    }
+    if (!interpolation_push(&ax->ip, factor_scale(&ax->factors.position, point))) {
+        return CO_SDO_AC_DATA_DEV;
+    }
+
+    co_sub_dn(sub, &point);
+    return 0;
+}
+
+/**
+ * @brief Callback executed on SDO write to the buffer size (0x60C4:02),
+ *        which empties the buffer and is refused while the interpolation
+ *        runs, and to buffer clear (0x60C4:06): 0 stops the interpolation
+ *        and empties the buffer, 1 enables access again.
+ */
+static co_unsigned32_t on_write_ip_config(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    if (co_sub_get_subidx(sub) == 0x02) {
+        co_unsigned32_t size;
+
+        if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED32, &size, &ac) == -1) {
+            return ac;
+        }
+        if (size == 0 || size > INTERPOLATION_BUFFER_DEPTH) {
+            return size ? CO_SDO_AC_PARAM_HI : CO_SDO_AC_PARAM_LO;
+        }
+        if (ax->ip.is_enabled) {
+            return CO_SDO_AC_DATA_DEV;
+        }
+        interpolation_set_size(&ax->ip, size);
+        co_sub_dn(sub, &size);
+    } else {
+        co_unsigned8_t clear;
+
+        if (co_sdo_req_dn_val(req, CO_DEFTYPE_UNSIGNED8, &clear, &ac) == -1) {
+            return ac;
+        }
+        if (clear > 1) {
+            return CO_SDO_AC_PARAM_HI;
+        }
+        if (clear == 0) {
+            stop_interpolation(ax);
+        }
+        interpolation_set_access(&ax->ip, clear == 1);
+        co_sub_dn(sub, &clear);
+    }
+
+    update_statusword(ax);
+    return 0;
+}
+
+/**
+ * @brief SDO download to the interpolation data burst (0x2004): a block of
+ *        little-endian INTEGER32 points in user units, appended in order. A burst with an
+ *        indicated size must fit into the buffer as a whole; points split
+ *        across segments are put together here.
+ */
+static co_unsigned32_t on_write_ip_burst(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    (void)sub;
+    struct axis *ax = data;
+    const uint8_t *bytes = req->buf;
+
+    if (co_sdo_req_first(req)) {
+        if (req->size % sizeof(int32_t)) {
+            return CO_SDO_AC_TYPE_LEN_LO;
+        }
+        if (req->size / sizeof(int32_t) > interpolation_space(&ax->ip)) {
+            return CO_SDO_AC_NO_MEM;
+        }
+        ax->ip_partial_size = 0;
+    }
+
+    for (size_t i = 0; i < req->nbyt; i++) {
+        ax->ip_partial[ax->ip_partial_size++] = bytes[i];
+        if (ax->ip_partial_size == sizeof(ax->ip_partial)) {
+            co_integer32_t point;
+            co_val_read(CO_DEFTYPE_INTEGER32, &point, ax->ip_partial, ax->ip_partial + sizeof(ax->ip_partial));
+            ax->ip_partial_size = 0;
+            if (!interpolation_push(&ax->ip, factor_scale(&ax->factors.position, point))) {
+                return CO_SDO_AC_NO_MEM;
+            }
+        }
+    }
+
+    if (co_sdo_req_last(req) && ax->ip_partial_size) {
+        return CO_SDO_AC_TYPE_LEN_LO;
+    }
+    return 0;
+}
+
+/**
+ * @brief Callback executed on a read of the interpolation buffer status
+ *        (0x2003), by SDO or for the synchronous TPDO: fill level (:01)
+ *        and underruns (:02).
+ */
+static co_unsigned32_t on_read_ip_status(const co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+
+    if (co_sub_get_subidx(sub) == 0x01) {
+        co_unsigned16_t fill = (co_unsigned16_t)interpolation_count(&ax->ip);
+        co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED16, &fill, &ac);
+    } else {
+        co_unsigned32_t underruns = interpolation_underruns(&ax->ip);
+        co_sdo_req_up_val(req, CO_DEFTYPE_UNSIGNED32, &underruns, &ac);
+    }
+
+    return ac;
+}
+
+/**
+ * @brief Whether the demand position of the electronic gearing goes to
+ *        XTARGET: in OPERATION ENABLED without a halt, once a master
+ *        position has been received and the motor is in positioning mode.
+ */
+static bool can_follow_master(const struct axis *ax) {
+    return ax->mode_op == MODE_ELECTRONIC_GEARING && ax->state == PDS_STATE_OPERATION_ENABLED && !ax->is_halted &&
+           !ax->is_velocity_mode && !homing_is_moving(&ax->homing) && ax->gearing.is_started;
+}
+
+/**
+ * @brief Posts the demand position of the electronic gearing, with the
+ *        ramp of the motion profile (0x6081/0x6083/0x6084) in case a stop
+ *        ramp has replaced it.
+ */
+static void post_gearing_target(struct axis *ax) {
+    write_ramp(ax, &ax->profile_ramp);
+    post_write(ax, TMC5160_XTARGET, ax->gearing.target);
+    ax->is_gearing_engaged = true;
+}
+
+/**
+ * @brief Electronic gearing: engages after enable operation, a halt or the
+ *        end of a velocity mode motion on the last demand position, and
+ *        publishes the gearing error (0x2005:04) and the largest one seen
+ *        (0x2005:05, writing 0 restarts it).
+ */
+static void poll_gearing(struct axis *ax) {
+    if (!can_follow_master(ax)) {
+        ax->is_gearing_engaged = false;
+        return;
+    }
+    if (!ax->is_gearing_engaged) {
+        post_gearing_target(ax);
+    }
+
+    int32_t error = gearing_error(&ax->gearing, actual_position(ax));
+    uint32_t magnitude = (error < 0) ? -(uint32_t)error : (uint32_t)error;
+    co_dev_set_val_i32(dev, AXIS_OBJ(ax, 0x2005), 0x04, error);
+    if (magnitude > co_dev_get_val_u32(dev, AXIS_OBJ(ax, 0x2005), 0x05)) {
+        co_dev_set_val_u32(dev, AXIS_OBJ(ax, 0x2005), 0x05, magnitude);
+    }
+}
+
+/**
+ * @brief Callback executed on a write to the master position (0x2005:01),
+ *        by SDO or a mapped RPDO: in electronic gearing mode the demand
+ *        position offset + ratio × master (0x2005:03, 0x2005:02) goes to
+ *        XTARGET at once. The RPDO's transmission type chooses between
+ *        every reception (254/255) and the next SYNC (0-240).
+ */
+static co_unsigned32_t on_write_master_position(co_sub_t *sub, struct co_sdo_req *req, void *data) {
+    struct axis *ax = data;
+    co_unsigned32_t ac = 0;
+    int32_t master;
+
+    if (co_sdo_req_dn_val(req, CO_DEFTYPE_INTEGER32, &master, &ac) == -1) {
+        return ac;
+    }
+    co_sub_dn(sub, &master);
+
+    if (ax->mode_op == MODE_ELECTRONIC_GEARING) {
+        gearing_follow(&ax->gearing, master, co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x2005), 0x02),
+                       co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x2005), 0x03));
+        if (can_follow_master(ax)) {
+            post_gearing_target(ax);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Callback untuk RPDO1 - Controlword only
+ */
+static void on_rpdo1_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data) {
+    (void)pdo;
+    (void)ptr;
+    (void)n;
+    struct axis *ax = data;
+
+    if (ac != 0) return;
+
+    uint16_t command = co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x6040), 0x00);
+    process_controlword(ax, command);
+}
+
+/**
+ * @brief Callback untuk RPDO2 - Controlword + Mode of Operation
+ */
+static void on_rpdo2_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data) {
+    (void)pdo;
+    (void)ptr;
+    (void)n;
+    struct axis *ax = data;
+
+    if (ac != 0) return;
+
+    int8_t mode = co_dev_get_val_i8(dev, AXIS_OBJ(ax, 0x6060), 0x00);
+    uint16_t command = co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x6040), 0x00);
+
+    process_mode_of_operation(ax, mode);
+    process_controlword(ax, command);
+}
+
+/**
+ * @brief Callback untuk RPDO3 - Controlword + Target Position
+ */
+static void on_rpdo3_write(co_rpdo_t *pdo, co_unsigned32_t ac, const void *ptr, size_t n, void *data) {
+    (void)pdo;
+    (void)ptr;
+    (void)n;
+    struct axis *ax = data;
+
+    if (ac != 0) return;
+
+	// 1. Simpan target position dulu (BELUM eksekusi)
+	int32_t target_pos = co_dev_get_val_i32(dev, AXIS_OBJ(ax, 0x607A), 0x00);
+	process_target_position(ax, target_pos);
+
+	// 2. Process controlword (akan deteksi rising edge bit 4 dan eksekusi jika ada)
+	uint16_t command = co_dev_get_val_u16(dev, AXIS_OBJ(ax, 0x6040), 0x00);
+	process_controlword(ax, command);
+}
+
+/**
+ * @brief Register semua RPDO callbacks of an axis: RPDO 4n+1..4n+3
+ */
+static void register_rpdo_callbacks(struct axis *ax) {
+    co_unsigned16_t base = (co_unsigned16_t)(AXIS_PDO_COUNT * ax->n);
+    co_rpdo_t *rpdo1 = co_nmt_get_rpdo(nmt, base + 1);
+    co_rpdo_t *rpdo2 = co_nmt_get_rpdo(nmt, base + 2);
+    co_rpdo_t *rpdo3 = co_nmt_get_rpdo(nmt, base + 3);
+
+    if (rpdo1) {
+        co_rpdo_set_ind(rpdo1, &on_rpdo1_write, ax);
+    }
+    if (rpdo2) {
+        co_rpdo_set_ind(rpdo2, &on_rpdo2_write, ax);
+    }
+    if (rpdo3) {
+        co_rpdo_set_ind(rpdo3, &on_rpdo3_write, ax);
+    }
+}
@@ -0,0 +1,447 @@
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#define TMC5160_VMAX_MASK       0x007FFFFF
+#define TMC5160_A_MASK          0x0000FFFF
+#define TMC5160_TZEROWAIT_MASK  0x0000FFFF
+#define TMC5160_TZEROWAIT_UNIT  512 // Clocks per TZEROWAIT count
+#define TMC5160_DRV_ERRORS      (TMC5160_DRV_STATUS_OT | TMC5160_DRV_STATUS_S2GA | TMC5160_DRV_STATUS_S2GB | \
+                                 TMC5160_DRV_STATUS_S2VSA | TMC5160_DRV_STATUS_S2VSB) // Latched by drv_err
+#define TMC5160_SG_RESULT_IDLE  0x1FF // Typical unloaded StallGuard2 reading
+
+#define V_SHIFT                 17 // v_fine = v << V_SHIFT
+#define X_SHIFT                 41 // x_fine units per microstep (2^24 * 2^17)
+#define X_UNIT                  ((double)((int64_t)1 << X_SHIFT))
+
+#define RAMP_STAT_EVENTS        (TMC5160_RAMP_STAT_EVENT_POS_REACHED | TMC5160_RAMP_STAT_SECOND_MOVE)
+
+// Ramp modes (RAMPMODE)
+#define RAMPMODE_POSITION       0
+#define RAMPMODE_VELOCITY_POS   1
+#define RAMPMODE_VELOCITY_NEG   2
+#define RAMPMODE_HOLD           3
+
+// Ramp parameters of one substep, as magnitudes in v_fine units
+struct ramp_params {
+    int64_t vstart, v1, vmax, vstop;
+    int64_t a1, amax, dmax, d1;
+};
+
+static int64_t abs64(int64_t v) {
+    return (v < 0) ? -v : v;
+}
+
+static bool tmc5160_model_is_readable(uint8_t address) {
+    switch (address) {
+        case TMC5160_GCONF:
+        case TMC5160_GSTAT:
+        case TMC5160_IOIN:
+        case TMC5160_RAMPMODE:
+        case TMC5160_XACTUAL:
+        case TMC5160_VACTUAL:
+        case TMC5160_XTARGET:
+        case TMC5160_RAMP_STAT:
+        case TMC5160_CHOPCONF:
+        case TMC5160_DRV_STATUS:
+        case TMC5160_ENCMODE:
+        case TMC5160_X_ENC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void ramp_read_params(const struct tmc5160_model *m, struct ramp_params *p) {
+    p->vstart = (int64_t)(m->reg[TMC5160_VSTART] & TMC5160_VMAX_MASK) << V_SHIFT;
+    p->v1 = (int64_t)(m->reg[TMC5160_V1] & TMC5160_VMAX_MASK) << V_SHIFT;
+    p->vmax = (int64_t)(m->reg[TMC5160_VMAX] & TMC5160_VMAX_MASK) << V_SHIFT;
+    p->vstop = (int64_t)(m->reg[TMC5160_VSTOP] & TMC5160_VMAX_MASK) << V_SHIFT;
+    p->a1 = m->reg[TMC5160_A1] & TMC5160_A_MASK;
+    p->amax = m->reg[TMC5160_AMAX] & TMC5160_A_MASK;
+    p->dmax = m->reg[TMC5160_DMAX] & TMC5160_A_MASK;
+    p->d1 = m->reg[TMC5160_D1] & TMC5160_A_MASK;
+
+    // V1 = 0 disables the A1 and D1 phases
+    if (p->v1 == 0) {
+        p->a1 = p->amax;
+        p->d1 = p->dmax;
+    }
+    // The chip never stops from below 1; VSTOP = 0 would never end the ramp.
+    if (p->vstop == 0) {
+        p->vstop = (int64_t)1 << V_SHIFT;
+    }
+}
+
+/**
+ * @brief Adds a position increment in x_fine units to XACTUAL.
+ */
+static void ramp_move(struct tmc5160_model *m, int64_t dx_fine) {
+    m->x_fine += dx_fine;
+
+    // Floor division, so the remainder stays in [0, 2^41)
+    int64_t steps = m->x_fine / ((int64_t)1 << X_SHIFT);
+    if (m->x_fine < steps * ((int64_t)1 << X_SHIFT)) {
+        steps--;
+    }
+    m->x_fine -= steps * ((int64_t)1 << X_SHIFT);
+    m->xactual = (int32_t)(uint32_t)((int64_t)m->xactual + steps);
+}
+
+/**
+ * @brief Runs 'n' clocks with the velocity approaching 'limit' (signed) by
+ *        'accel' per clock and then holding it. The velocity is updated
+ *        before the position in every clock, as in a discrete integrator.
+ */
+static void ramp_advance(struct tmc5160_model *m, int64_t limit, int64_t accel, uint32_t n) {
+    int64_t v = m->v_fine;
+    int64_t dx;
+
+    if (accel <= 0 || v == limit) {
+        dx = v * (int64_t)n;
+    } else {
+        int64_t sign = (limit > v) ? 1 : -1;
+        int64_t k = (abs64(limit - v) + accel - 1) / accel; // Clocks until the limit is reached
+
+        if (k <= (int64_t)n) {
+            dx = (k - 1) * v + sign * accel * (k - 1) * k / 2 + ((int64_t)n - k + 1) * limit;
+            v = limit;
+        } else {
+            dx = (int64_t)n * v + sign * accel * (int64_t)n * ((int64_t)n + 1) / 2;
+            v += sign * accel * (int64_t)n;
+        }
+    }
+
+    m->v_fine = v;
+    ramp_move(m, dx);
+}
+
+/**
+ * @brief Distance in usteps needed to slow down from 'speed' to VSTOP.
+ */
+static double ramp_brake_distance(const struct ramp_params *p, int64_t speed) {
+    double v = (double)speed / (1 << V_SHIFT);
+    double v1 = (double)p->v1 / (1 << V_SHIFT);
+    double vstop = (double)p->vstop / (1 << V_SHIFT);
+    double dmax = (p->dmax > 0) ? (double)p->dmax : 1.0;
+    double d1 = (p->d1 > 0) ? (double)p->d1 : 1.0;
+
+    if (v <= vstop) {
+        return 0.0;
+    }
+    if (p->v1 > 0 && v > v1) {
+        double low = (v1 > vstop) ? (v1 * v1 - vstop * vstop) / (256.0 * d1) : 0.0;
+        return (v * v - v1 * v1) / (256.0 * dmax) + low;
+    }
+    return (v * v - vstop * vstop) / (256.0 * d1);
+}
+
+/**
+ * @brief Distance in usteps from XACTUAL (with its fraction) to XTARGET,
+ *        positive when the target lies in direction 'dir'.
+ */
+static double ramp_remaining(const struct tmc5160_model *m, int64_t dir) {
+    double x = (double)m->xactual + (double)m->x_fine / X_UNIT;
+    return (double)dir * ((double)(int32_t)m->reg[TMC5160_XTARGET] - x);
+}
+
+/**
+ * @brief Ends a move exactly on XTARGET.
+ */
+static void ramp_arrive(struct tmc5160_model *m) {
+    m->xactual = (int32_t)m->reg[TMC5160_XTARGET];
+    m->x_fine = 0;
+    m->v_fine = 0;
+    m->events |= TMC5160_RAMP_STAT_EVENT_POS_REACHED;
+    m->zerowait = (m->reg[TMC5160_TZEROWAIT] & TMC5160_TZEROWAIT_MASK) * TMC5160_TZEROWAIT_UNIT;
+}
+
+static void ramp_position(struct tmc5160_model *m, uint32_t n) {
+    struct ramp_params p;
+    ramp_read_params(m, &p);
+
+    int32_t xtarget = (int32_t)m->reg[TMC5160_XTARGET];
+    int64_t dx = (int64_t)xtarget - m->xactual;
+
+    if (m->v_fine == 0) {
+        if (dx == 0) {
+            m->x_fine = 0;
+            return;
+        }
+        m->v_fine = (dx > 0) ? p.vstart : -p.vstart;
+    }
+
+    int64_t dir = (m->v_fine > 0 || (m->v_fine == 0 && dx > 0)) ? 1 : -1;
+    int64_t speed = abs64(m->v_fine);
+    double remaining = ramp_remaining(m, dir);
+    double substep = (double)speed * n / X_UNIT;
+    bool approach = false;
+
+    if (remaining < 0.0 || (remaining == 0.0 && speed > p.vstop)) {
+        // Target behind: ramp down to zero, then turn (second move)
+        m->events |= TMC5160_RAMP_STAT_SECOND_MOVE;
+        if (speed <= p.vstop) {
+            m->v_fine = 0;
+            m->zerowait = (m->reg[TMC5160_TZEROWAIT] & TMC5160_TZEROWAIT_MASK) * TMC5160_TZEROWAIT_UNIT;
+            return;
+        }
+        int64_t limit = (p.v1 > 0 && speed > p.v1) ? p.v1 : 0;
+        ramp_advance(m, dir * limit, (speed > p.v1) ? p.dmax : p.d1, n);
+        if (m->v_fine == 0) {
+            m->zerowait = (m->reg[TMC5160_TZEROWAIT] & TMC5160_TZEROWAIT_MASK) * TMC5160_TZEROWAIT_UNIT;
+        }
+        return;
+    }
+
+    if (remaining <= ramp_brake_distance(&p, speed) + substep) {
+        // Braking towards VSTOP, which is held until the target
+        approach = true;
+        if (speed < p.vstop) {
+            ramp_advance(m, dir * p.vstop, p.a1, n);
+        } else if (p.v1 > 0 && speed > p.v1) {
+            ramp_advance(m, dir * (p.v1 > p.vstop ? p.v1 : p.vstop), p.dmax, n);
+        } else {
+            ramp_advance(m, dir * p.vstop, p.d1, n);
+        }
+    } else if (speed > p.vmax) {
+        ramp_advance(m, dir * p.vmax, (p.v1 > 0 && speed <= p.v1) ? p.d1 : p.dmax, n);
+    } else if (speed < p.vmax) {
+        if (p.v1 > 0 && speed < p.v1 && p.v1 < p.vmax) {
+            ramp_advance(m, dir * p.v1, p.a1, n);
+        } else {
+            ramp_advance(m, dir * p.vmax, (p.v1 > 0 && speed < p.v1) ? p.a1 : p.amax, n);
+        }
+    } else {
+        ramp_advance(m, m->v_fine, 0, n);
+    }
+
+    // Crossing the target: stop on it when the remaining braking distance is
+    // below one microstep, otherwise overshoot and come back with a second move.
+    if (approach && ramp_remaining(m, dir) <= 0.0 && ramp_brake_distance(&p, abs64(m->v_fine)) < 1.0) {
+        ramp_arrive(m);
+    }
+}
+
+static void ramp_velocity(struct tmc5160_model *m, int64_t target, uint32_t n) {
+    struct ramp_params p;
+    ramp_read_params(m, &p);
+
+    // Velocity mode uses AMAX for both acceleration and deceleration.
+    ramp_advance(m, target, p.amax, n);
+}
+
+static int64_t floor_div(int64_t num, int64_t den) {
+    int64_t q = num / den;
+    return (num % den != 0 && (num < 0) != (den < 0)) ? q - 1 : q;
+}
+
+/**
+ * @brief Encoder count of the motor position XACTUAL + slip.
+ */
+static int64_t encoder_count(const struct tmc5160_model *m) {
+    if (m->enc_counts == 0) {
+        return 0;
+    }
+    return floor_div(((int64_t)m->xactual + m->slip) * m->enc_counts, m->enc_usteps);
+}
+
+/**
+ * @brief X_ENC: every count adds ENC_CONST, the fraction carried over.
+ */
+static int32_t encoder_x_enc(const struct tmc5160_model *m) {
+    uint32_t enc_const = m->reg[TMC5160_ENC_CONST];
+    int64_t factor, scale;
+
+    if (m->reg[TMC5160_ENCMODE] & TMC5160_ENCMODE_DECIMAL) {
+        factor = (int64_t)(int16_t)(enc_const >> 16) * 10000 + (enc_const & 0xFFFF);
+        scale = 10000;
+    } else {
+        factor = (int32_t)enc_const;
+        scale = 65536;
+    }
+    return m->x_enc_base + (int32_t)floor_div((encoder_count(m) - m->enc_base) * factor, scale);
+}
+
+/**
+ * @brief Starts a new accumulation of X_ENC from its present value.
+ */
+static void encoder_rebase(struct tmc5160_model *m) {
+    m->x_enc_base = encoder_x_enc(m);
+    m->enc_base = encoder_count(m);
+}
+
+void tmc5160_model_reset(struct tmc5160_model *m) {
+    memset(m, 0, sizeof(*m));
+    m->reg[TMC5160_GSTAT] = 0x01; // reset
+}
+
+void tmc5160_model_step(struct tmc5160_model *m, uint32_t clocks) {
+    while (clocks > 0) {
+        uint32_t n = (clocks > TMC5160_MODEL_SUBSTEP) ? TMC5160_MODEL_SUBSTEP : clocks;
+        clocks -= n;
+        m->clocks += n;
+
+        if (m->zerowait) {
+            uint32_t wait = (m->zerowait < n) ? m->zerowait : n;
+            m->zerowait -= wait;
+            n -= wait;
+            if (n == 0) {
+                continue;
+            }
+        }
+
+        int64_t vmax = (int64_t)(m->reg[TMC5160_VMAX] & TMC5160_VMAX_MASK) << V_SHIFT;
+
+        switch (m->reg[TMC5160_RAMPMODE] & 0x3) {
+            case RAMPMODE_POSITION:
+                ramp_position(m, n);
+                break;
+            case RAMPMODE_VELOCITY_POS:
+                ramp_velocity(m, vmax, n);
+                break;
+            case RAMPMODE_VELOCITY_NEG:
+                ramp_velocity(m, -vmax, n);
+                break;
+            default:
+                ramp_advance(m, m->v_fine, 0, n); // Hold the current velocity
+                break;
+        }
+    }
+}
+
+void tmc5160_model_write(struct tmc5160_model *m, uint8_t address, uint32_t value) {
+    address &= 0x7F;
+
+    switch (address) {
+        case TMC5160_GSTAT:
+            m->reg[address] &= ~value; // Write 1 to clear
+            if (value & TMC5160_GSTAT_DRV_ERR) {
+                m->drv_flags &= ~TMC5160_DRV_ERRORS;
+            }
+            break;
+        case TMC5160_RAMP_STAT:
+            m->events &= ~(value & RAMP_STAT_EVENTS);
+            break;
+        case TMC5160_XACTUAL:
+            // The motor does not move: the encoder keeps its count
+            m->slip += m->xactual - (int32_t)value;
+            m->xactual = (int32_t)value;
+            m->x_fine = 0;
+            break;
+        case TMC5160_X_ENC:
+            m->x_enc_base = (int32_t)value;
+            m->enc_base = encoder_count(m);
+            break;
+        case TMC5160_ENC_CONST:
+        case TMC5160_ENCMODE:
+            encoder_rebase(m);
+            m->reg[address] = value;
+            break;
+        case TMC5160_VACTUAL:
+        case TMC5160_DRV_STATUS:
+        case TMC5160_IOIN:
+            break; // Read only
+        default:
+            m->reg[address] = value;
+            break;
+    }
+}
+
+int32_t tmc5160_model_vactual(const struct tmc5160_model *m) {
+    return (int32_t)(m->v_fine / ((int64_t)1 << V_SHIFT));
+}
+
+static uint32_t tmc5160_model_ramp_stat(const struct tmc5160_model *m) {
+    uint32_t stat = m->events;
+    int32_t vactual = tmc5160_model_vactual(m);
+    int32_t vmax = (int32_t)(m->reg[TMC5160_VMAX] & TMC5160_VMAX_MASK);
+
+    if (vactual == 0) {
+        stat |= TMC5160_RAMP_STAT_VZERO;
+    }
+    if (vactual == vmax || vactual == -vmax) {
+        stat |= TMC5160_RAMP_STAT_VELOCITY_REACHED;
+    }
+    if (m->xactual == (int32_t)m->reg[TMC5160_XTARGET]) {
+        stat |= TMC5160_RAMP_STAT_POSITION_REACHED;
+    }
+    if (m->zerowait) {
+        stat |= TMC5160_RAMP_STAT_T_ZEROWAIT_ACTIVE;
+    }
+    return stat;
+}
+
+uint32_t tmc5160_model_read(const struct tmc5160_model *m, uint8_t address) {
+    address &= 0x7F;
+
+    if (!tmc5160_model_is_readable(address)) {
+        return 0;
+    }
+
+    switch (address) {
+        case TMC5160_IOIN:
+            return (uint32_t)TMC5160_VERSION << 24;
+        case TMC5160_XACTUAL:
+            return (uint32_t)m->xactual;
+        case TMC5160_VACTUAL:
+            return (uint32_t)tmc5160_model_vactual(m) & 0x00FFFFFF; // 24-bit two's complement
+        case TMC5160_RAMP_STAT:
+            return tmc5160_model_ramp_stat(m);
+        case TMC5160_X_ENC:
+            return (uint32_t)encoder_x_enc(m);
+        case TMC5160_DRV_STATUS: {
+            uint32_t ihold_irun = m->reg[TMC5160_IHOLD_IRUN];
+            bool standstill = (m->v_fine == 0);
+            uint32_t cs_actual = standstill ? ihold_irun & 0x1F : (ihold_irun >> 8) & 0x1F;
+            uint32_t status = m->drv_flags | (cs_actual << 16) | TMC5160_SG_RESULT_IDLE;
+            if (standstill) {
+                status |= TMC5160_DRV_STATUS_STST;
+            }
+            return status;
+        }
+        default:
+            return m->reg[address];
+    }
+}
+
+uint8_t tmc5160_model_status(const struct tmc5160_model *m) {
+    uint32_t stat = tmc5160_model_ramp_stat(m);
+    uint8_t status = 0;
+
+    if (m->reg[TMC5160_GSTAT] & 0x01) {
+        status |= TMC5160_SPI_STATUS_RESET;
+    }
+    if (m->reg[TMC5160_GSTAT] & TMC5160_GSTAT_DRV_ERR) {
+        status |= TMC5160_SPI_STATUS_DRIVER_ERROR;
+    }
+    if (m->v_fine == 0) {
+        status |= TMC5160_SPI_STATUS_STANDSTILL;
+    }
+    if (stat & TMC5160_RAMP_STAT_VELOCITY_REACHED) {
+        status |= TMC5160_SPI_STATUS_VELOCITY_REACHED;
+    }
+    if (stat & TMC5160_RAMP_STAT_POSITION_REACHED) {
+        status |= TMC5160_SPI_STATUS_POSITION_REACHED;
+    }
+    return status;
+}
+
+void tmc5160_model_set_encoder(struct tmc5160_model *m, uint32_t counts, uint32_t usteps) {
+    m->enc_counts = counts;
+    m->enc_usteps = usteps;
+    m->enc_base = encoder_count(m);
+    m->x_enc_base = 0;
+}
+
+void tmc5160_model_slip(struct tmc5160_model *m, int32_t usteps) {
+    m->slip += usteps;
+}
+
+void tmc5160_model_set_driver_flags(struct tmc5160_model *m, uint32_t flags) {
+    m->drv_flags = (m->drv_flags & TMC5160_DRV_ERRORS) | flags;
+    if (flags & TMC5160_DRV_ERRORS) {
+        m->reg[TMC5160_GSTAT] |= TMC5160_GSTAT_DRV_ERR;
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef MODEL_TMC5160_MODEL_H_
+#define MODEL_TMC5160_MODEL_H_
+
+#include <stdint.h>
+
+// Behavioural model of the TMC5160 register interface and ramp generator.
+// Register addresses are the ones of Core/Src/Peripheral/Inc/tmc5160.h.
+//
+// The ramp generator works in the chip's units (datasheet, 12.1):
+//   velocity      v [usteps/s]   = v * fCLK / 2^24
+//   acceleration  a [usteps/s^2] = a * fCLK^2 / 2^41
+// so a velocity changes by 'a' every 2^17 clocks, and stopping from v with
+// deceleration d takes (v^2 - vstop^2) / (256 * d) microsteps.
+//
+// Modelled: RAMPMODE (positioning, velocity +/-, hold), the six-point ramp
+// VSTART/A1/V1/AMAX/VMAX/DMAX/D1/VSTOP, TZEROWAIT after every stop and
+// direction inversion, overshoot and return when XTARGET moves behind the
+// braking distance, and the RAMP_STAT/SPI_STATUS flags, and an A/B encoder
+// on the motor shaft counted into X_ENC with ENC_CONST (binary or decimal),
+// and the driver error flags raised with tmc5160_model_set_driver_flags().
+// The motor follows XACTUAL except for the steps lost with
+// tmc5160_model_slip(). Not modelled: StallGuard, switches, the N channel,
+// the power stage (a driver error does not stop the motor).
+
+#define TMC5160_MODEL_FCLK      12000000 // Internal clock, the time base of all ramp registers
+
+// Decisions (accelerate, cruise, brake) are taken every SUBSTEP clocks
+// (21 us); velocity and position are integrated exactly within a substep.
+#define TMC5160_MODEL_SUBSTEP   256
+
+// RAMP_STAT bits
+#define TMC5160_RAMP_STAT_EVENT_POS_REACHED (1u << 7)
+#define TMC5160_RAMP_STAT_VELOCITY_REACHED  (1u << 8)
+#define TMC5160_RAMP_STAT_POSITION_REACHED  (1u << 9)
+#define TMC5160_RAMP_STAT_VZERO             (1u << 10)
+#define TMC5160_RAMP_STAT_T_ZEROWAIT_ACTIVE (1u << 11)
+#define TMC5160_RAMP_STAT_SECOND_MOVE       (1u << 12)
+
+// SPI_STATUS bits, returned with every datagram
+#define TMC5160_SPI_STATUS_RESET            (1u << 0)
+#define TMC5160_SPI_STATUS_DRIVER_ERROR     (1u << 1)
+#define TMC5160_SPI_STATUS_STANDSTILL       (1u << 3)
+#define TMC5160_SPI_STATUS_VELOCITY_REACHED (1u << 4)
+#define TMC5160_SPI_STATUS_POSITION_REACHED (1u << 5)
+
+struct tmc5160_model {
+    uint32_t reg[128];     // Last value written, or the power-up value
+    int32_t xactual;
+    int64_t v_fine;        // Velocity in 2^-17 units of VMAX: one clock adds 'a'
+    int64_t x_fine;        // Position remainder in 2^-41 usteps, 0 <= x_fine < 2^41
+    uint32_t zerowait;     // Clocks left of TZEROWAIT
+    uint32_t events;       // RAMP_STAT event flags (write 1 to clear)
+    uint64_t clocks;       // Clocks stepped since the reset
+    int32_t slip;          // Motor position - XACTUAL, in usteps
+    uint32_t enc_counts;   // Encoder counts per 'enc_usteps' of motor travel, 0 = no encoder
+    uint32_t enc_usteps;
+    int64_t enc_base;      // Encoder count at the last write of X_ENC, ENC_CONST or ENCMODE
+    int32_t x_enc_base;    // X_ENC at that count
+    uint32_t drv_flags;    // DRV_STATUS error flags
+};
+
+/**
+ * @brief Power-up state: all registers 0, GSTAT reset flag set, motor at rest.
+ */
+void tmc5160_model_reset(struct tmc5160_model *m);
+
+/**
+ * @brief Advances the ramp generator by 'clocks' periods of fCLK.
+ */
+void tmc5160_model_step(struct tmc5160_model *m, uint32_t clocks);
+
+/**
+ * @brief Register write as done by an SPI write datagram.
+ */
+void tmc5160_model_write(struct tmc5160_model *m, uint8_t address, uint32_t value);
+
+/**
+ * @brief Register read as returned by the datagram after a read request.
+ *        Write-only registers read as 0.
+ */
+uint32_t tmc5160_model_read(const struct tmc5160_model *m, uint8_t address);
+
+/**
+ * @brief SPI_STATUS byte, sent as the first byte of every reply.
+ */
+uint8_t tmc5160_model_status(const struct tmc5160_model *m);
+
+/**
+ * @brief Actual velocity (VACTUAL, sign-extended) in the unit of VMAX.
+ */
+int32_t tmc5160_model_vactual(const struct tmc5160_model *m);
+
+/**
+ * @brief Mounts an encoder with 'counts' per 'usteps' of motor travel
+ *        (e.g. 4000 per 51200 for a 1000 line encoder on a 200 step motor
+ *        at 256 microsteps).
+ */
+void tmc5160_model_set_encoder(struct tmc5160_model *m, uint32_t counts, uint32_t usteps);
+
+/**
+ * @brief Moves the motor by 'usteps' against XACTUAL: lost steps.
+ */
+void tmc5160_model_slip(struct tmc5160_model *m, int32_t usteps);
+
+/**
+ * @brief Sets the DRV_STATUS error flags (TMC5160_DRV_STATUS_OT, _OTPW,
+ *        _S2GA, ...). As on the chip, overtemperature and the shorts set
+ *        GSTAT drv_err and stay until it is cleared; the warnings follow
+ *        the last call.
+ */
+void tmc5160_model_set_driver_flags(struct tmc5160_model *m, uint32_t flags);
+
+#endif /* MODEL_TMC5160_MODEL_H_ */
@@ -0,0 +1,36 @@
+#ifndef SIM_INC_FLASH_H_
+#define SIM_INC_FLASH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// Host stand-in for Core/Src/Peripheral/Inc/flash.h. Sectors 10 and 11 are a
+// RAM array with NOR semantics (programming only clears bits), mirrored to the
+// file given to sim_flash_open() so stored parameters survive a restart.
+
+#define FLASH_SECTOR_128K_SIZE  0x00020000
+
+extern uint8_t sim_flash[2][FLASH_SECTOR_128K_SIZE];
+
+#define FLASH_SECTOR_10_ADDR    ((uintptr_t)sim_flash[0])
+#define FLASH_SECTOR_11_ADDR    ((uintptr_t)sim_flash[1])
+
+/**
+ * @brief Erases sector 10 or 11 to 0xFF.
+ * @return 0 on success, -1 for any other sector.
+ */
+int flash_erase_sector(uint32_t sector);
+
+/**
+ * @brief Programs 32-bit words inside sectors 10/11 (new = old & data).
+ * @return 0 on success, -1 if the range is outside the two sectors.
+ */
+int flash_program(uintptr_t address, const uint32_t *data, size_t words);
+
+/**
+ * @brief Never busy: erase and program complete at once.
+ */
+bool flash_is_busy(void);
+
+#endif /* SIM_INC_FLASH_H_ */
@@ -0,0 +1,60 @@
+#ifndef SIM_INC_SPI_H_
+#define SIM_INC_SPI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host stand-in for Core/Src/Peripheral/Inc/spi.h. Each chip select is
+// connected to a TMC5160 register model (tmc5160_model.h), so tmc5160.c runs
+// unchanged; chip selects without a model read all zeros, as an unfitted chip.
+// A daisy chain shifts one datagram per chained model in each chip select
+// cycle; chain positions without a model pass nothing on and read zeros.
+
+#define SPI1_CS_COUNT   4
+
+// With -DSPI1_DAISY_CHAIN_LENGTH=<chips> the models are chained behind chip
+// select 0 instead, as on the boards built that way.
+#ifndef SPI1_DAISY_CHAIN_LENGTH
+#define SPI1_DAISY_CHAIN_LENGTH 0
+#endif
+
+// As on the target; the simulated motion timer never preempts anyway
+#define SPI1_LOCK_PRIORITY  6
+
+/**
+ * @brief Resets the TMC5160 models (power-up register values) and their clock.
+ */
+void spi1_init(void);
+
+/**
+ * @brief Starts a 40-bit datagram. The models are advanced to the current time
+ *        first, so reads return the state of the ramp at this instant.
+ * @param cs Chip select 0 to SPI1_CS_COUNT - 1.
+ */
+void spi1_cs_select(uint8_t cs);
+
+/**
+ * @brief Ends a datagram: a write is applied, a read request latches the data
+ *        returned by the next datagram.
+ * @param cs Chip select 0 to SPI1_CS_COUNT - 1.
+ */
+void spi1_cs_deselect(uint8_t cs);
+
+/**
+ * @brief Shifts one byte in and out.
+ * @return SPI_STATUS for the first byte of a datagram, then the latched data MSB first.
+ */
+uint8_t spi1_transfer(uint8_t data);
+
+/**
+ * @brief spi1_cs_select(), 'n' times spi1_transfer(), spi1_cs_deselect().
+ */
+void spi1_transfer_dma(uint8_t cs, const uint8_t *tx, uint8_t *rx, size_t n);
+
+/**
+ * @brief No interrupt preempts the simulator's main loop: nothing to mask.
+ */
+uint32_t spi1_lock(void);
+void spi1_unlock(uint32_t key);
+
+#endif /* SIM_INC_SPI_H_ */
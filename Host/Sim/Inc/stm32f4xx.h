@@ -0,0 +1,13 @@
+#ifndef SIM_INC_STM32F4XX_H_
+#define SIM_INC_STM32F4XX_H_
+
+// Host stand-in for the CMSIS device header. Only what the portable firmware
+// code (app.c) uses is provided; the register-level drivers are not built.
+
+/**
+ * @brief Restarts the simulator process with its original arguments, so an
+ *        NMT reset behaves like on the target (stored parameters are reloaded).
+ */
+__attribute__((noreturn)) void NVIC_SystemReset(void);
+
+#endif /* SIM_INC_STM32F4XX_H_ */
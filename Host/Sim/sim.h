@@ -0,0 +1,54 @@
+#ifndef SIM_SIM_H_
+#define SIM_SIM_H_
+
+#include <stdint.h>
+
+// Set-up of the host simulator, called by sim_main.c before app_init().
+
+/**
+ * @brief Opens and binds a SocketCAN raw socket (e.g. vcan "can0").
+ * @return 0 on success, -1 on error (errno set).
+ */
+int sim_can_open(const char *ifname);
+
+/**
+ * @brief Closes the CAN socket (before the process is restarted).
+ */
+void sim_can_close(void);
+
+/**
+ * @brief Blocks until a CAN frame is available or 'timeout_ms' elapsed.
+ */
+void sim_can_wait(int timeout_ms);
+
+/**
+ * @brief Loads the flash image from 'path' (created erased if missing) and
+ *        mirrors every later erase/program to it.
+ * @return 0 on success, -1 on error (errno set).
+ */
+int sim_flash_open(const char *path);
+
+/**
+ * @brief Number of TMC5160 models on SPI1, on chip selects 0 to count - 1
+ *        (default 1). Call it before spi1_init().
+ */
+void sim_spi_set_chips(unsigned int count);
+
+/**
+ * @brief Sets the DRV_STATUS error flags of the TMC5160 model on chip
+ *        select 'cs' (see tmc5160_model_set_driver_flags()).
+ */
+void sim_spi_set_driver_flags(unsigned int cs, uint32_t flags);
+
+/**
+ * @brief Monotonic time in nanoseconds, the time base of the simulator.
+ */
+uint64_t sim_time_ns(void);
+
+/**
+ * @brief Runs the motion timer handler for the ticks elapsed since the last
+ *        call; the simulator has no interrupts, so sim_main.c polls it.
+ */
+void sim_motion_timer_poll(void);
+
+#endif /* SIM_SIM_H_ */
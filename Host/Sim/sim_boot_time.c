@@ -0,0 +1,48 @@
+#include "boot_time.h"
+#include "sim.h"
+
+#include <lely/co/obj.h>
+
+// On the host the "cycle counter" counts nanoseconds of sim_time_ns().
+static uint64_t boot_time_start_ns = 0;
+static uint32_t boot_time_us[BOOT_PHASE_COUNT];
+static co_dev_t *boot_time_dev = NULL;
+
+static void boot_time_publish(boot_phase_t phase) {
+    if (boot_time_dev) {
+        co_dev_set_val_u32(boot_time_dev, BOOT_TIME_OBJ, (co_unsigned8_t)(phase + 1), boot_time_us[phase]);
+    }
+}
+
+uint32_t boot_time_start(void) {
+    boot_time_start_ns = sim_time_ns();
+    return 0;
+}
+
+uint32_t boot_time_cycles(void) {
+    return (uint32_t)(sim_time_ns() - boot_time_start_ns);
+}
+
+uint32_t boot_time_cycles_to_us(uint32_t cycles) {
+    return cycles / 1000u;
+}
+
+uint32_t boot_time_record(boot_phase_t phase, uint32_t start) {
+    uint32_t now = boot_time_cycles();
+
+    boot_time_us[phase] = (now - start) / 1000u;
+
+    if (phase < BOOT_PHASE_BOOTUP) {
+        boot_time_us[BOOT_PHASE_BOOTUP] += boot_time_us[phase];
+    }
+    boot_time_publish(phase);
+    return now;
+}
+
+void boot_time_init(co_dev_t *dev) {
+    boot_time_dev = dev;
+
+    for (int phase = 0; phase < BOOT_PHASE_COUNT; phase++) {
+        boot_time_publish((boot_phase_t)phase);
+    }
+}
@@ -0,0 +1,136 @@
+#include "can.h"
+#include "sim.h"
+#include "boot_time.h"
+
+#include <linux/can.h>
+#include <net/if.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static int sim_can_fd = -1;
+static uint32_t sim_can_sync_id = 0x80;
+static uint32_t sim_can_sync_cycles = 0;
+static uint32_t sim_can_watch_ids[CAN_WATCH_COUNT] = { CAN_WATCH_NONE, CAN_WATCH_NONE, CAN_WATCH_NONE, CAN_WATCH_NONE };
+static uint32_t sim_can_watch_counts[CAN_WATCH_COUNT];
+static uint32_t sim_can_watch_cycles[CAN_WATCH_COUNT];
+
+int sim_can_open(const char *ifname) {
+    struct ifreq ifr;
+    struct sockaddr_can addr;
+
+    sim_can_fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (sim_can_fd < 0) {
+        return -1;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1);
+    if (ioctl(sim_can_fd, SIOCGIFINDEX, &ifr) < 0) {
+        sim_can_close();
+        return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(sim_can_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        sim_can_close();
+        return -1;
+    }
+    return 0;
+}
+
+void sim_can_close(void) {
+    if (sim_can_fd >= 0) {
+        close(sim_can_fd);
+        sim_can_fd = -1;
+    }
+}
+
+void sim_can_wait(int timeout_ms) {
+    struct pollfd pfd = { .fd = sim_can_fd, .events = POLLIN };
+    poll(&pfd, 1, timeout_ms);
+}
+
+void can_init(bool loopback_mode) {
+    (void)loopback_mode; // The socket is opened by sim_can_open()
+}
+
+size_t can_recv(struct can_msg *msgs, size_t n) {
+    size_t count = 0;
+
+    while (count < n) {
+        struct can_frame frame;
+        if (recv(sim_can_fd, &frame, sizeof(frame), MSG_DONTWAIT) != (ssize_t)sizeof(frame)) {
+            break;
+        }
+        if (frame.can_id & CAN_ERR_FLAG) {
+            continue;
+        }
+
+        struct can_msg *msg = &msgs[count++];
+        memset(msg, 0, sizeof(*msg));
+        if (frame.can_id & CAN_EFF_FLAG) {
+            msg->id = frame.can_id & CAN_EFF_MASK;
+            msg->flags |= CAN_FLAG_IDE;
+        } else {
+            msg->id = frame.can_id & CAN_SFF_MASK;
+        }
+        if (frame.can_id & CAN_RTR_FLAG) {
+            msg->flags |= CAN_FLAG_RTR;
+        }
+        msg->len = (frame.can_dlc > CAN_MAX_DLEN) ? CAN_MAX_DLEN : frame.can_dlc;
+        memcpy(msg->data, frame.data, msg->len);
+
+        // No receive interrupt: the SYNC and the watched frames are taken as
+        // received when read
+        if (!(msg->flags & CAN_FLAG_IDE) && msg->id == sim_can_sync_id) {
+            sim_can_sync_cycles = boot_time_cycles();
+        }
+        for (unsigned int slot = 0; slot < CAN_WATCH_COUNT; slot++) {
+            if (!(msg->flags & CAN_FLAG_IDE) && msg->id == sim_can_watch_ids[slot]) {
+                sim_can_watch_cycles[slot] = boot_time_cycles();
+                sim_can_watch_counts[slot]++;
+            }
+        }
+    }
+    return count;
+}
+
+void can_set_sync_id(uint32_t id) {
+    sim_can_sync_id = id;
+}
+
+uint32_t can_sync_cycles(void) {
+    return sim_can_sync_cycles;
+}
+
+void can_watch(unsigned int slot, uint32_t id) {
+    sim_can_watch_ids[slot] = id;
+}
+
+uint32_t can_watch_count(unsigned int slot, uint32_t *cycles) {
+    *cycles = sim_can_watch_cycles[slot];
+    return sim_can_watch_counts[slot];
+}
+
+size_t can_send(const struct can_msg *msg) {
+    struct can_frame frame;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.can_id = msg->id;
+    if (msg->flags & CAN_FLAG_IDE) {
+        frame.can_id |= CAN_EFF_FLAG;
+    }
+    if (msg->flags & CAN_FLAG_RTR) {
+        frame.can_id |= CAN_RTR_FLAG;
+    }
+    frame.can_dlc = (msg->len > CAN_MAX_DLEN) ? CAN_MAX_DLEN : msg->len;
+    memcpy(frame.data, msg->data, frame.can_dlc);
+
+    // Blocking write: a full socket queue stalls like a busy bus instead of dropping.
+    return write(sim_can_fd, &frame, sizeof(frame)) == (ssize_t)sizeof(frame);
+}
@@ -0,0 +1,74 @@
+#include "flash.h"
+#include "sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Sector numbers of the target (RM0090) that the log uses
+#define SIM_FLASH_FIRST_SECTOR  10
+
+uint8_t sim_flash[2][FLASH_SECTOR_128K_SIZE];
+
+static FILE *sim_flash_file = NULL;
+
+static void sim_flash_sync(const uint8_t *from, size_t n) {
+    if (!sim_flash_file) {
+        return;
+    }
+    fseek(sim_flash_file, (long)(from - &sim_flash[0][0]), SEEK_SET);
+    fwrite(from, 1, n, sim_flash_file);
+    fflush(sim_flash_file);
+}
+
+int sim_flash_open(const char *path) {
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+
+    sim_flash_file = fopen(path, "r+b");
+    if (sim_flash_file) {
+        if (fread(sim_flash, 1, sizeof(sim_flash), sim_flash_file) == sizeof(sim_flash)) {
+            return 0;
+        }
+        fclose(sim_flash_file); // Short or damaged image: start erased
+    }
+
+    sim_flash_file = fopen(path, "w+b");
+    if (!sim_flash_file) {
+        return -1;
+    }
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+    sim_flash_sync(&sim_flash[0][0], sizeof(sim_flash));
+    return 0;
+}
+
+int flash_erase_sector(uint32_t sector) {
+    if (sector < SIM_FLASH_FIRST_SECTOR || sector > SIM_FLASH_FIRST_SECTOR + 1) {
+        return -1;
+    }
+    uint8_t *base = sim_flash[sector - SIM_FLASH_FIRST_SECTOR];
+    memset(base, 0xFF, FLASH_SECTOR_128K_SIZE);
+    sim_flash_sync(base, FLASH_SECTOR_128K_SIZE);
+    return 0;
+}
+
+int flash_program(uintptr_t address, const uint32_t *data, size_t words) {
+    uintptr_t begin = (uintptr_t)&sim_flash[0][0];
+    size_t n = words * sizeof(uint32_t);
+
+    if (address < begin || address - begin > sizeof(sim_flash) - n || (address & 3) != 0) {
+        return -1;
+    }
+
+    uint8_t *dst = (uint8_t *)address;
+    for (size_t i = 0; i < words; i++) {
+        uint32_t word;
+        memcpy(&word, dst + i * sizeof(word), sizeof(word));
+        word &= data[i]; // NOR flash: programming only clears bits
+        memcpy(dst + i * sizeof(word), &word, sizeof(word));
+    }
+    sim_flash_sync(dst, n);
+    return 0;
+}
+
+bool flash_is_busy(void) {
+    return false;
+}
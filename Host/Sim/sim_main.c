@@ -0,0 +1,92 @@
+#include "app.h"
+#include "boot_time.h"
+#include "can.h"
+#include "sim.h"
+#include "spi.h"
+#include "stm32f4xx.h"
+#include "systick.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Host simulator of the CANopen TMC5160 node: app.c with the TMC5160 model
+// behind SPI, a SocketCAN interface behind can.h and a file behind the flash.
+//
+// Usage: canopen_tmc_sim [-c channel] [-f flash_image] [-a axes]
+
+#define SIM_DEFAULT_CHANNEL     "can0"
+#define SIM_DEFAULT_FLASH       "sim_flash.bin"
+
+// Longest sleep between two app_poll() calls
+#define SIM_POLL_MS             1
+
+static char **sim_argv = NULL;
+
+void NVIC_SystemReset(void) {
+    sim_can_close();
+    execv("/proc/self/exe", sim_argv);
+    perror("execv");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+    const char *channel = SIM_DEFAULT_CHANNEL;
+    const char *flash = SIM_DEFAULT_FLASH;
+    int opt;
+
+    sim_argv = argv;
+
+    while ((opt = getopt(argc, argv, "c:f:a:h")) != -1) {
+        switch (opt) {
+            case 'c':
+                channel = optarg;
+                break;
+            case 'f':
+                flash = optarg;
+                break;
+            case 'a': {
+                // TMC5160 models fitted: one CiA 402 axis each
+                int axes = atoi(optarg);
+                if (axes < 1 || axes > SPI1_CS_COUNT) {
+                    fprintf(stderr, "%s: axes must be 1 to %d\n", argv[0], SPI1_CS_COUNT);
+                    return EXIT_FAILURE;
+                }
+                sim_spi_set_chips((unsigned int)axes);
+                break;
+            }
+            default:
+                fprintf(stderr, "Usage: %s [-c channel] [-f flash_image] [-a axes]\n", argv[0]);
+                return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (sim_can_open(channel) < 0) {
+        fprintf(stderr, "%s: cannot open CAN interface '%s': %s\n", argv[0], channel, strerror(errno));
+        return EXIT_FAILURE;
+    }
+    if (sim_flash_open(flash) < 0) {
+        fprintf(stderr, "%s: cannot open flash image '%s': %s\n", argv[0], flash, strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    // Same start-up as main.c, without the clock tree
+    uint32_t t = boot_time_start();
+
+    systick_init();
+    spi1_init();
+    can_init(false);
+    t = boot_time_record(BOOT_PHASE_PERIPHERALS, t);
+
+    app_init(t);
+
+    while (1) {
+        app_poll();
+        sim_motion_timer_poll();
+        sim_can_wait(SIM_POLL_MS);
+    }
+
+    return EXIT_SUCCESS;
+}
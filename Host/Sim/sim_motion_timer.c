@@ -0,0 +1,50 @@
+#include "motion_timer.h"
+#include "sim.h"
+
+#include <stddef.h>
+
+// Ticks caught up at most per poll, after the process has been held up
+#define SIM_MOTION_TIMER_CATCH_UP   64
+
+static void (*sim_motion_timer_handler)(void) = NULL;
+static uint32_t sim_motion_timer_period = MOTION_TIMER_PERIOD_US;
+static uint64_t sim_motion_timer_next_ns = 0;
+
+static bool sim_motion_timer_is_valid(uint32_t period_us) {
+    return period_us >= MOTION_TIMER_PERIOD_MIN_US && period_us <= MOTION_TIMER_PERIOD_MAX_US;
+}
+
+void motion_timer_start(uint32_t period_us, void (*handler)(void)) {
+    sim_motion_timer_handler = handler;
+    sim_motion_timer_period = sim_motion_timer_is_valid(period_us) ? period_us : MOTION_TIMER_PERIOD_US;
+    sim_motion_timer_next_ns = sim_time_ns() + sim_motion_timer_period * 1000u;
+}
+
+bool motion_timer_set_period(uint32_t period_us) {
+    if (!sim_motion_timer_is_valid(period_us)) {
+        return false;
+    }
+    sim_motion_timer_period = period_us;
+    sim_motion_timer_next_ns = sim_time_ns() + period_us * 1000u;
+    return true;
+}
+
+uint32_t motion_timer_period_us(void) {
+    return sim_motion_timer_period;
+}
+
+void sim_motion_timer_poll(void) {
+    uint64_t now = sim_time_ns();
+    unsigned int ticks = 0;
+
+    if (sim_motion_timer_handler == NULL) {
+        return;
+    }
+    while (sim_motion_timer_next_ns <= now && ticks++ < SIM_MOTION_TIMER_CATCH_UP) {
+        sim_motion_timer_handler();
+        sim_motion_timer_next_ns += sim_motion_timer_period * 1000u;
+    }
+    if (sim_motion_timer_next_ns <= now) {
+        sim_motion_timer_next_ns = now + sim_motion_timer_period * 1000u;
+    }
+}
@@ -0,0 +1,152 @@
+#include "spi.h"
+#include "sim.h"
+#include "tmc5160_model.h"
+
+#include <stddef.h>
+
+#define SIM_SPI_DATAGRAM_SIZE   5
+
+// Datagrams per chip select cycle: one per chained model, or just one
+#define SIM_SPI_FRAME_DATAGRAMS ((SPI1_DAISY_CHAIN_LENGTH) ? (SPI1_DAISY_CHAIN_LENGTH) : 1)
+#define SIM_SPI_FRAME_SIZE      (SIM_SPI_DATAGRAM_SIZE * SIM_SPI_FRAME_DATAGRAMS)
+
+static struct tmc5160_model sim_tmc5160[SPI1_CS_COUNT];
+static unsigned int sim_spi_chips = 1; // TMC5160 models on chip selects 0 to sim_spi_chips - 1
+static uint64_t sim_spi_last_ns = 0;
+static uint64_t sim_spi_pending_ns = 0; // Time not yet stepped, less than 250 ns
+
+// 250 ns are exactly 3 periods of the 12 MHz fCLK
+#define SIM_SPI_NS_PER_3_CLOCKS 250
+_Static_assert(TMC5160_MODEL_FCLK == 12000000, "SIM_SPI_NS_PER_3_CLOCKS assumes a 12 MHz fCLK");
+
+static uint8_t sim_spi_rx[SIM_SPI_FRAME_SIZE];
+static uint8_t sim_spi_tx[SIM_SPI_FRAME_SIZE];
+static size_t sim_spi_count = 0;
+static uint8_t sim_spi_cs = 0;
+static uint32_t sim_spi_latched[SPI1_CS_COUNT]; // Data requested by the previous read datagram
+
+static void sim_spi_advance(void) {
+    uint64_t now = sim_time_ns();
+
+    sim_spi_pending_ns += now - sim_spi_last_ns;
+    sim_spi_last_ns = now;
+
+    uint64_t clocks = (sim_spi_pending_ns / SIM_SPI_NS_PER_3_CLOCKS) * 3;
+    sim_spi_pending_ns %= SIM_SPI_NS_PER_3_CLOCKS;
+
+    // Step in slices that keep the model's 32-bit clock argument in range.
+    // All chips share the time base, as they share the clock on the board.
+    while (clocks > 0) {
+        uint32_t n = (clocks > TMC5160_MODEL_FCLK) ? TMC5160_MODEL_FCLK : (uint32_t)clocks;
+        for (unsigned int cs = 0; cs < sim_spi_chips; cs++) {
+            tmc5160_model_step(&sim_tmc5160[cs], n);
+        }
+        clocks -= n;
+    }
+}
+
+void sim_spi_set_chips(unsigned int count) {
+    sim_spi_chips = (count > SPI1_CS_COUNT) ? SPI1_CS_COUNT : count;
+}
+
+void sim_spi_set_driver_flags(unsigned int cs, uint32_t flags) {
+    if (cs < SPI1_CS_COUNT) {
+        tmc5160_model_set_driver_flags(&sim_tmc5160[cs], flags);
+    }
+}
+
+void spi1_init(void) {
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        tmc5160_model_reset(&sim_tmc5160[cs]);
+        sim_spi_latched[cs] = 0;
+    }
+    sim_spi_last_ns = sim_time_ns();
+    sim_spi_pending_ns = 0;
+}
+
+/**
+ * @brief Model that datagram 'slot' of the frame on 'cs' reaches, -1 if none.
+ *        In a chain the first datagram is shifted on to the last chip.
+ */
+static int sim_spi_chip(uint8_t cs, size_t slot) {
+    unsigned int chip;
+
+    if (SPI1_DAISY_CHAIN_LENGTH) {
+        if (cs != 0) {
+            return -1;
+        }
+        chip = (unsigned int)(SIM_SPI_FRAME_DATAGRAMS - 1 - slot);
+    } else {
+        chip = cs;
+    }
+    return (chip < sim_spi_chips) ? (int)chip : -1;
+}
+
+void spi1_cs_select(uint8_t cs) {
+    sim_spi_count = 0;
+    sim_spi_cs = cs;
+    sim_spi_advance();
+
+    for (size_t slot = 0; slot < SIM_SPI_FRAME_DATAGRAMS; slot++) {
+        uint8_t *tx = &sim_spi_tx[SIM_SPI_DATAGRAM_SIZE * slot];
+        int chip = sim_spi_chip(cs, slot);
+
+        if (chip < 0) {
+            for (size_t i = 0; i < SIM_SPI_DATAGRAM_SIZE; i++) {
+                tx[i] = 0; // Nothing drives SDO
+            }
+            continue;
+        }
+        tx[0] = tmc5160_model_status(&sim_tmc5160[chip]);
+        tx[1] = (uint8_t)(sim_spi_latched[chip] >> 24);
+        tx[2] = (uint8_t)(sim_spi_latched[chip] >> 16);
+        tx[3] = (uint8_t)(sim_spi_latched[chip] >> 8);
+        tx[4] = (uint8_t)sim_spi_latched[chip];
+    }
+}
+
+uint8_t spi1_transfer(uint8_t data) {
+    if (sim_spi_count >= SIM_SPI_FRAME_SIZE) {
+        return 0;
+    }
+    sim_spi_rx[sim_spi_count] = data;
+    return sim_spi_tx[sim_spi_count++];
+}
+
+void spi1_cs_deselect(uint8_t cs) {
+    if (cs != sim_spi_cs || sim_spi_count != SIM_SPI_FRAME_SIZE) {
+        return; // Incomplete datagrams are ignored, as by the chip
+    }
+
+    for (size_t slot = 0; slot < SIM_SPI_FRAME_DATAGRAMS; slot++) {
+        const uint8_t *rx = &sim_spi_rx[SIM_SPI_DATAGRAM_SIZE * slot];
+        int chip = sim_spi_chip(cs, slot);
+        if (chip < 0) {
+            continue;
+        }
+
+        uint8_t address = rx[0];
+        uint32_t value = ((uint32_t)rx[1] << 24) | ((uint32_t)rx[2] << 16) | ((uint32_t)rx[3] << 8) | rx[4];
+        if (address & 0x80) {
+            tmc5160_model_write(&sim_tmc5160[chip], address, value);
+        } else {
+            sim_spi_latched[chip] = tmc5160_model_read(&sim_tmc5160[chip], address);
+        }
+    }
+}
+
+void spi1_transfer_dma(uint8_t cs, const uint8_t *tx, uint8_t *rx, size_t n) {
+    spi1_cs_select(cs);
+    for (size_t i = 0; i < n; i++) {
+        rx[i] = spi1_transfer(tx[i]);
+    }
+    spi1_cs_deselect(cs);
+}
+
+uint32_t spi1_lock(void) {
+    return 0;
+}
+
+void spi1_unlock(uint32_t key) {
+    (void)key;
+}
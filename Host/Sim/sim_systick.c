@@ -0,0 +1,20 @@
+#include "systick.h"
+#include "sim.h"
+
+#include <time.h>
+
+static uint64_t systick_start_ns = 0;
+
+uint64_t sim_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void systick_init(void) {
+    systick_start_ns = sim_time_ns();
+}
+
+uint32_t millis(void) {
+    return (uint32_t)((sim_time_ns() - systick_start_ns) / 1000000u);
+}
@@ -0,0 +1,87 @@
+#include "flash_model.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+static uint8_t sectors[NVLOG_SECTORS][FLASH_MODEL_MAX_SIZE] __attribute__((aligned(4)));
+
+static bool powered = true;
+static bool cut_armed = false;
+static unsigned int cut_budget = 0;
+
+struct flash_model_stats flash_model_stats;
+
+// Returns false if the power fails during this operation.
+static bool flash_model_tick(void) {
+    if (!powered) {
+        return false;
+    }
+    if (cut_armed) {
+        if (cut_budget == 0) {
+            powered = false;
+            return false;
+        }
+        cut_budget--;
+    }
+    return true;
+}
+
+static int flash_model_erase(unsigned int sector) {
+    if (!flash_model_tick()) {
+        // Interrupted erase: only the first half of the sector is cleared.
+        if (sector < NVLOG_SECTORS) {
+            memset(sectors[sector], 0xFF, flash_model.size / 2);
+        }
+        return -1;
+    }
+    memset(sectors[sector], 0xFF, flash_model.size);
+    flash_model_stats.erases[sector]++;
+    return 0;
+}
+
+static int flash_model_program(const uint8_t *dst, const uint32_t *src, size_t words) {
+    for (size_t i = 0; i < words; i++) {
+        uint8_t *p = (uint8_t *)dst + i * sizeof(uint32_t);
+        uint32_t old;
+        uint32_t value = src[i];
+
+        memcpy(&old, p, sizeof(old));
+        if (value & ~old) {
+            flash_model_stats.violations++;
+        }
+        if (!flash_model_tick()) {
+            // Interrupted program: only the low half-word reaches the cells.
+            value = old & (value | 0xFFFF0000u);
+            memcpy(p, &value, sizeof(value));
+            return -1;
+        }
+        value &= old;
+        memcpy(p, &value, sizeof(value));
+        flash_model_stats.words++;
+    }
+    return 0;
+}
+
+struct nvlog_flash flash_model = {
+    .base = { sectors[0], sectors[1] },
+    .size = FLASH_MODEL_MAX_SIZE,
+    .erase = &flash_model_erase,
+    .program = &flash_model_program,
+};
+
+void flash_model_reset(uint32_t sector_size) {
+    memset(sectors, 0xFF, sizeof(sectors));
+    memset(&flash_model_stats, 0, sizeof(flash_model_stats));
+    flash_model.size = sector_size;
+    flash_model_power_on();
+}
+
+void flash_model_cut_after(unsigned int words) {
+    cut_armed = true;
+    cut_budget = words;
+}
+
+void flash_model_power_on(void) {
+    powered = true;
+    cut_armed = false;
+}
@@ -0,0 +1,34 @@
+#ifndef HOST_TESTS_FLASH_MODEL_H_
+#define HOST_TESTS_FLASH_MODEL_H_
+
+#include "nvlog.h"
+
+/*
+ * RAM model of two NOR flash sectors for nvlog.
+ *
+ * Programming can only clear bits, erasing sets a whole sector to 0xFF.
+ * A power cut can be scheduled after a number of programmed words: the word
+ * being programmed at that moment (or the sector being erased) is left half
+ * done and every later operation fails until flash_model_power_on().
+ */
+
+#define FLASH_MODEL_MAX_SIZE    4096
+
+struct flash_model_stats {
+    unsigned int erases[NVLOG_SECTORS];
+    unsigned int words;       // Words programmed since the last reset of the stats
+    unsigned int violations;  // Attempts to set a bit from 0 to 1
+};
+
+extern struct nvlog_flash flash_model;
+extern struct flash_model_stats flash_model_stats;
+
+// Erases both sectors and clears the statistics.
+void flash_model_reset(uint32_t sector_size);
+
+// Cuts the power after 'words' more programmed words (erases count as one word).
+void flash_model_cut_after(unsigned int words);
+
+void flash_model_power_on(void);
+
+#endif /* HOST_TESTS_FLASH_MODEL_H_ */
@@ -0,0 +1,85 @@
+/*
+ * Host test of the TMC5160 fault mapping of drive_fault.c: every driver
+ * error flag to its CiA 402 error code and error register bits, a driver
+ * error without a flag, the warnings next to the faults, and open load
+ * ignored at standstill.
+ * Build and run with: make -C Host test
+ */
+#include "drive_fault.h"
+#include "tmc5160.h"
+
+#include <stdio.h>
+
+#define BIT(error)  DRIVE_ERROR_BIT(DRIVE_ERROR_##error)
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+// Every error has a code and the generic bit; the classes of CiA 301
+static void test_codes(void) {
+    for (int e = 0; e < DRIVE_ERROR_COUNT; e++) {
+        const struct drive_error_code *c = drive_error_code((enum drive_error)e);
+        CHECK(c->code != 0);
+        CHECK(c->error_register & 0x01);
+        for (int other = 0; other < e; other++) {
+            CHECK(drive_error_code((enum drive_error)other)->code != c->code);
+        }
+    }
+    CHECK(drive_error_code(DRIVE_ERROR_OVERTEMPERATURE)->code == 0x4310);
+    CHECK(drive_error_code(DRIVE_ERROR_OVERTEMPERATURE)->error_register & 0x08);
+    CHECK((drive_error_code(DRIVE_ERROR_SHORT_TO_GROUND)->code & 0xFF00) == 0x2300);
+    CHECK(drive_error_code(DRIVE_ERROR_SHORT_TO_SUPPLY)->error_register & 0x02);
+    CHECK(drive_error_code(DRIVE_ERROR_UNDERVOLTAGE)->error_register & 0x04);
+    CHECK(drive_error_code(DRIVE_ERROR_FOLLOWING_ERROR)->code == 0x8611);
+}
+
+// A driver error is classified by the flags latched with it
+static void test_faults(void) {
+    const uint32_t stst = TMC5160_DRV_STATUS_STST;
+
+    CHECK(drive_error_decode(0, stst) == 0);
+    CHECK(drive_error_decode(TMC5160_GSTAT_RESET, stst) == 0);
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, TMC5160_DRV_STATUS_OT | TMC5160_DRV_STATUS_OTPW) ==
+          BIT(OVERTEMPERATURE));
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, TMC5160_DRV_STATUS_S2GB) == BIT(SHORT_TO_GROUND));
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, TMC5160_DRV_STATUS_S2VSA) == BIT(SHORT_TO_SUPPLY));
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, TMC5160_DRV_STATUS_S2GA | TMC5160_DRV_STATUS_S2VSB) ==
+          (BIT(SHORT_TO_GROUND) | BIT(SHORT_TO_SUPPLY)));
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, stst) == BIT(POWER_STAGE));
+    CHECK(drive_error_decode(TMC5160_GSTAT_UV_CP, 0) == BIT(UNDERVOLTAGE));
+
+    // The flags alone, without drv_err, are not a fault
+    CHECK(drive_error_decode(0, TMC5160_DRV_STATUS_S2GA | stst) == 0);
+}
+
+// Warnings come with or without a fault; open load only while moving
+static void test_warnings(void) {
+    const uint32_t ol = TMC5160_DRV_STATUS_OLA | TMC5160_DRV_STATUS_OLB;
+
+    CHECK(drive_error_decode(0, TMC5160_DRV_STATUS_OTPW | TMC5160_DRV_STATUS_STST) == BIT(TEMPERATURE_WARNING));
+    CHECK(drive_error_decode(0, ol) == BIT(OPEN_LOAD));
+    CHECK(drive_error_decode(0, TMC5160_DRV_STATUS_OLB) == BIT(OPEN_LOAD));
+    CHECK(drive_error_decode(0, ol | TMC5160_DRV_STATUS_STST) == 0);
+    CHECK(drive_error_decode(TMC5160_GSTAT_DRV_ERR, TMC5160_DRV_STATUS_S2GA | TMC5160_DRV_STATUS_OTPW | ol) ==
+          (BIT(SHORT_TO_GROUND) | BIT(TEMPERATURE_WARNING) | BIT(OPEN_LOAD)));
+    CHECK((BIT(TEMPERATURE_WARNING) | BIT(OPEN_LOAD)) == DRIVE_ERROR_WARNINGS);
+}
+
+int main(void) {
+    test_codes();
+    test_faults();
+    test_warnings();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all drive fault tests passed\n");
+    return 0;
+}
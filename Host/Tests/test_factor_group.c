@@ -0,0 +1,192 @@
+/*
+ * Host test of the factor group of factor_group.c: the multiply/shift
+ * scaling against an exact 128-bit reference over random values and
+ * fractions, the TMC5160 velocity and acceleration time bases, refused
+ * configurations, and the rounding of long multi-turn moves in user units,
+ * which must stay within half a ustep of the exact position however far
+ * the axis travels.
+ * Build and run with: make -C Host test
+ */
+#include "factor_group.h"
+#include "tmc5160.h"
+
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15u;
+
+static uint64_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// x * num / den rounded half away from zero, saturated to int32_t
+static int32_t reference(int32_t x, uint64_t num, uint64_t den) {
+    unsigned __int128 magnitude = (unsigned __int128)((x < 0) ? -(int64_t)x : x) * num;
+    unsigned __int128 q = magnitude / den;
+    unsigned __int128 r = magnitude % den;
+
+    if (r >= den - r) {
+        q++;
+    }
+    if (x < 0) {
+        return (q > (unsigned __int128)INT32_MAX + 1) ? INT32_MIN : (int32_t)-(int64_t)q;
+    }
+    return (q > INT32_MAX) ? INT32_MAX : (int32_t)q;
+}
+
+// Random fractions, from small ones to 64-bit numerators and denominators
+static void test_scale(void) {
+    struct factor f;
+    unsigned int errors = 0;
+
+    for (int i = 0; i < 2000; i++) {
+        uint64_t num = rng() >> (rng() % 64);
+        uint64_t den = (rng() >> (rng() % 64)) | 1;
+        num = num ? num : 1;
+        if (i % 4 == 0) {
+            den = (uint64_t)1 << (rng() % 64); // Power of two
+        }
+        factor_init(&f, num, den);
+
+        for (int k = 0; k < 200; k++) {
+            int32_t x = (int32_t)(uint32_t)(rng() >> (rng() % 32));
+            if (factor_scale(&f, x) != reference(x, num, den)) {
+                errors++;
+            }
+        }
+        if (factor_scale(&f, INT32_MIN) != reference(INT32_MIN, num, den) ||
+            factor_scale(&f, INT32_MAX) != reference(INT32_MAX, num, den)) {
+            errors++;
+        }
+    }
+    CHECK(errors == 0);
+
+    // Halves round away from zero; fractions are reduced
+    factor_init(&f, 6, 4);
+    CHECK(f.num == 3 && f.den == 2);
+    CHECK(factor_scale(&f, 1) == 2 && factor_scale(&f, -1) == -2);
+    CHECK(factor_scale(&f, 3) == 5 && factor_scale(&f, -3) == -5);
+    factor_init(&f, 1, 1);
+    CHECK(factor_scale(&f, INT32_MIN) == INT32_MIN && factor_scale_u32(&f, UINT32_MAX) == UINT32_MAX);
+    factor_init(&f, 3, 1);
+    CHECK(factor_scale(&f, 1 << 30) == INT32_MAX && factor_scale(&f, -(1 << 30)) == INT32_MIN);
+    CHECK(factor_scale_u32(&f, 1u << 31) == UINT32_MAX);
+    factor_init(&f, UINT64_MAX, 1);
+    CHECK(factor_scale(&f, 0) == 0 && factor_scale(&f, 2) == INT32_MAX);
+}
+
+// All factors 1: positions in usteps, velocities in usteps/s and
+// accelerations in usteps/s^2 on the TMC5160 time bases
+static void test_units(void) {
+    static const struct factor_group_config ones = { 1, 1, 1, 1, 1, 1 };
+    struct factor_group g;
+
+    CHECK(factor_group_compute(&g, &ones));
+    CHECK(factor_scale(&g.position, -123456789) == -123456789);
+    CHECK(factor_scale(&g.position_inv, 987654321) == 987654321);
+
+    // VMAX = v * 2^24 / fCLK, AMAX = a * 2^41 / fCLK^2
+    CHECK(factor_scale(&g.velocity, 36621) == 51200);
+    CHECK(factor_scale(&g.velocity, -3662) == -5120);
+    CHECK(factor_scale(&g.velocity_inv, 51200) == 36621);
+    CHECK(factor_scale_u32(&g.acceleration, 261934) == 4000);
+    CHECK(factor_scale_u32(&g.acceleration, 65484) == 1000);
+    CHECK(g.velocity.num * TMC5160_FCLK == g.velocity.den << 24);
+
+    // 0 and products beyond 64 bits are refused; the group is kept
+    struct factor_group_config config = ones;
+    config.feed = 0;
+    CHECK(!factor_group_compute(&g, &config));
+    config = (struct factor_group_config){ 4294967291u, 1, 4294967279u, 1, 1, 4294967231u }; // Primes
+    CHECK(!factor_group_compute(&g, &config));
+    CHECK(factor_scale(&g.position, 7) == 7);
+}
+
+/**
+ * @brief Absolute targets k * step (user units) for k = 0..moves, each
+ *        converted to usteps as a set-point is.
+ * @return Largest distance from the exact position, in 1/1000 ustep.
+ */
+static uint32_t run(const struct factor_group *g, int32_t step, int32_t moves) {
+    uint64_t worst = 0;
+
+    for (int32_t k = 0; k <= moves; k++) {
+        int32_t target = k * step;
+        int32_t usteps = factor_scale(&g->position, target);
+        // |usteps - target * num / den| * den, to 1/1000
+        __int128 diff = (__int128)usteps * g->position.den - (__int128)target * g->position.num;
+        uint64_t milli = (uint64_t)(((diff < 0) ? -diff : diff) * 1000 / g->position.den);
+        if (milli > worst) {
+            worst = milli;
+        }
+    }
+    return (uint32_t)worst;
+}
+
+// 51200 usteps per motor revolution, 7:3 gearbox, 5 mm per shaft revolution
+// in um: 1792/75 usteps per um. Moves of a whole number of shaft turns come
+// back to the same step phase, and no move is more than half a ustep off
+static void test_drift(void) {
+    static const struct factor_group_config config = {
+        .encoder_increments = 51200, .motor_revolutions = 1,
+        .gear_motor_revolutions = 7, .gear_shaft_revolutions = 3,
+        .feed = 5000, .feed_shaft_revolutions = 1,
+    };
+    struct factor_group g;
+
+    CHECK(factor_group_compute(&g, &config));
+    CHECK(g.position.num == 1792 && g.position.den == 75);
+
+    // 3 shaft turns (15 mm) are 7 motor turns exactly, up to 85 m of travel
+    for (int32_t k = -5000; k <= 5000; k++) {
+        CHECK(factor_scale(&g.position, k * 15000) == k * 7 * 51200);
+    }
+    uint32_t worst = run(&g, 1237, 72000);
+    CHECK(worst <= 500);
+    CHECK(run(&g, -4096, 21000) <= 500);
+
+    // Back to user units: every um is 23.9 usteps, so the round trip is exact
+    unsigned int round_trip = 0;
+    for (int32_t x = -2000000; x <= 2000000; x += 7) {
+        if (factor_scale(&g.position_inv, factor_scale(&g.position, x)) != x) {
+            round_trip++;
+        }
+    }
+    CHECK(round_trip == 0);
+
+    // A Q16 factor, the usual shortcut, drifts with the distance
+    int64_t q16 = (1792 * 65536 + 37) / 75;
+    int32_t far = 72000 * 1237;
+    int64_t shortcut = ((int64_t)far * q16 + 32768) >> 16;
+    printf("drift: %d um is %d usteps (%u/1000 ustep worst), Q16 gives %lld\n", far,
+           factor_scale(&g.position, far), worst, (long long)shortcut);
+
+    // Velocity: 10 mm/s of the shaft
+    int32_t vmax = factor_scale(&g.velocity, 10000);
+    CHECK(vmax == reference(10000, (uint64_t)1792 << 24, (uint64_t)75 * TMC5160_FCLK));
+    CHECK(factor_scale(&g.velocity_inv, vmax) == 10000);
+}
+
+int main(void) {
+    test_scale();
+    test_units();
+    test_drift();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all factor group tests passed\n");
+    return 0;
+}
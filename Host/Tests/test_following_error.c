@@ -0,0 +1,220 @@
+/*
+ * Host test of the encoder scaling and following error monitoring of
+ * encoder.c: ENC_CONST for common resolutions, X_ENC tracking XACTUAL in
+ * the TMC5160 model over long moves, and the detection latency of lost
+ * steps injected into the model against the window (0x6065) and the
+ * timeout (0x6066).
+ * Build and run with: make -C Host test
+ */
+#include "encoder.h"
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define POLL_CLOCKS     (TMC5160_MODEL_FCLK / 1000) // app.c checks every 1 ms
+#define USTEPS_PER_REV  51200
+#define ENC_COUNTS      4000  // 1000 line encoder, quadrature
+#define WINDOW          512   // Two full steps: the largest load angle
+#define TIMEOUT_MS      10
+#define LOST_STEPS      1024  // One electrical period: four full steps
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/**
+ * @brief Model with the encoder mounted and configured as app.c does it,
+ *        moving towards 'target' at 'vmax'.
+ */
+static void setup(struct tmc5160_model *m, const struct encoder_config *config,
+                  uint32_t vmax, int32_t target) {
+    struct encoder_regs regs;
+
+    tmc5160_model_reset(m);
+    tmc5160_model_set_encoder(m, config->resolution, config->motor_resolution);
+    CHECK(encoder_compute(&regs, config));
+    tmc5160_model_write(m, TMC5160_ENCMODE, regs.encmode);
+    tmc5160_model_write(m, TMC5160_ENC_CONST, (uint32_t)regs.enc_const);
+    tmc5160_model_write(m, TMC5160_X_ENC, tmc5160_model_read(m, TMC5160_XACTUAL));
+
+    tmc5160_model_write(m, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+    tmc5160_model_write(m, TMC5160_VMAX, vmax);
+    tmc5160_model_write(m, TMC5160_AMAX, 2000);
+    tmc5160_model_write(m, TMC5160_DMAX, 2000);
+    tmc5160_model_write(m, TMC5160_VSTOP, 10);
+    tmc5160_model_write(m, TMC5160_XTARGET, (uint32_t)target);
+}
+
+/**
+ * @brief One poll of app.c: XACTUAL - X_ENC into the monitoring.
+ */
+static bool poll(struct tmc5160_model *m, struct following_error *fe, int32_t *error) {
+    tmc5160_model_step(m, POLL_CLOCKS);
+    int32_t xactual = (int32_t)tmc5160_model_read(m, TMC5160_XACTUAL);
+    int32_t x_enc = (int32_t)tmc5160_model_read(m, TMC5160_X_ENC);
+    *error = xactual - x_enc;
+    return following_error_update(fe, *error, (uint32_t)(m->clocks / POLL_CLOCKS));
+}
+
+static const struct encoder_config encoder_4000 = { ENC_COUNTS, USTEPS_PER_REV, false };
+
+// ENC_CONST in the exact format, rounding, inversion, range
+static void test_enc_const(void) {
+    struct encoder_regs regs;
+    struct encoder_config config = encoder_4000;
+
+    CHECK(encoder_compute(&regs, &config)); // 12.8: decimal
+    CHECK(regs.encmode == TMC5160_ENCMODE_DECIMAL);
+    CHECK((uint32_t)regs.enc_const == ((12u << 16) | 8000u));
+
+    config.inverted = true;                 // -12.8 = -13 + 0.2
+    CHECK(encoder_compute(&regs, &config));
+    CHECK((uint32_t)regs.enc_const == ((0xFFF3u << 16) | 2000u));
+
+    config = (struct encoder_config){ 4096, USTEPS_PER_REV, false }; // 12.5: binary
+    CHECK(encoder_compute(&regs, &config));
+    CHECK(regs.encmode == 0 && regs.enc_const == (25 << 15));
+
+    config.inverted = true;
+    CHECK(encoder_compute(&regs, &config));
+    CHECK(regs.enc_const == -(25 << 15));
+
+    config = (struct encoder_config){ 3, USTEPS_PER_REV, false };  // 17066.67: rounded binary
+    CHECK(encoder_compute(&regs, &config));
+    CHECK(regs.encmode == 0 && regs.enc_const == (int32_t)((51200ll * 65536 + 1) / 3));
+
+    config = (struct encoder_config){ 0, USTEPS_PER_REV, false };  // No encoder
+    CHECK(!encoder_compute(&regs, &config));
+    config = (struct encoder_config){ 1, 40000, false };           // Over 32767 usteps per count
+    CHECK(!encoder_compute(&regs, &config));
+}
+
+// Without lost steps X_ENC stays within one count of XACTUAL over
+// 100 revolutions, and nothing is reported.
+static void test_tracking(void) {
+    struct tmc5160_model m;
+    struct following_error fe = { WINDOW, TIMEOUT_MS, false, 0 };
+    int32_t error, max_error = 0;
+    bool detected = false;
+
+    setup(&m, &encoder_4000, 200000, 100 * USTEPS_PER_REV);
+    for (int t = 0; t < 60000; t++) {
+        detected |= poll(&m, &fe, &error);
+        if (abs(error) > max_error) {
+            max_error = abs(error);
+        }
+    }
+    CHECK(m.xactual == 100 * USTEPS_PER_REV);
+    CHECK(!detected);
+    CHECK(max_error <= USTEPS_PER_REV / ENC_COUNTS + 1);
+    CHECK(error == 0);
+    printf("tracking: largest error %d usteps over 100 revolutions\n", max_error);
+}
+
+/**
+ * @brief Loses LOST_STEPS after 'at_ms' of a move and returns the time in
+ *        ms from the loss to the detection, -1 if not detected.
+ */
+static int detection_latency(uint32_t timeout, int at_ms) {
+    struct tmc5160_model m;
+    struct following_error fe = { WINDOW, timeout, false, 0 };
+    int32_t error;
+
+    setup(&m, &encoder_4000, 200000, 100 * USTEPS_PER_REV);
+    for (int t = 0; t < at_ms; t++) {
+        CHECK(!poll(&m, &fe, &error));
+    }
+    tmc5160_model_slip(&m, -LOST_STEPS);
+    for (int t = 1; t <= 1000; t++) {
+        if (poll(&m, &fe, &error)) {
+            return t;
+        }
+    }
+    return -1;
+}
+
+// Lost steps are reported after the timeout plus at most one poll
+static void test_step_loss(void) {
+    int latency = detection_latency(TIMEOUT_MS, 500);
+    CHECK(latency >= TIMEOUT_MS && latency <= TIMEOUT_MS + 1);
+    printf("step loss: detected after %d ms (timeout %d ms)\n", latency, TIMEOUT_MS);
+
+    latency = detection_latency(0, 500);
+    CHECK(latency == 1);
+
+    latency = detection_latency(100, 500);
+    CHECK(latency >= 100 && latency <= 101);
+}
+
+// Deviations inside the window, or shorter than the timeout, are not reported
+static void test_no_false_alarm(void) {
+    struct tmc5160_model m;
+    struct following_error fe = { WINDOW, TIMEOUT_MS, false, 0 };
+    int32_t error;
+    bool detected = false;
+
+    setup(&m, &encoder_4000, 200000, 100 * USTEPS_PER_REV);
+    for (int t = 0; t < 100; t++) {
+        detected |= poll(&m, &fe, &error);
+    }
+    tmc5160_model_slip(&m, -(WINDOW - 2 * USTEPS_PER_REV / ENC_COUNTS)); // Load angle inside the window
+    for (int t = 0; t < 100; t++) {
+        detected |= poll(&m, &fe, &error);
+    }
+    tmc5160_model_slip(&m, -LOST_STEPS);                 // Outside for half the timeout
+    for (int t = 0; t < TIMEOUT_MS / 2; t++) {
+        detected |= poll(&m, &fe, &error);
+    }
+    tmc5160_model_slip(&m, LOST_STEPS);
+    for (int t = 0; t < 100; t++) {
+        detected |= poll(&m, &fe, &error);
+    }
+    CHECK(!detected);
+
+    fe.window = FOLLOWING_ERROR_WINDOW_OFF;              // Monitoring off
+    tmc5160_model_slip(&m, -10 * LOST_STEPS);
+    for (int t = 0; t < 100; t++) {
+        detected |= poll(&m, &fe, &error);
+    }
+    CHECK(!detected);
+}
+
+// Writing XACTUAL, as homing and the alignment do, moves no motor: the
+// encoder keeps its count, X_ENC only follows when written as well
+static void test_position_write(void) {
+    struct tmc5160_model m;
+
+    setup(&m, &encoder_4000, 200000, 0);
+    tmc5160_model_write(&m, TMC5160_XACTUAL, 5000);
+    CHECK(tmc5160_model_read(&m, TMC5160_X_ENC) == 0);
+    tmc5160_model_write(&m, TMC5160_X_ENC, 5000);
+    tmc5160_model_write(&m, TMC5160_XTARGET, 5000 + USTEPS_PER_REV);
+    for (int t = 0; t < 2000; t++) {
+        tmc5160_model_step(&m, POLL_CLOCKS);
+    }
+    CHECK(m.xactual == 5000 + USTEPS_PER_REV);
+    CHECK(abs((int32_t)tmc5160_model_read(&m, TMC5160_X_ENC) - m.xactual) <= USTEPS_PER_REV / ENC_COUNTS);
+}
+
+int main(void) {
+    test_enc_const();
+    test_tracking();
+    test_step_loss();
+    test_no_false_alarm();
+    test_position_write();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all following error tests passed\n");
+    return 0;
+}
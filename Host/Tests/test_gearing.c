@@ -0,0 +1,135 @@
+/*
+ * Host test of the electronic gearing of gearing.c: the demand position
+ * against an exact reference computed in 128 bits, for integer and
+ * fractional ratios, both directions, a master counter that wraps around
+ * several times, and the gearing error across the wrap of the follower's
+ * position counter.
+ * Build and run with: make -C Host test
+ */
+#include "gearing.h"
+
+#include <stdio.h>
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+/**
+ * @brief offset + ratio × master rounded half up, modulo 2^32, from the
+ *        unwrapped master position.
+ */
+static int32_t reference(int64_t master, int32_t ratio, int32_t offset) {
+    __int128 product = (__int128)ratio * master + GEARING_RATIO_ONE / 2;
+    __int128 q = product >> GEARING_RATIO_SHIFT; // Floor
+    return (int32_t)((uint32_t)offset + (uint32_t)(uint64_t)q);
+}
+
+// The first master position is taken as it is; reset starts anew
+static void test_start(void) {
+    struct gearing g;
+
+    gearing_reset(&g);
+    CHECK(!g.is_started);
+    CHECK(gearing_follow(&g, 1000, GEARING_RATIO_ONE, 5) == 1005);
+    CHECK(g.is_started && g.target == 1005);
+    CHECK(gearing_follow(&g, -1000, GEARING_RATIO_ONE, 5) == -995);
+    CHECK(gearing_follow(&g, 10, 2 * GEARING_RATIO_ONE, 0) == 20);
+
+    gearing_reset(&g);
+    CHECK(gearing_follow(&g, INT32_MIN, GEARING_RATIO_ONE, 0) == INT32_MIN);
+    CHECK(gearing_follow(&g, -3, -GEARING_RATIO_ONE / 2, 0) == 2); // 1.5 rounds up
+    CHECK(gearing_follow(&g, 3, -GEARING_RATIO_ONE / 2, 0) == -1); // -1.5 rounds up
+}
+
+/**
+ * @brief Runs the master from 'start' by 'steps' increments of 'step' and
+ *        checks every demand position against the reference.
+ * @return Number of demand positions that differ.
+ */
+static unsigned int run(int32_t start, int32_t step, uint32_t steps, int32_t ratio, int32_t offset) {
+    struct gearing g;
+    int64_t master = start;
+    unsigned int errors = 0;
+
+    gearing_reset(&g);
+    for (uint32_t i = 0; i <= steps; i++) {
+        if (gearing_follow(&g, (int32_t)(uint32_t)(uint64_t)master, ratio, offset) !=
+            reference(master, ratio, offset)) {
+            errors++;
+        }
+        master += step;
+    }
+    return errors;
+}
+
+// Integer and fractional ratios in both directions, exact at every position
+static void test_ratios(void) {
+    static const int32_t ratios[] = {
+        GEARING_RATIO_ONE, -GEARING_RATIO_ONE, 21845, -21845, 3 * GEARING_RATIO_ONE / 2,
+        1, INT32_MAX, INT32_MIN, 256 * GEARING_RATIO_ONE + 12345,
+    };
+
+    for (size_t i = 0; i < sizeof(ratios) / sizeof(ratios[0]); i++) {
+        CHECK(run(-500000, 7, 200000, ratios[i], 123) == 0);
+        CHECK(run(500000, -13, 100000, ratios[i], -77) == 0);
+    }
+}
+
+// A master counter running forward for 2^36 counts wraps 16 times; the
+// follower goes on without a jump and without drift
+static void test_wrap(void) {
+    struct gearing g;
+    const int32_t ratio = 21845; // 1/3.0000458
+    const int32_t step = 0x10000 - 1;
+    int64_t master = INT32_MAX - 100000;
+    int32_t previous;
+
+    CHECK(run((int32_t)master, step, (1u << 20) + 100, ratio, 0) == 0);
+
+    gearing_reset(&g);
+    previous = gearing_follow(&g, (int32_t)master, ratio, 0);
+    for (uint32_t i = 0; i < (1u << 20) + 100; i++) {
+        master += step;
+        int32_t target = gearing_follow(&g, (int32_t)(uint32_t)(uint64_t)master, ratio, 0);
+        int32_t delta = (int32_t)((uint32_t)target - (uint32_t)previous);
+        CHECK(delta == 21844 || delta == 21845);
+        previous = target;
+    }
+    CHECK(g.master == (uint64_t)master);
+    printf("wrap: master %lld counts from the start, follower at %d\n", (long long)(master - (INT32_MAX - 100000)),
+           previous);
+}
+
+// The error is the demand minus the actual position, across the wrap of
+// the position counter
+static void test_error(void) {
+    struct gearing g;
+
+    gearing_reset(&g);
+    gearing_follow(&g, 1000, GEARING_RATIO_ONE, 0);
+    CHECK(gearing_error(&g, 990) == 10);
+    CHECK(gearing_error(&g, 1010) == -10);
+
+    gearing_follow(&g, INT32_MIN + 5, GEARING_RATIO_ONE, 0); // Forward across the wrap
+    CHECK(g.target == INT32_MIN + 5);
+    CHECK(gearing_error(&g, INT32_MAX - 4) == 10);
+}
+
+int main(void) {
+    test_start();
+    test_ratios();
+    test_wrap();
+    test_error();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all gearing tests passed\n");
+    return 0;
+}
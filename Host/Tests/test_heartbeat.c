@@ -0,0 +1,133 @@
+/*
+ * Host test of the heartbeat consumer of heartbeat.c, checked every motion
+ * tick as app.c does: the 0x1016 entry format and its unused values, no
+ * monitoring before the first heartbeat, the expiry within one tick of the
+ * heartbeat time, once per loss, and the next heartbeat ending the loss.
+ * Build and run with: make -C Host test
+ */
+#include "heartbeat.h"
+
+#include <stdio.h>
+
+#define TICK_US         250   // Motion timer of app.c
+#define ENTRY(id, ms)   (((uint32_t)(id) << 16) | (ms))
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+// Node and time of the entry; unused entries are never checked
+static void test_entry(void) {
+    struct heartbeat_consumer c;
+
+    heartbeat_consumer_configure(&c, ENTRY(1, 100), 7);
+    CHECK(c.node_id == 1 && c.time_us == 100000 && c.received == 7 && !c.is_started);
+
+    heartbeat_consumer_configure(&c, ENTRY(0, 100), 0);
+    CHECK(c.node_id == 0);
+    CHECK(!heartbeat_consumer_check(&c, 1, 0, 1000000));
+    heartbeat_consumer_configure(&c, ENTRY(128, 100), 0);
+    CHECK(c.node_id == 0);
+    heartbeat_consumer_configure(&c, ENTRY(5, 0), 0);
+    CHECK(c.node_id == 0);
+    heartbeat_consumer_configure(&c, 0xFF000000u | ENTRY(127, 65535), 0);
+    CHECK(c.node_id == 127 && c.time_us == 65535000u);
+}
+
+// Receptions before the configuration do not start the monitoring
+static void test_start(void) {
+    struct heartbeat_consumer c;
+
+    heartbeat_consumer_configure(&c, ENTRY(1, 20), 3);
+    for (uint32_t now = 0; now < 1000000; now += TICK_US) {
+        CHECK(!heartbeat_consumer_check(&c, 3, 0, now));
+    }
+    CHECK(!c.is_started);
+    CHECK(!heartbeat_consumer_check(&c, 4, 999000, 1000000));
+    CHECK(c.is_started && c.last_us == 999000);
+}
+
+/**
+ * @brief Heartbeats every 'period_us' from 'start_us' to 'last_us', checked
+ *        every tick up to 'end_us'.
+ * @return Clock at the tick that found the loss, 0 if none.
+ */
+static uint32_t run(struct heartbeat_consumer *c, uint32_t *received, uint32_t start_us, uint32_t period_us,
+                    uint32_t last_us, uint32_t end_us) {
+    uint32_t next = start_us, received_us = 0, expired = 0;
+
+    for (uint32_t now = start_us; now < end_us; now += TICK_US) {
+        // Between the previous tick and this one
+        while (next <= last_us && next <= now) {
+            (*received)++;
+            received_us = next;
+            next += period_us;
+        }
+        if (heartbeat_consumer_check(c, *received, received_us, now)) {
+            CHECK(expired == 0); // Once per loss
+            expired = now;
+        }
+    }
+    return expired;
+}
+
+// A loss is found in the tick after the heartbeat time ran out; the next
+// heartbeat ends it and the monitoring goes on
+static void test_loss(void) {
+    struct heartbeat_consumer c;
+    uint32_t received = 0;
+
+    // 20 ms heartbeat time on a 10 ms heartbeat, offset to the ticks
+    heartbeat_consumer_configure(&c, ENTRY(1, 20), received);
+    CHECK(run(&c, &received, 100, 10000, 500000, 500000) == 0);
+
+    uint32_t found = run(&c, &received, 500000, 10000, 0, 600000);
+    uint32_t deadline = c.last_us + c.time_us;
+    CHECK(found >= deadline && found < deadline + TICK_US);
+    CHECK(heartbeat_consumer_overdue_us(&c, found) < TICK_US);
+    CHECK(c.is_expired);
+    printf("loss: last heartbeat at %u us, found at %u us (%u us after the expiry)\n",
+           (unsigned int)c.last_us, (unsigned int)found, (unsigned int)heartbeat_consumer_overdue_us(&c, found));
+
+    // The node is back, then lost again
+    CHECK(run(&c, &received, 600000, 10000, 700000, 700000) == 0);
+    CHECK(!c.is_expired);
+    found = run(&c, &received, 700000, 10000, 0, 800000);
+    CHECK(c.last_us == 690000);
+    CHECK(found >= 690000 + 20000 && found < 690000 + 20000 + TICK_US);
+}
+
+// The clock of the motion tick wraps after 71 minutes
+static void test_wrap(void) {
+    struct heartbeat_consumer c;
+    uint32_t received = 0;
+    uint32_t start = 0xFFFFFFFFu - 50000;
+
+    heartbeat_consumer_configure(&c, ENTRY(1, 20), received);
+    CHECK(run(&c, &received, start, 10000, start + 40000, start + 40000) == 0);
+    uint32_t found = run(&c, &received, start + 40000, 10000, 0, start + 49000);
+    CHECK(found == 0);
+    received++;
+    CHECK(!heartbeat_consumer_check(&c, received, start + 49000, start + 49000));
+    CHECK(!heartbeat_consumer_check(&c, received, start + 49000, 10000));
+    CHECK(heartbeat_consumer_check(&c, received, start + 49000, 30000));
+}
+
+int main(void) {
+    test_entry();
+    test_start();
+    test_loss();
+    test_wrap();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all heartbeat tests passed\n");
+    return 0;
+}
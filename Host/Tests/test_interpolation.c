@@ -0,0 +1,264 @@
+/*
+ * Host test of the Interpolated Position buffer of interpolation.c: the
+ * ring's limits (size, access), the period of 0x60C2, and the steps of
+ * the timer interrupt driving the TMC5160 model along a trajectory with a
+ * reversal and a dwell, against the linear interpolation between the points.
+ * Underruns are counted once per gap and leave the motor at the last point.
+ * Build and run with: make -C Host test
+ */
+#include "interpolation.h"
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TICK_US         250   // Motion timer of app.c
+#define TICK_CLOCKS     (TMC5160_MODEL_FCLK / 1000000 * TICK_US)
+#define PERIOD_US       1000
+#define AMPLITUDE       20000 // usteps
+#define SINE_POINTS     2000  // 2 s per cycle at 1 ms
+#define PI              3.14159265358979
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static struct interpolation_buffer buffer;
+
+/**
+ * @brief Model in positioning mode with the linear ramp app.c writes when
+ *        the interpolation starts.
+ */
+static void setup_model(struct tmc5160_model *m) {
+    tmc5160_model_reset(m);
+    tmc5160_model_write(m, TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+    tmc5160_model_write(m, TMC5160_AMAX, 20000);
+    tmc5160_model_write(m, TMC5160_DMAX, 20000);
+    tmc5160_model_write(m, TMC5160_VSTOP, 10);
+}
+
+/**
+ * @brief One timer tick: the step, if any, into the model, which then runs
+ *        for the tick.
+ */
+static bool tick(struct interpolation *ip, struct tmc5160_model *m) {
+    struct interpolation_step step;
+    bool stepped = interpolation_tick(ip, &step);
+
+    if (stepped) {
+        tmc5160_model_write(m, TMC5160_VMAX, step.vmax);
+        tmc5160_model_write(m, TMC5160_XTARGET, (uint32_t)step.xtarget);
+    }
+    tmc5160_model_step(m, TICK_CLOCKS);
+    return stepped;
+}
+
+// Size, access and clear of the ring
+static void test_buffer(void) {
+    struct interpolation ip;
+
+    interpolation_init(&ip, &buffer);
+    CHECK(interpolation_count(&ip) == 0);
+    CHECK(interpolation_space(&ip) == INTERPOLATION_BUFFER_DEPTH);
+    for (int i = 0; i < INTERPOLATION_BUFFER_DEPTH; i++) {
+        CHECK(interpolation_push(&ip, i));
+    }
+    CHECK(!interpolation_push(&ip, -1));
+    CHECK(interpolation_space(&ip) == 0);
+
+    CHECK(!interpolation_set_size(&ip, 0));
+    CHECK(!interpolation_set_size(&ip, INTERPOLATION_BUFFER_DEPTH + 1));
+    CHECK(interpolation_set_size(&ip, 3));
+    CHECK(interpolation_count(&ip) == 0);
+    CHECK(interpolation_push(&ip, 1) && interpolation_push(&ip, 2) && interpolation_push(&ip, 3));
+    CHECK(!interpolation_push(&ip, 4));
+
+    interpolation_set_access(&ip, false);
+    CHECK(interpolation_count(&ip) == 0);
+    CHECK(!interpolation_push(&ip, 1));
+    CHECK(interpolation_space(&ip) == 0);
+    interpolation_set_access(&ip, true);
+    CHECK(interpolation_push(&ip, 1));
+    interpolation_set_access(&ip, true);
+    CHECK(interpolation_count(&ip) == 1);
+
+    CHECK(interpolation_period_us(1, -3) == 1000);
+    CHECK(interpolation_period_us(250, -6) == 250);
+    CHECK(interpolation_period_us(25, -5) == 250);
+    CHECK(interpolation_period_us(2, -4) == 200);
+    CHECK(interpolation_period_us(1, -2) == 0);
+    CHECK(interpolation_period_us(1, -7) == 0);
+}
+
+// One point per period, the period rounded to whole ticks; nothing before start
+static void test_period(void) {
+    struct interpolation ip;
+    struct interpolation_step step;
+    int steps = 0;
+
+    interpolation_init(&ip, &buffer);
+    for (int i = 1; i <= 10; i++) {
+        interpolation_push(&ip, 100 * i);
+    }
+    CHECK(!interpolation_tick(&ip, &step));
+
+    interpolation_start(&ip, 0, 1100, TICK_US); // 4 ticks
+    for (int t = 0; t < 40; t++) {
+        if (interpolation_tick(&ip, &step)) {
+            CHECK(t % 4 == 0);
+            steps++;
+        }
+    }
+    CHECK(steps == 10);
+    CHECK(interpolation_position(&ip) == 1000);
+    CHECK(interpolation_count(&ip) == 0);
+
+    interpolation_stop(&ip);
+    interpolation_push(&ip, 0);
+    CHECK(!interpolation_tick(&ip, &step));
+    CHECK(interpolation_count(&ip) == 1);
+}
+
+// The look-ahead targets the end of each monotonic run; a dwell closes it
+static void test_lookahead(void) {
+    static const int32_t points[] = { 10, 20, 30, 25, 20, 20, 40 };
+    static const int32_t targets[] = { 30, 30, 30, 20, 20, 20, 40 };
+    struct interpolation ip;
+    struct interpolation_step step;
+
+    interpolation_init(&ip, &buffer);
+    for (unsigned int i = 0; i < sizeof(points) / sizeof(points[0]); i++) {
+        interpolation_push(&ip, points[i]);
+    }
+    interpolation_start(&ip, 0, TICK_US, TICK_US);
+    for (unsigned int i = 0; i < sizeof(points) / sizeof(points[0]); i++) {
+        CHECK(interpolation_tick(&ip, &step));
+        CHECK(step.xtarget == targets[i]);
+    }
+
+    // A run longer than the look-ahead scans further at each step
+    interpolation_stop(&ip);
+    for (int i = 1; i <= 3 * INTERPOLATION_SCAN_MAX; i++) {
+        interpolation_push(&ip, 40 + i);
+    }
+    interpolation_start(&ip, 40, TICK_US, TICK_US);
+    CHECK(interpolation_tick(&ip, &step) && step.xtarget == 41 + INTERPOLATION_SCAN_MAX);
+    CHECK(interpolation_tick(&ip, &step) && step.xtarget == 41 + 2 * INTERPOLATION_SCAN_MAX);
+}
+
+/**
+ * @brief Trajectory point 'i': out along a half cosine, a dwell, and back
+ *        through zero to the negative side, at rest at both ends.
+ */
+static int32_t trajectory(int i) {
+    enum { HALF = SINE_POINTS / 2, DWELL = 200 };
+
+    if (i < HALF) {
+        return (int32_t)lround(AMPLITUDE * (1 - cos(PI * i / HALF)));
+    }
+    if (i < HALF + DWELL) {
+        return 2 * AMPLITUDE;
+    }
+    return (int32_t)lround(2 * AMPLITUDE * cos(PI * (i - HALF - DWELL) / (2 * HALF)));
+}
+
+// The motor follows the linear interpolation between the points, reverses,
+// dwells, and stops exactly at the last point
+static void test_tracking(void) {
+    enum { POINTS = SINE_POINTS / 2 + 200 + SINE_POINTS + 1 };
+    struct interpolation ip;
+    struct tmc5160_model m;
+    int32_t previous = 0, next = 0, max_error = 0;
+    int pushed = 0, consumed = 0, ticks = 0;
+
+    setup_model(&m);
+    interpolation_init(&ip, &buffer);
+    interpolation_start(&ip, 0, PERIOD_US, TICK_US);
+
+    // The master keeps the buffer topped up from a burst at a time
+    while (consumed < POINTS) {
+        while (pushed < POINTS && interpolation_space(&ip) > INTERPOLATION_BUFFER_DEPTH / 2) {
+            CHECK(interpolation_push(&ip, trajectory(pushed)));
+            pushed++;
+        }
+        if (tick(&ip, &m)) {
+            previous = next;
+            next = trajectory(consumed++);
+            ticks = 0;
+        }
+        ticks++;
+
+        // Reference: the segment covered linearly over the period
+        int32_t reference = previous + (int32_t)((int64_t)(next - previous) * ticks * TICK_US / PERIOD_US);
+        int32_t error = abs(m.xactual - reference);
+        if (error > max_error) {
+            max_error = error;
+        }
+    }
+    for (int t = 0; t < 400; t++) {
+        tick(&ip, &m);
+    }
+    CHECK(m.xactual == trajectory(POINTS - 1));
+    CHECK(tmc5160_model_vactual(&m) == 0);
+    CHECK(max_error <= 64);
+    CHECK(interpolation_underruns(&ip) == 1); // Running dry at the end
+    printf("tracking: %d points, largest error %d usteps, at %d (last point %d)\n",
+           POINTS, max_error, m.xactual, trajectory(POINTS - 1));
+}
+
+// A gap in the points counts one underrun and stops the motor at the last
+// point; the run continues with the next points
+static void test_underrun(void) {
+    struct interpolation ip;
+    struct tmc5160_model m;
+
+    setup_model(&m);
+    interpolation_init(&ip, &buffer);
+    for (int i = 1; i <= 100; i++) {
+        interpolation_push(&ip, 50 * i);
+    }
+    interpolation_start(&ip, 0, PERIOD_US, TICK_US);
+    for (int t = 0; t < 4 * 100; t++) {
+        tick(&ip, &m);
+    }
+    CHECK(interpolation_underruns(&ip) == 0);
+    for (int t = 0; t < 4 * 100; t++) {
+        tick(&ip, &m);
+    }
+    CHECK(interpolation_underruns(&ip) == 1);
+    CHECK(m.xactual == 5000);
+    CHECK(tmc5160_model_vactual(&m) == 0);
+
+    for (int i = 1; i <= 10; i++) {
+        interpolation_push(&ip, 5000 - 50 * i);
+    }
+    for (int t = 0; t < 4 * 100; t++) {
+        tick(&ip, &m);
+    }
+    CHECK(interpolation_underruns(&ip) == 2);
+    CHECK(m.xactual == 4500);
+    printf("underrun: %u gap(s) counted, stopped at %d\n", (unsigned int)interpolation_underruns(&ip), m.xactual);
+}
+
+int main(void) {
+    test_buffer();
+    test_period();
+    test_lookahead();
+    test_tracking();
+    test_underrun();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all interpolation tests passed\n");
+    return 0;
+}
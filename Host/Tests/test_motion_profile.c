@@ -0,0 +1,349 @@
+/*
+ * Host test of the motion profiles (0x6086) computed by motion_profile.c:
+ * the fixed-point V1 against the closed form, and the linear and S-curve
+ * ramps run through the TMC5160 model (settle time, peak acceleration,
+ * acceleration steps, braking distance), and the stop ramp of halt and
+ * quick stop (stop distance and time against the deceleration), and the
+ * per-SYNC velocity ramps of Cyclic Synchronous Velocity mode.
+ * Build and run with: make -C Host test
+ */
+#include "motion_profile.h"
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STEP_CLOCKS     1200 // 100 us between observations
+#define WINDOW          20   // Acceleration is measured over 2 ms windows
+#define WINDOW_S        (WINDOW * (double)STEP_CLOCKS / TMC5160_MODEL_FCLK)
+#define T_ACCEL_UNIT    (131072.0 / TMC5160_MODEL_FCLK) // Seconds for 'a' velocity units at acceleration 'a'
+#define V_TO_HZ         (TMC5160_MODEL_FCLK / 16777216.0) // VMAX units to usteps/s
+#define A_TO_HZ2        ((double)TMC5160_MODEL_FCLK * TMC5160_MODEL_FCLK / 2199023255552.0) // AMAX units to usteps/s^2
+
+#define MOVE            200000
+#define VMAX            51200
+#define JERK            1000000 // usteps/s^3
+#define STOP_LEAD       3000    // Clocks allowed for until the stop XTARGET is written (app.c)
+#define STOP_LATENCY    600     // Clocks the test actually takes (50 us)
+#define SYNC_US         1000    // CSV: SYNC period
+#define SYNC_CLOCKS     (SYNC_US * (TMC5160_MODEL_FCLK / 1000000))
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, rel) do { \
+        double a_ = (actual), e_ = (expected); \
+        if (fabs(a_ - e_) > fabs(e_) * (rel)) { \
+            printf("%s:%d: %s = %g, expected %g (+/- %g%%)\n", \
+                   __FILE__, __LINE__, #actual, a_, e_, (rel) * 100.0); \
+            failures++; \
+        } \
+    } while (0)
+
+struct profile_run {
+    double settle_s;     // Time until XACTUAL == XTARGET at standstill
+    double peak_accel;   // Largest |acceleration| in usteps/s^2
+    double accel_step;   // Largest change of acceleration between two windows,
+                         // away from VMAX (no ramp phase rounds that corner)
+    int32_t brake_start; // Distance to the target when braking from VMAX began
+};
+
+/**
+ * @brief Runs one move with the ramp of 'ramp' through the model.
+ */
+static struct profile_run run_profile(const struct tmc5160_ramp *ramp, int32_t target) {
+    struct profile_run r = { -1.0, 0.0, 0.0, -1 };
+    struct tmc5160_model m;
+    int32_t v[2 * WINDOW + 1] = { 0 }; // Newest first; at rest before the start
+
+    tmc5160_model_reset(&m);
+    tmc5160_model_write(&m, TMC5160_RAMPMODE, 0);
+    tmc5160_model_write(&m, TMC5160_VMAX, ramp->vmax);
+    tmc5160_model_write(&m, TMC5160_V1, ramp->v1);
+    tmc5160_model_write(&m, TMC5160_A1, ramp->a1);
+    tmc5160_model_write(&m, TMC5160_AMAX, ramp->amax);
+    tmc5160_model_write(&m, TMC5160_DMAX, ramp->dmax);
+    tmc5160_model_write(&m, TMC5160_D1, ramp->d1);
+    tmc5160_model_write(&m, TMC5160_VSTOP, 10);
+    tmc5160_model_write(&m, TMC5160_XTARGET, (uint32_t)target);
+
+    while ((double)m.clocks / TMC5160_MODEL_FCLK < 20.0) {
+        tmc5160_model_step(&m, STEP_CLOCKS);
+
+        // The last step from VSTOP to rest is not an acceleration
+        uint32_t stat = tmc5160_model_read(&m, TMC5160_RAMP_STAT);
+        if ((stat & TMC5160_RAMP_STAT_POSITION_REACHED) && (stat & TMC5160_RAMP_STAT_VZERO)) {
+            r.settle_s = (double)m.clocks / TMC5160_MODEL_FCLK;
+            break;
+        }
+
+        for (int i = 2 * WINDOW; i > 0; i--) {
+            v[i] = v[i - 1];
+        }
+        v[0] = abs(tmc5160_model_vactual(&m));
+
+        if (r.brake_start < 0 && v[1] == (int32_t)ramp->vmax && v[0] < v[1]) {
+            r.brake_start = abs(target - m.xactual);
+        }
+
+        double accel = (v[0] - v[WINDOW]) * V_TO_HZ / WINDOW_S;
+        if (fabs(accel) > r.peak_accel) {
+            r.peak_accel = fabs(accel);
+        }
+
+        bool near_vmax = false;
+        for (int i = 0; i <= 2 * WINDOW; i++) {
+            near_vmax |= (v[i] >= (int32_t)ramp->vmax);
+        }
+        double before = (v[WINDOW] - v[2 * WINDOW]) * V_TO_HZ / WINDOW_S;
+        if (!near_vmax && fabs(accel - before) > r.accel_step) {
+            r.accel_step = fabs(accel - before);
+        }
+    }
+    return r;
+}
+
+/**
+ * @brief Closed-form duration of a long move with the six-point ramp.
+ */
+static double settle_time(const struct tmc5160_ramp *p, double distance) {
+    double v1 = p->v1, vmax = p->vmax;
+    double t = 0.0, s = 0.0;
+
+    t += v1 / p->a1 * T_ACCEL_UNIT + (vmax - v1) / p->amax * T_ACCEL_UNIT;
+    t += v1 / p->d1 * T_ACCEL_UNIT + (vmax - v1) / p->dmax * T_ACCEL_UNIT;
+    s += v1 * v1 / (256.0 * p->a1) + (vmax * vmax - v1 * v1) / (256.0 * p->amax);
+    s += v1 * v1 / (256.0 * p->d1) + (vmax * vmax - v1 * v1) / (256.0 * p->dmax);
+    return t + (distance - s) / (vmax * V_TO_HZ);
+}
+
+// V1 in fixed point against a^2 / (2 * jerk) in physical units.
+static void test_v1_conversion(void) {
+    struct tmc5160_ramp p;
+    motion_profile_compute(&p, MOTION_PROFILE_JERK_LIMITED, VMAX, 1000, 600, JERK);
+
+    double a = 1000.0 * A_TO_HZ2;
+    double v1 = a * a / (2.0 * JERK) / V_TO_HZ;
+    CHECK_NEAR(p.v1, v1, 0.001);
+    CHECK(p.amax == 1000 && p.a1 == 500);
+    CHECK(p.dmax == 600 && p.d1 == 300);
+    CHECK(p.vmax == VMAX);
+
+    // 0 jerk or the linear type: plain trapezoid
+    motion_profile_compute(&p, MOTION_PROFILE_JERK_LIMITED, VMAX, 1000, 600, 0);
+    CHECK(p.v1 == 0 && p.a1 == 1000 && p.d1 == 600);
+    motion_profile_compute(&p, MOTION_PROFILE_LINEAR, VMAX, 1000, 600, JERK);
+    CHECK(p.v1 == 0 && p.a1 == 1000 && p.d1 == 600);
+
+    // Very low jerk keeps a full-acceleration phase; out of range clamps
+    motion_profile_compute(&p, MOTION_PROFILE_JERK_LIMITED, VMAX, 100000, 0, 1);
+    CHECK(p.v1 == VMAX / 2);
+    CHECK(p.amax == 0xFFFF && p.dmax == 1 && p.d1 == 1);
+}
+
+// Same acceleration, S-curve vs. linear: same peak, half the steps,
+// at most the jerk time (a / jerk) longer.
+static void test_scurve(void) {
+    struct tmc5160_ramp linear, scurve;
+    motion_profile_compute(&linear, MOTION_PROFILE_LINEAR, VMAX, 1000, 1000, JERK);
+    motion_profile_compute(&scurve, MOTION_PROFILE_JERK_LIMITED, VMAX, 1000, 1000, JERK);
+
+    struct profile_run l = run_profile(&linear, MOVE);
+    struct profile_run s = run_profile(&scurve, MOVE);
+    double a = 1000.0 * A_TO_HZ2;
+
+    CHECK_NEAR(l.settle_s, settle_time(&linear, MOVE), 0.005);
+    CHECK_NEAR(s.settle_s, settle_time(&scurve, MOVE), 0.005);
+    CHECK(s.settle_s > l.settle_s);
+    CHECK(s.settle_s - l.settle_s < a / JERK);
+
+    CHECK_NEAR(l.peak_accel, a, 0.02);
+    CHECK_NEAR(s.peak_accel, a, 0.02);
+    CHECK_NEAR(l.accel_step, a, 0.02);
+    CHECK_NEAR(s.accel_step, a / 2.0, 0.02);
+
+    CHECK_NEAR(s.brake_start, motion_profile_brake_distance(&scurve, VMAX), 0.01);
+    CHECK_NEAR(l.brake_start, motion_profile_brake_distance(&linear, VMAX), 0.01);
+
+    printf("linear: %.3f s, step %.0f usteps/s^2; s-curve: %.3f s, step %.0f usteps/s^2\n",
+           l.settle_s, l.accel_step, s.settle_s, s.accel_step);
+}
+
+// The S-curve allows twice the acceleration for the same acceleration step,
+// which makes a long move faster than the linear ramp.
+static void test_raised_accel(void) {
+    struct tmc5160_ramp linear, scurve;
+    motion_profile_compute(&linear, MOTION_PROFILE_LINEAR, VMAX, 1000, 1000, 0);
+    motion_profile_compute(&scurve, MOTION_PROFILE_JERK_LIMITED, VMAX, 2000, 2000, 2 * JERK);
+
+    struct profile_run l = run_profile(&linear, MOVE);
+    struct profile_run s = run_profile(&scurve, MOVE);
+
+    CHECK(s.accel_step <= l.accel_step * 1.02);
+    CHECK_NEAR(s.peak_accel, 2.0 * l.peak_accel, 0.03);
+    CHECK(s.settle_s < l.settle_s);
+
+    printf("raised: %.3f s vs. %.3f s linear\n", s.settle_s, l.settle_s);
+}
+
+/**
+ * @brief Stops a move at 'x_stop' (or once VACTUAL reaches 'v_stop') the way
+ *        a halt or quick stop does, and checks the stop against the closed
+ *        form: v^2 / (256 * decel) usteps in v / decel * 2^17 clocks.
+ *
+ * Both may exceed the closed form by the lead the stop target allows for.
+ * The model ends a ramp once less than one ustep of braking is left, i.e.
+ * from sqrt(256 * decel), which shortens very slow stops.
+ */
+static void check_stop(int32_t target, int32_t x_stop, int32_t v_stop, uint32_t decel) {
+    struct tmc5160_model m;
+    struct tmc5160_ramp profile, stop;
+
+    motion_profile_compute(&profile, MOTION_PROFILE_JERK_LIMITED, VMAX, 1000, 1000, JERK);
+    tmc5160_model_reset(&m);
+    tmc5160_model_write(&m, TMC5160_RAMPMODE, 0);
+    tmc5160_model_write(&m, TMC5160_VMAX, profile.vmax);
+    tmc5160_model_write(&m, TMC5160_V1, profile.v1);
+    tmc5160_model_write(&m, TMC5160_A1, profile.a1);
+    tmc5160_model_write(&m, TMC5160_AMAX, profile.amax);
+    tmc5160_model_write(&m, TMC5160_DMAX, profile.dmax);
+    tmc5160_model_write(&m, TMC5160_D1, profile.d1);
+    tmc5160_model_write(&m, TMC5160_VSTOP, 10);
+    tmc5160_model_write(&m, TMC5160_XTARGET, (uint32_t)target);
+
+    int32_t dir = (target > 0) ? 1 : -1;
+    while (dir * m.xactual < x_stop && abs(tmc5160_model_vactual(&m)) < v_stop) {
+        tmc5160_model_step(&m, 100);
+    }
+
+    // start_stop_ramp(): stop ramp first, then XACTUAL/VACTUAL, then XTARGET
+    motion_profile_stop_ramp(&stop, profile.vmax, decel);
+    tmc5160_model_write(&m, TMC5160_V1, stop.v1);
+    tmc5160_model_write(&m, TMC5160_AMAX, stop.amax);
+    tmc5160_model_write(&m, TMC5160_DMAX, stop.dmax);
+    tmc5160_model_write(&m, TMC5160_D1, stop.d1);
+    int32_t x0 = m.xactual;
+    int32_t v0 = tmc5160_model_vactual(&m);
+    int32_t stop_target = motion_profile_stop_position(x0, v0, decel, STOP_LEAD);
+    tmc5160_model_step(&m, STOP_LATENCY);
+    tmc5160_model_write(&m, TMC5160_XTARGET, (uint32_t)stop_target);
+
+    uint64_t start = m.clocks;
+    bool reversed = false;
+    while (m.clocks - start < 10ull * TMC5160_MODEL_FCLK) {
+        tmc5160_model_step(&m, 100);
+        reversed |= (dir * tmc5160_model_vactual(&m) < 0);
+        if (tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_POSITION_REACHED) {
+            break;
+        }
+    }
+    double stop_s = (double)(m.clocks - start) / TMC5160_MODEL_FCLK;
+
+    double v = abs(v0);
+    double v_lead = v + decel * (double)STOP_LEAD / 131072.0; // Highest speed at the XTARGET write
+    double v_end = sqrt(256.0 * decel);
+    double distance = v * v / (256.0 * decel);
+    double time = v / decel * T_ACCEL_UNIT;
+    int32_t travel = abs(m.xactual - x0);
+
+    CHECK(m.xactual == stop_target);
+    CHECK(!reversed);
+    CHECK(!(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_SECOND_MOVE));
+    CHECK(travel >= distance);
+    CHECK(travel <= v_lead * v_lead / (256.0 * decel) + v_lead * STOP_LEAD / 16777216.0 + 2.0);
+    CHECK(stop_s >= 0.99 * (v - v_end) / decel * T_ACCEL_UNIT);
+    CHECK(stop_s <= v_lead / decel * T_ACCEL_UNIT + 2.0 * STOP_LEAD / TMC5160_MODEL_FCLK);
+
+    printf("stop from v=%6.0f with decel %5u: %6d usteps (%6.0f), %6.1f ms (%6.1f)\n",
+           v, decel, abs(m.xactual - x0), distance, stop_s * 1e3, time * 1e3);
+}
+
+// Halt / quick stop: cruising, accelerating (below and above V1), both directions.
+static void test_stop(void) {
+    static const uint32_t decels[] = { 1000, 4000, 20000 };
+
+    for (size_t i = 0; i < sizeof(decels) / sizeof(decels[0]); i++) {
+        check_stop(MOVE, 100000, VMAX + 1, decels[i]);
+        check_stop(-MOVE, 100000, VMAX + 1, decels[i]);
+        check_stop(MOVE, MOVE, 25600, decels[i]);
+        check_stop(-MOVE, MOVE, 4000, decels[i]);
+    }
+}
+
+/**
+ * @brief One SYNC of CSV mode as app.c does it: AMAX for the change from
+ *        the previous set-point, the direction, VMAX.
+ */
+static void csv_sync(struct tmc5160_model *m, int32_t from, int32_t to) {
+    tmc5160_model_write(m, TMC5160_AMAX, motion_profile_csv_accel(from, to, SYNC_US));
+    tmc5160_model_write(m, TMC5160_RAMPMODE, (to < 0) ? TMC5160_RAMPMODE_VELOCITY_NEG : TMC5160_RAMPMODE_VELOCITY_POS);
+    tmc5160_model_write(m, TMC5160_VMAX, (uint32_t)abs(to));
+}
+
+// CSV: every set-point is reached by the next SYNC, through reversals and
+// small steps, with the smallest AMAX that does it; the offset adds up.
+static void test_csv(void) {
+    struct tmc5160_model m;
+    int32_t from = 0;
+    int late = 0;
+    uint32_t peak_accel = 0;
+
+    CHECK(motion_profile_csv_velocity(1000, -300) == 700);
+    CHECK(motion_profile_csv_velocity(0x7FFFFFFF, 0x7FFFFFFF) == 0x7FFE00);
+    CHECK(motion_profile_csv_velocity(-0x7FFE00, -1) == -0x7FFE00);
+    CHECK(motion_profile_csv_accel(0, 0, SYNC_US) == 1);
+    CHECK(motion_profile_csv_accel(0, 1000000, 0) == 0xFFFF);
+    CHECK(motion_profile_csv_accel(0, 1000000, SYNC_US) == 0xFFFF);
+
+    tmc5160_model_reset(&m);
+    tmc5160_model_write(&m, TMC5160_VSTOP, 10);
+    for (int t = 0; t < 2000; t++) {
+        // 0.5 Hz sine of +/- 40000 with a small ripple: reversals and slow passages
+        int32_t to = motion_profile_csv_velocity((int32_t)lrint(40000.0 * sin(6.283185307179586 * t / 2000.0)),
+                                                 (t % 7) - 3);
+        uint32_t accel = motion_profile_csv_accel(from, to, SYNC_US);
+
+        csv_sync(&m, from, to);
+        tmc5160_model_step(&m, SYNC_CLOCKS);
+        late += (m.v_fine != (int64_t)to << 17); // Exactly, not only in VACTUAL
+        peak_accel = (accel > peak_accel) ? accel : peak_accel;
+
+        // One less would not have made it
+        if (accel > 1 && to != from) {
+            struct tmc5160_model slow = m;
+            slow.v_fine = (int64_t)from << 17; // Start of this period again
+            tmc5160_model_write(&slow, TMC5160_AMAX, accel - 1);
+            tmc5160_model_step(&slow, SYNC_CLOCKS);
+            CHECK(slow.v_fine != (int64_t)to << 17);
+        }
+        from = to;
+    }
+    CHECK(late == 0);
+
+    printf("csv: 2000 SYNCs of %d us, every set-point reached, peak AMAX %u (%.0f usteps/s^2)\n",
+           SYNC_US, peak_accel, peak_accel * A_TO_HZ2);
+}
+
+int main(void) {
+    test_v1_conversion();
+    test_scurve();
+    test_raised_accel();
+    test_stop();
+    test_csv();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all motion profile tests passed\n");
+    return 0;
+}
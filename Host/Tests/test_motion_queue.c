@@ -0,0 +1,376 @@
+/*
+ * Host test of the motion command queue of motion_queue.c over the
+ * simulator's SPI (Sim/sim_spi.c, one TMC5160 model per chip select): the
+ * commands run in order, writes of one register to several chips go out as
+ * one batch, a tick executes MOTION_QUEUE_TICK_MAX at most, the stop
+ * command brakes a moving motor short of its target, the power stage,
+ * driver settings and module calls run in their turn, the commands of a
+ * discarded chip select are dropped, the latencies are measured from
+ * the posting time of each command, and no tick sends more datagrams than
+ * its share of the period allows.
+ * Build and run with: make -C Host test
+ */
+#include "motion_queue.h"
+#include "motion_profile.h"
+#include "motion_timer.h"
+#include "sim.h"
+#include "spi.h"
+#include "tmc5160.h"
+#include "tmc5160_model.h"
+
+#include <limits.h>
+#include <stdio.h>
+
+static int failures = 0;
+static uint64_t now_ns = 0;
+static unsigned int cycles = 0; // Chip select cycles: sim_spi.c reads the time once per cycle
+static uint32_t clock_cycles = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+// Time base of sim_spi.c: stands still unless a test advances it
+uint64_t sim_time_ns(void) {
+    cycles++;
+    return now_ns;
+}
+
+// Cycle counter of the queue's latencies
+static uint32_t test_cycles(void) {
+    return clock_cycles;
+}
+
+static struct tmc5160 drvs[SPI1_CS_COUNT];
+static struct motion_queue queue;
+
+static void setup(void) {
+    now_ns = 0;
+    clock_cycles = 0;
+    sim_spi_set_chips(SPI1_CS_COUNT);
+    spi1_init();
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        drvs[cs] = (struct tmc5160){ .cs = (uint8_t)cs };
+    }
+    queue = (struct motion_queue){ .cycles = &test_cycles };
+}
+
+static bool post(struct tmc5160 *drv, uint8_t type, uint8_t address, int32_t value) {
+    return motion_queue_post(&queue, &(struct motion_command){
+        .drv = drv,
+        .posted = clock_cycles,
+        .type = type,
+        .address = address,
+        .value = value,
+    }, NULL);
+}
+
+// Commands run in order; a register written to all chips in a row is one batch
+static void test_order(void) {
+    uint32_t index;
+
+    setup();
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(post(&drvs[cs], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 100 * (int32_t)cs));
+    }
+    CHECK(motion_queue_post(&queue, &(struct motion_command){
+        .drv = &drvs[1], .type = MOTION_COMMAND_WRITE, .address = TMC5160_XTARGET, .value = -5 }, &index));
+    CHECK(!motion_queue_is_done(&queue, index));
+    CHECK(!motion_queue_is_empty(&queue));
+
+    cycles = 0;
+    CHECK(motion_queue_execute(&queue, UINT_MAX) == SPI1_CS_COUNT + 1);
+    CHECK(cycles == (SPI1_DAISY_CHAIN_LENGTH ? 2 : SPI1_CS_COUNT + 1));
+    CHECK(motion_queue_is_done(&queue, index));
+    CHECK(motion_queue_is_empty(&queue));
+    CHECK(queue.executed == SPI1_CS_COUNT + 1);
+
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(tmc5160_read_register(&drvs[cs], TMC5160_XTARGET) == ((cs == 1) ? -5 : 100 * (int32_t)cs));
+    }
+
+    // XTARGET = XACTUAL on the chip
+    tmc5160_write_register(&drvs[2], TMC5160_XACTUAL, 1234);
+    CHECK(post(&drvs[2], MOTION_COMMAND_COPY, TMC5160_XTARGET, TMC5160_XACTUAL));
+    motion_queue_execute(&queue, UINT_MAX);
+    CHECK(tmc5160_read_register(&drvs[2], TMC5160_XTARGET) == 1234);
+}
+
+// The queue refuses a command when full; a tick takes MOTION_QUEUE_TICK_MAX
+static void test_limits(void) {
+    unsigned int executed = 0, ticks = 0;
+
+    setup();
+    for (int i = 0; i < MOTION_QUEUE_DEPTH; i++) {
+        CHECK(post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_XTARGET, i));
+    }
+    CHECK(!post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_XTARGET, -1));
+
+    unsigned int n;
+    while ((n = motion_queue_execute(&queue, UINT_MAX)) > 0) {
+        CHECK(n <= MOTION_QUEUE_TICK_MAX);
+        executed += n;
+        ticks++;
+    }
+    CHECK(executed == MOTION_QUEUE_DEPTH);
+    CHECK(ticks == MOTION_QUEUE_DEPTH / MOTION_QUEUE_TICK_MAX);
+    CHECK(tmc5160_read_register(&drvs[0], TMC5160_XTARGET) == MOTION_QUEUE_DEPTH - 1);
+    CHECK(post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_XTARGET, -1));
+}
+
+// A stop ramp posted during a move brakes the motor short of the original
+// target, on the XTARGET the tick computed
+static void test_stop(void) {
+    struct tmc5160_ramp stop;
+    int32_t previous;
+
+    setup();
+    tmc5160_write_register(&drvs[0], TMC5160_RAMPMODE, TMC5160_RAMPMODE_POSITION);
+    tmc5160_write_register(&drvs[0], TMC5160_VSTOP, 10);
+    tmc5160_write_register(&drvs[0], TMC5160_AMAX, 2000);
+    tmc5160_write_register(&drvs[0], TMC5160_DMAX, 2000);
+    tmc5160_write_register(&drvs[0], TMC5160_VMAX, 200000);
+    tmc5160_write_register(&drvs[0], TMC5160_XTARGET, 10000000);
+    now_ns = 1000000000; // 1 s
+
+    // The commands of start_stop_ramp() in app.c
+    motion_profile_stop_ramp(&stop, 200000, 5000);
+    post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_AMAX, (int32_t)stop.amax);
+    post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_DMAX, (int32_t)stop.dmax);
+    post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_D1, (int32_t)stop.d1);
+    post(&drvs[0], MOTION_COMMAND_STOP, 0, 5000);
+    motion_queue_execute(&queue, UINT_MAX);
+
+    int32_t target = tmc5160_read_register(&drvs[0], TMC5160_XTARGET);
+    int32_t furthest = tmc5160_read_register(&drvs[0], TMC5160_XACTUAL);
+    CHECK(target > furthest && target < 10000000);
+    for (int ms = 0; ms < 2000; ms++) {
+        now_ns += 1000000;
+        int32_t x = tmc5160_read_register(&drvs[0], TMC5160_XACTUAL);
+        if (x > furthest) {
+            furthest = x;
+        }
+        previous = x;
+    }
+    CHECK(previous == target);
+    CHECK(furthest - target <= 1); // The last microstep at VSTOP
+    CHECK(tmc5160_read_register(&drvs[0], TMC5160_VACTUAL) == 0);
+    printf("stop: at %d, furthest %d\n", previous, furthest);
+}
+
+static int32_t called_value;
+
+static void record_call(void *context, int32_t value) {
+    called_value = value;
+    tmc5160_write_register(context, TMC5160_XTARGET, value);
+}
+
+// The power stage and the driver settings follow drv->config; a call runs
+// after the commands posted before it
+static void test_driver(void) {
+    setup();
+    drvs[0].config.chopconf = 0x000100C3; // TOFF = 3
+    drvs[0].driver_enabled = true;
+    post(&drvs[0], MOTION_COMMAND_CONFIGURE, 0, 0);
+    post(&drvs[0], MOTION_COMMAND_ENABLE, 0, 0);
+    CHECK(motion_queue_execute(&queue, UINT_MAX) == 2);
+    CHECK(tmc5160_read_register(&drvs[0], TMC5160_CHOPCONF) == 0x000100C0);
+    CHECK(!drvs[0].driver_enabled);
+
+    // New settings keep a disabled power stage off
+    drvs[0].config.chopconf = 0x000100C5;
+    post(&drvs[0], MOTION_COMMAND_CONFIGURE, 0, 0);
+    motion_queue_execute(&queue, UINT_MAX);
+    CHECK(tmc5160_read_register(&drvs[0], TMC5160_CHOPCONF) == 0x000100C0);
+    post(&drvs[0], MOTION_COMMAND_ENABLE, 0, 1);
+    motion_queue_execute(&queue, UINT_MAX);
+    CHECK(tmc5160_read_register(&drvs[0], TMC5160_CHOPCONF) == 0x000100C5);
+
+    called_value = 0;
+    post(&drvs[1], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 10);
+    CHECK(motion_queue_post(&queue, &(struct motion_command){
+        .drv = &drvs[1], .type = MOTION_COMMAND_CALL, .call = &record_call, .context = &drvs[1], .value = 20 }, NULL));
+    CHECK(called_value == 0);
+    motion_queue_execute(&queue, UINT_MAX);
+    CHECK(called_value == 20);
+    CHECK(tmc5160_read_register(&drvs[1], TMC5160_XTARGET) == 20);
+
+    // Dropped with the other commands of its chip select
+    called_value = 0;
+    queue.discarded = 1u << 1;
+    motion_queue_post(&queue, &(struct motion_command){
+        .drv = &drvs[1], .type = MOTION_COMMAND_CALL, .call = &record_call, .context = &drvs[1], .value = 30 }, NULL);
+    motion_queue_execute(&queue, UINT_MAX);
+    CHECK(called_value == 0);
+}
+
+// Commands of a discarded chip select are taken from the queue unexecuted;
+// a batch still writes the other chips
+static void test_discard(void) {
+    setup();
+    queue.discarded = 1u << 1;
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        post(&drvs[cs], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 100 + (int32_t)cs);
+    }
+    tmc5160_write_register(&drvs[1], TMC5160_XACTUAL, 55);
+    post(&drvs[1], MOTION_COMMAND_COPY, TMC5160_XTARGET, TMC5160_XACTUAL);
+    CHECK(motion_queue_execute(&queue, UINT_MAX) == SPI1_CS_COUNT + 1);
+    CHECK(motion_queue_is_empty(&queue));
+
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(tmc5160_read_register(&drvs[cs], TMC5160_XTARGET) == ((cs == 1) ? 0 : 100 + (int32_t)cs));
+    }
+
+    // At once, outside the queue
+    motion_command_execute(&(struct motion_command){
+        .drv = &drvs[1], .type = MOTION_COMMAND_COPY, .address = TMC5160_XTARGET, .value = TMC5160_XACTUAL });
+    CHECK(tmc5160_read_register(&drvs[1], TMC5160_XTARGET) == 55);
+}
+
+// Latencies count from the posting time; a mark records when the commands
+// before it are done
+static void test_latency(void) {
+    setup();
+    post(&drvs[0], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 1);
+    clock_cycles = 40;
+    post(&drvs[1], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 2);
+    motion_queue_post(&queue, &(struct motion_command){ .posted = 30, .type = MOTION_COMMAND_MARK }, NULL);
+    clock_cycles = 100;
+    motion_queue_execute(&queue, UINT_MAX);
+
+    CHECK(queue.max_latency == 100);
+    CHECK(queue.marks == 1);
+    CHECK(queue.mark_latency == 70);
+    CHECK(queue.executed == 3);
+
+    motion_queue_reset_stats(&queue);
+    CHECK(queue.max_latency == 0 && queue.marks == 0 && queue.executed == 0);
+}
+
+static void write_registers(void *context, int32_t value) {
+    for (int32_t i = 0; i < value; i++) {
+        tmc5160_write_register(context, TMC5160_XTARGET, i);
+    }
+}
+
+// Each command type sends the datagrams the budget counts for it
+static void test_datagrams(void) {
+    const struct motion_command commands[] = {
+        { .drv = &drvs[0], .type = MOTION_COMMAND_WRITE, .address = TMC5160_XTARGET, .value = 1 },
+        { .drv = &drvs[0], .type = MOTION_COMMAND_COPY, .address = TMC5160_XTARGET, .value = TMC5160_XACTUAL },
+        { .drv = &drvs[0], .type = MOTION_COMMAND_STOP, .value = 1000 },
+        { .drv = &drvs[0], .type = MOTION_COMMAND_ENABLE, .value = 1 },
+        { .drv = &drvs[0], .type = MOTION_COMMAND_CONFIGURE },
+        { .drv = &drvs[0], .type = MOTION_COMMAND_CALL, .call = &write_registers, .context = &drvs[0],
+          .value = MOTION_COMMAND_DATAGRAMS_MAX, .datagrams = MOTION_COMMAND_DATAGRAMS_MAX },
+        { .type = MOTION_COMMAND_MARK },
+    };
+
+    setup();
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++) {
+        CHECK(motion_command_datagrams(&commands[i]) <= MOTION_COMMAND_DATAGRAMS_MAX);
+        motion_queue_post(&queue, &commands[i], NULL);
+        cycles = 0;
+        motion_queue_execute(&queue, UINT_MAX);
+        CHECK(cycles == motion_command_datagrams(&commands[i]));
+    }
+
+    // The budget ends a batch and holds back the next command
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        post(&drvs[cs], MOTION_COMMAND_WRITE, TMC5160_XTARGET, 1);
+    }
+    post(&drvs[0], MOTION_COMMAND_STOP, 0, 1000);
+    cycles = 0;
+    CHECK(motion_queue_execute(&queue, 2) == 2);
+    CHECK(cycles == 2);
+    CHECK(motion_queue_execute(&queue, 2) == SPI1_CS_COUNT - 2);
+    cycles = 0;
+    CHECK(motion_queue_execute(&queue, 2) == 1); // Larger than the budget: alone
+    CHECK(cycles == 5);
+}
+
+// The accesses of on_motion_tick() in app.c with every fitted axis
+// interpolating and the queue full of the largest commands: at the
+// shortest period the fitted axes allow, and at the longest, no tick takes
+// more than its share of the period
+static void test_tick_budget(void) {
+    static const uint8_t sample[] = { TMC5160_RAMP_STAT, TMC5160_XACTUAL, TMC5160_VACTUAL, TMC5160_X_ENC };
+    struct tmc5160 *fitted[SPI1_CS_COUNT];
+    int32_t values[SPI1_CS_COUNT] = { 0 };
+    int32_t regs[4];
+
+    CHECK(motion_tick_min_period_us(0) <= MOTION_TIMER_PERIOD_US);
+    for (unsigned int axes = 1; axes <= SPI1_CS_COUNT; axes++) {
+        const uint32_t periods[] = { motion_tick_min_period_us(axes), MOTION_TIMER_PERIOD_MAX_US };
+
+        CHECK(periods[0] <= MOTION_TIMER_PERIOD_MAX_US);
+        for (size_t p = 0; p < 2; p++) {
+            unsigned int budget = motion_tick_budget(periods[p], axes);
+            uint64_t limit_ns = (uint64_t)periods[p] * 1000u * MOTION_TICK_SPI_LOAD_PERCENT / 100u;
+            unsigned int ticks = 0, worst = 0;
+
+            setup();
+            for (unsigned int n = 0; n < axes; n++) {
+                fitted[n] = &drvs[n];
+            }
+            CHECK(budget >= MOTION_COMMAND_DATAGRAMS_MAX);
+            for (unsigned int i = 0; i < MOTION_QUEUE_DEPTH; i++) {
+                struct tmc5160 *drv = &drvs[i % axes];
+                switch (i % 4) {
+                    case 0:
+                        post(drv, MOTION_COMMAND_STOP, 0, 1000);
+                        break;
+                    case 1:
+                        post(drv, MOTION_COMMAND_CONFIGURE, 0, 0);
+                        break;
+                    case 2:
+                        motion_queue_post(&queue, &(struct motion_command){
+                            .drv = drv, .type = MOTION_COMMAND_CALL, .call = &write_registers, .context = drv,
+                            .value = MOTION_COMMAND_DATAGRAMS_MAX, .datagrams = MOTION_COMMAND_DATAGRAMS_MAX }, NULL);
+                        break;
+                    default:
+                        post(drv, MOTION_COMMAND_WRITE, TMC5160_VMAX, 0);
+                        break;
+                }
+            }
+
+            while (!motion_queue_is_empty(&queue)) {
+                cycles = 0;
+                tmc5160_write_registers_batch(fitted, axes, TMC5160_VMAX, values);
+                tmc5160_write_registers_batch(fitted, axes, TMC5160_XTARGET, values);
+                CHECK(motion_queue_execute(&queue, budget) > 0);
+                tmc5160_read_registers(fitted[ticks % axes], sample, regs, 4);
+
+                CHECK((uint64_t)cycles * MOTION_TICK_DATAGRAM_NS <= limit_ns);
+                if (cycles > worst) {
+                    worst = cycles;
+                }
+                ticks++;
+            }
+            printf("tick budget: %u axes at %u us: %u datagrams for commands, worst tick %u datagrams "
+                   "(%u us), queue empty after %u ticks\n", axes, (unsigned int)periods[p], budget, worst,
+                   (unsigned int)((uint64_t)worst * MOTION_TICK_DATAGRAM_NS / 1000u), ticks);
+        }
+    }
+}
+
+int main(void) {
+    test_order();
+    test_limits();
+    test_stop();
+    test_driver();
+    test_discard();
+    test_latency();
+    test_datagrams();
+    test_tick_budget();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all motion queue tests passed\n");
+    return 0;
+}
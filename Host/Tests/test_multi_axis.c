@@ -0,0 +1,191 @@
+/*
+ * Host test of the multi-axis access of tmc5160.c over the simulator's SPI
+ * (Sim/sim_spi.c, one TMC5160 model per chip select): batched reads across
+ * chips against single reads, moving axes sampled in one batch, batched
+ * writes, the detection of unfitted chips, and the SPI_STATUS byte of
+ * every reply kept per chip (a driver error seen without reading GSTAT).
+ * Built a second time with
+ * -DSPI1_DAISY_CHAIN_LENGTH=4 (test_daisy_chain), where the models are
+ * chained and a batch takes one chip select cycle per datagram round.
+ * Build and run with: make -C Host test
+ */
+#include "sim.h"
+#include "spi.h"
+#include "tmc5160.h"
+#include "tmc5160_model.h"
+
+#include <stdio.h>
+
+static int failures = 0;
+static uint64_t now_ns = 0;
+static unsigned int cycles = 0; // Chip select cycles: sim_spi.c reads the time once per cycle
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+// Time base of sim_spi.c: stands still unless a test advances it
+uint64_t sim_time_ns(void) {
+    cycles++;
+    return now_ns;
+}
+
+// Chip select cycles of one datagram round to 'n' chips
+static unsigned int round_cycles(unsigned int n) {
+    return SPI1_DAISY_CHAIN_LENGTH ? 1 : n;
+}
+
+static struct tmc5160 drvs[SPI1_CS_COUNT];
+static struct tmc5160 *const drv_list[SPI1_CS_COUNT] = { &drvs[0], &drvs[1], &drvs[2], &drvs[3] };
+
+static void setup(unsigned int chips) {
+    now_ns = 0;
+    sim_spi_set_chips(chips);
+    spi1_init();
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        drvs[cs] = (struct tmc5160){ .cs = (uint8_t)cs };
+    }
+}
+
+// Only the fitted chips report the TMC5160 version
+static void test_presence(void) {
+    setup(2);
+    CHECK(tmc5160_is_present(&drvs[0]));
+    CHECK(tmc5160_is_present(&drvs[1]));
+    CHECK(!tmc5160_is_present(&drvs[2]));
+    CHECK(!tmc5160_is_present(&drvs[3]));
+
+    // Writes to an unfitted chip go nowhere
+    tmc5160_write_register(&drvs[2], TMC5160_XACTUAL, 1234);
+    CHECK(tmc5160_read_register(&drvs[2], TMC5160_XACTUAL) == 0);
+    CHECK(drvs[2].writes == 1);
+}
+
+// A batch over all chips returns what single reads of each chip return
+static void test_batch_matches_single(void) {
+    static const uint8_t addresses[] = { TMC5160_XACTUAL, TMC5160_XTARGET, TMC5160_RAMP_STAT, TMC5160_IOIN };
+    enum { COUNT = sizeof(addresses) };
+    int32_t batch[SPI1_CS_COUNT * COUNT];
+    int32_t single[COUNT];
+
+    setup(SPI1_CS_COUNT);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        tmc5160_write_register(&drvs[cs], TMC5160_XACTUAL, 1000 * (int32_t)cs - 1500);
+        tmc5160_write_register(&drvs[cs], TMC5160_XTARGET, 1000 * (int32_t)cs + 7);
+    }
+
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT, addresses, batch, COUNT);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        tmc5160_read_registers(&drvs[cs], addresses, single, COUNT);
+        for (unsigned int k = 0; k < COUNT; k++) {
+            CHECK(batch[cs * COUNT + k] == single[k]);
+            CHECK(single[k] == tmc5160_read_register(&drvs[cs], addresses[k]));
+        }
+        CHECK(batch[cs * COUNT] == 1000 * (int32_t)cs - 1500);
+        CHECK(batch[cs * COUNT + 1] == 1000 * (int32_t)cs + 7);
+        CHECK(TMC5160_IOIN_VERSION(batch[cs * COUNT + 3]) == TMC5160_VERSION);
+    }
+
+    // More chips than chip selects: nothing is read
+    batch[0] = -1;
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT + 1, addresses, batch, COUNT);
+    CHECK(batch[0] == -1);
+}
+
+// Axes moving at the same speed are sampled at the same position in one batch
+static void test_batch_sampling(void) {
+    static const uint8_t addresses[] = { TMC5160_XACTUAL, TMC5160_VACTUAL };
+    int32_t batch[SPI1_CS_COUNT * 2];
+
+    setup(SPI1_CS_COUNT);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        tmc5160_write_register(&drvs[cs], TMC5160_RAMPMODE, TMC5160_RAMPMODE_VELOCITY_POS);
+        tmc5160_write_register(&drvs[cs], TMC5160_AMAX, 1000);
+        tmc5160_write_register(&drvs[cs], TMC5160_VMAX, 51200);
+    }
+
+    now_ns = 500000000; // 0.5 s
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT, addresses, batch, 2);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(batch[cs * 2] > 0);
+        CHECK(batch[cs * 2] == batch[0]);
+        CHECK(batch[cs * 2 + 1] == batch[1]);
+    }
+    printf("sampling: %d axes at XACTUAL %d, VACTUAL %d\n", SPI1_CS_COUNT, batch[0], batch[1]);
+}
+
+// A batched write reaches every chip, in one frame when chained; single
+// accesses leave the other chips alone
+static void test_batch_write(void) {
+    static const uint8_t addresses[] = { TMC5160_XTARGET, TMC5160_XACTUAL };
+    const int32_t targets[SPI1_CS_COUNT] = { 100, -200, 300, -400 };
+    int32_t values[SPI1_CS_COUNT * 2];
+
+    setup(SPI1_CS_COUNT);
+    cycles = 0;
+    tmc5160_write_registers_batch(drv_list, SPI1_CS_COUNT, TMC5160_XTARGET, targets);
+    CHECK(cycles == round_cycles(SPI1_CS_COUNT));
+
+    cycles = 0;
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT, addresses, values, 2);
+    CHECK(cycles == 3 * round_cycles(SPI1_CS_COUNT));
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(values[cs * 2] == targets[cs]);
+        CHECK(values[cs * 2 + 1] == 0);
+        CHECK(drvs[cs].writes == 1);
+    }
+
+    tmc5160_write_register(&drvs[2], TMC5160_XTARGET, 12345);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(tmc5160_read_register(&drvs[cs], TMC5160_XTARGET) == ((cs == 2) ? 12345 : targets[cs]));
+    }
+    CHECK(drvs[2].writes == 2 && drvs[1].writes == 1);
+    printf("batch write: %u chip select cycle(s) for %d axes\n", round_cycles(SPI1_CS_COUNT), SPI1_CS_COUNT);
+}
+
+// Every datagram, read or write, brings the status of its chip along
+static void test_status(void) {
+    int32_t values[SPI1_CS_COUNT];
+    static const uint8_t address = TMC5160_XACTUAL;
+
+    setup(SPI1_CS_COUNT);
+    tmc5160_write_register(&drvs[1], TMC5160_GSTAT, TMC5160_GSTAT_RESET);
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT, &address, values, 1);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(drvs[cs].status & TMC5160_SPI_STATUS_STANDSTILL);
+        CHECK(!(drvs[cs].status & TMC5160_SPI_STATUS_DRIVER_ERROR));
+        CHECK(!(drvs[cs].status & TMC5160_SPI_STATUS_RESET) == (cs == 1));
+    }
+
+    // Overtemperature on chip 2: reported by the next access, whatever it reads
+    sim_spi_set_driver_flags(2, TMC5160_DRV_STATUS_OT);
+    tmc5160_read_registers_batch(drv_list, SPI1_CS_COUNT, &address, values, 1);
+    for (unsigned int cs = 0; cs < SPI1_CS_COUNT; cs++) {
+        CHECK(!(drvs[cs].status & TMC5160_SPI_STATUS_DRIVER_ERROR) == (cs != 2));
+    }
+    CHECK(tmc5160_read_register(&drvs[2], TMC5160_DRV_STATUS) & TMC5160_DRV_STATUS_OT);
+
+    // Clearing drv_err ends it; the write itself still saw the error
+    tmc5160_write_register(&drvs[2], TMC5160_GSTAT, TMC5160_GSTAT_DRV_ERR);
+    CHECK(drvs[2].status & TMC5160_SPI_STATUS_DRIVER_ERROR);
+    CHECK(!(tmc5160_read_register(&drvs[2], TMC5160_DRV_STATUS) & TMC5160_DRV_STATUS_OT));
+    CHECK(!(drvs[2].status & TMC5160_SPI_STATUS_DRIVER_ERROR));
+}
+
+int main(void) {
+    test_presence();
+    test_batch_matches_single();
+    test_batch_sampling();
+    test_batch_write();
+    test_status();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all multi-axis tests passed\n");
+    return 0;
+}
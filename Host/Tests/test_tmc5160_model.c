@@ -0,0 +1,266 @@
+/*
+ * Host test of the TMC5160 ramp generator model against the closed-form
+ * ramps of the datasheet (12.1): settle time, overshoot, phase timing.
+ * Build and run with: make -C Host test
+ */
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define STEP_CLOCKS     1200 // 100 us between observations
+#define T_ACCEL_UNIT    (131072.0 / TMC5160_MODEL_FCLK) // Seconds for 'a' velocity units at acceleration 'a'
+#define V_TO_HZ         (TMC5160_MODEL_FCLK / 16777216.0) // VMAX units to usteps/s
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, rel) do { \
+        double a_ = (actual), e_ = (expected); \
+        if (fabs(a_ - e_) > fabs(e_) * (rel)) { \
+            printf("%s:%d: %s = %g, expected %g (+/- %g%%)\n", \
+                   __FILE__, __LINE__, #actual, a_, e_, (rel) * 100.0); \
+            failures++; \
+        } \
+    } while (0)
+
+struct trajectory {
+    double settle_s;    // Time until XACTUAL == XTARGET at standstill
+    double vmax_s;      // First time VACTUAL reached VMAX (or -1)
+    double v1_s;        // First time |VACTUAL| reached V1 (or -1)
+    int32_t overshoot;  // Furthest travel beyond the final target
+    int32_t peak_v;     // Largest |VACTUAL|
+    bool second_move;
+};
+
+static double seconds(const struct tmc5160_model *m) {
+    return (double)m->clocks / TMC5160_MODEL_FCLK;
+}
+
+static void setup(struct tmc5160_model *m, int32_t v1, int32_t a1, int32_t amax, int32_t vmax,
+                  int32_t dmax, int32_t d1, int32_t vstop) {
+    tmc5160_model_reset(m);
+    tmc5160_model_write(m, TMC5160_RAMPMODE, 0);
+    tmc5160_model_write(m, TMC5160_V1, (uint32_t)v1);
+    tmc5160_model_write(m, TMC5160_A1, (uint32_t)a1);
+    tmc5160_model_write(m, TMC5160_AMAX, (uint32_t)amax);
+    tmc5160_model_write(m, TMC5160_VMAX, (uint32_t)vmax);
+    tmc5160_model_write(m, TMC5160_DMAX, (uint32_t)dmax);
+    tmc5160_model_write(m, TMC5160_D1, (uint32_t)d1);
+    tmc5160_model_write(m, TMC5160_VSTOP, (uint32_t)vstop);
+}
+
+static bool at_rest_on_target(const struct tmc5160_model *m) {
+    uint32_t stat = tmc5160_model_read(m, TMC5160_RAMP_STAT);
+    return (stat & TMC5160_RAMP_STAT_POSITION_REACHED) && (stat & TMC5160_RAMP_STAT_VZERO);
+}
+
+/**
+ * @brief Steps the model until it rests on XTARGET (or 'timeout_s' passed)
+ *        and records the trajectory, timed from the call.
+ */
+static struct trajectory run(struct tmc5160_model *m, double timeout_s) {
+    struct trajectory t = { -1.0, -1.0, -1.0, 0, 0, false };
+    double start = seconds(m);
+    int32_t target = (int32_t)tmc5160_model_read(m, TMC5160_XTARGET);
+    int32_t dir = (target >= m->xactual) ? 1 : -1;
+    int32_t vmax = (int32_t)m->reg[TMC5160_VMAX];
+    int32_t v1 = (int32_t)m->reg[TMC5160_V1];
+
+    while (seconds(m) - start < timeout_s) {
+        tmc5160_model_step(m, STEP_CLOCKS);
+
+        int32_t v = abs(tmc5160_model_vactual(m));
+        int32_t beyond = dir * (m->xactual - target);
+        double now = seconds(m) - start;
+
+        if (v > t.peak_v) {
+            t.peak_v = v;
+        }
+        if (beyond > t.overshoot) {
+            t.overshoot = beyond;
+        }
+        if (t.vmax_s < 0 && v == vmax) {
+            t.vmax_s = now;
+        }
+        if (t.v1_s < 0 && v1 > 0 && v >= v1) {
+            t.v1_s = now;
+        }
+        if (tmc5160_model_read(m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_SECOND_MOVE) {
+            t.second_move = true;
+        }
+        if (at_rest_on_target(m)) {
+            t.settle_s = now;
+            break;
+        }
+    }
+    return t;
+}
+
+// Trapezoid with V1 = 0: AMAX up, VMAX cruise, DMAX down.
+static void test_trapezoid(void) {
+    struct tmc5160_model m;
+    setup(&m, 0, 0, 1000, 51200, 1000, 0, 10);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, 200000);
+    struct trajectory t = run(&m, 20.0);
+
+    double t_ramp = 51200.0 / 1000.0 * T_ACCEL_UNIT;               // 0.559 s
+    double s_ramp = 51200.0 * 51200.0 / (256.0 * 1000.0);          // 10240 usteps
+    double t_cruise = (200000.0 - 2.0 * s_ramp) / (51200.0 * V_TO_HZ);
+
+    CHECK_NEAR(t.vmax_s, t_ramp, 0.005);
+    CHECK_NEAR(t.settle_s, 2.0 * t_ramp + t_cruise, 0.005);
+    CHECK(t.overshoot == 0);
+    CHECK(t.peak_v == 51200);
+    CHECK(m.xactual == 200000);
+    CHECK(!t.second_move);
+    CHECK(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_EVENT_POS_REACHED);
+}
+
+// Six-point ramp: A1 up to V1, AMAX up to VMAX; the mirror image down.
+static void test_six_point(void) {
+    struct tmc5160_model m;
+    setup(&m, 25600, 2000, 1000, 51200, 1000, 2000, 10);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, -300000);
+    struct trajectory t = run(&m, 20.0);
+
+    double t_a1 = 25600.0 / 2000.0 * T_ACCEL_UNIT;
+    double t_amax = 25600.0 / 1000.0 * T_ACCEL_UNIT;
+    double s_a = 25600.0 * 25600.0 / (256.0 * 2000.0)
+               + (51200.0 * 51200.0 - 25600.0 * 25600.0) / (256.0 * 1000.0);
+    double t_cruise = (300000.0 - 2.0 * s_a) / (51200.0 * V_TO_HZ);
+
+    CHECK_NEAR(t.v1_s, t_a1, 0.01);
+    CHECK_NEAR(t.vmax_s, t_a1 + t_amax, 0.005);
+    CHECK_NEAR(t.settle_s, 2.0 * (t_a1 + t_amax) + t_cruise, 0.005);
+    CHECK(t.overshoot == 0);
+    CHECK(m.xactual == -300000);
+}
+
+// Short move: VMAX is never reached, the ramp is a triangle.
+static void test_triangle(void) {
+    struct tmc5160_model m;
+    setup(&m, 0, 0, 1000, 51200, 1000, 0, 10);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, 5000);
+    struct trajectory t = run(&m, 5.0);
+
+    double v_peak = sqrt(256.0 * 1000.0 * 2500.0);
+    CHECK_NEAR(t.peak_v, v_peak, 0.02);
+    CHECK(t.vmax_s < 0);
+    CHECK_NEAR(t.settle_s, 2.0 * v_peak / 1000.0 * T_ACCEL_UNIT, 0.02);
+    CHECK(t.overshoot == 0);
+    CHECK(m.xactual == 5000);
+}
+
+// XTARGET moved behind the braking distance: overshoot, stop, second move.
+static void test_target_behind(void) {
+    struct tmc5160_model m;
+    setup(&m, 0, 0, 1000, 51200, 1000, 0, 10);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, 200000);
+    while (m.xactual < 50000) {
+        tmc5160_model_step(&m, STEP_CLOCKS);
+    }
+    tmc5160_model_write(&m, TMC5160_XTARGET, 40000);
+
+    // Braking from VMAX takes 10240 usteps beyond the point of the change.
+    int32_t peak = m.xactual;
+    while (tmc5160_model_vactual(&m) > 0) {
+        tmc5160_model_step(&m, STEP_CLOCKS);
+        if (m.xactual > peak) {
+            peak = m.xactual;
+        }
+    }
+    CHECK_NEAR(peak - 40000, 50000 + 10240 - 40000, 0.02);
+
+    struct trajectory t = run(&m, 20.0);
+    CHECK(t.overshoot == 0);
+    CHECK(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_SECOND_MOVE);
+    CHECK(m.xactual == 40000);
+}
+
+// TZEROWAIT holds the next move after a stop (512 clocks per count).
+static void test_tzerowait(void) {
+    struct tmc5160_model m;
+    setup(&m, 0, 0, 1000, 51200, 1000, 0, 10);
+    tmc5160_model_write(&m, TMC5160_TZEROWAIT, 5000);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, 1000);
+    run(&m, 5.0);
+    CHECK(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_T_ZEROWAIT_ACTIVE);
+
+    tmc5160_model_write(&m, TMC5160_XTARGET, 0);
+    double start = seconds(&m);
+    while (m.xactual == 1000 && seconds(&m) - start < 1.0) {
+        tmc5160_model_step(&m, STEP_CLOCKS);
+    }
+    CHECK_NEAR(seconds(&m) - start, 5000.0 * 512.0 / TMC5160_MODEL_FCLK, 0.02);
+}
+
+// Velocity mode: AMAX both ways, through zero when the direction changes.
+static void test_velocity_mode(void) {
+    struct tmc5160_model m;
+    setup(&m, 0, 0, 1000, 51200, 1000, 0, 10);
+
+    tmc5160_model_write(&m, TMC5160_RAMPMODE, 1);
+    tmc5160_model_step(&m, (uint32_t)(0.5 * TMC5160_MODEL_FCLK));
+    CHECK(!(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_VELOCITY_REACHED));
+    tmc5160_model_step(&m, (uint32_t)(0.1 * TMC5160_MODEL_FCLK));
+    CHECK(tmc5160_model_vactual(&m) == 51200);
+    CHECK(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_VELOCITY_REACHED);
+
+    tmc5160_model_write(&m, TMC5160_RAMPMODE, 2);
+    tmc5160_model_step(&m, (uint32_t)(2.0 * 51.2 * T_ACCEL_UNIT * TMC5160_MODEL_FCLK) + STEP_CLOCKS);
+    CHECK(tmc5160_model_vactual(&m) == -51200);
+    CHECK((tmc5160_model_read(&m, TMC5160_VACTUAL) & 0x00FFFFFF) == (uint32_t)(-51200 & 0x00FFFFFF));
+}
+
+// Register interface: write-only registers read 0, GSTAT/RAMP_STAT events clear on write 1.
+static void test_registers(void) {
+    struct tmc5160_model m;
+    tmc5160_model_reset(&m);
+
+    CHECK(tmc5160_model_status(&m) & TMC5160_SPI_STATUS_RESET);
+    tmc5160_model_write(&m, TMC5160_GSTAT, 0x01);
+    CHECK(!(tmc5160_model_status(&m) & TMC5160_SPI_STATUS_RESET));
+
+    tmc5160_model_write(&m, TMC5160_VMAX, 1234);
+    CHECK(tmc5160_model_read(&m, TMC5160_VMAX) == 0);
+    CHECK(tmc5160_model_read(&m, TMC5160_IOIN) >> 24 == 0x30);
+
+    tmc5160_model_write(&m, TMC5160_XACTUAL, 777);
+    CHECK(tmc5160_model_read(&m, TMC5160_XACTUAL) == 777);
+
+    m.events = TMC5160_RAMP_STAT_EVENT_POS_REACHED;
+    tmc5160_model_write(&m, TMC5160_RAMP_STAT, TMC5160_RAMP_STAT_EVENT_POS_REACHED);
+    CHECK(!(tmc5160_model_read(&m, TMC5160_RAMP_STAT) & TMC5160_RAMP_STAT_EVENT_POS_REACHED));
+}
+
+int main(void) {
+    test_trapezoid();
+    test_six_point();
+    test_triangle();
+    test_target_behind();
+    test_tzerowait();
+    test_velocity_mode();
+    test_registers();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all tmc5160 model tests passed\n");
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*
+ * Replays a positioning move recorded on the drive (scope fetch CSV) on the
+ * TMC5160 ramp model and compares the two.
+ *
+ * Usage: tmc5160_trace <trace.csv> [REG=value ...] [TOL=usteps]
+ *
+ * The trace needs the xactual channel (vactual is compared when present),
+ * with the move started at t_trigger_ms = 0 (the recorder triggers on the
+ * start of a move). REG is one of the ramp registers below; the defaults are
+ * the profile app.c configures at start-up. XTARGET defaults to the
+ * last position of the trace. The exit code is 1 when the position error
+ * exceeds TOL (default: 1% of the move, at least 10 usteps).
+ */
+#include "tmc5160_model.h"
+#include "tmc5160.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LINE_MAX_LEN    512
+#define COLUMNS_MAX     16
+
+struct sample {
+    double t_ms;
+    int32_t xactual;
+    int32_t vactual;
+};
+
+struct reg_arg {
+    const char *name;
+    uint8_t address;
+    int32_t value;
+};
+
+static struct reg_arg regs[] = {
+    { "RAMPMODE", TMC5160_RAMPMODE, 0 },
+    { "VSTART", TMC5160_VSTART, 0 },
+    { "A1", TMC5160_A1, 0 },
+    { "V1", TMC5160_V1, 0 },
+    { "AMAX", TMC5160_AMAX, 1000 },
+    { "VMAX", TMC5160_VMAX, 51200 },
+    { "DMAX", TMC5160_DMAX, 1000 },
+    { "D1", TMC5160_D1, 1000 },
+    { "VSTOP", TMC5160_VSTOP, 100 },
+    { "TZEROWAIT", TMC5160_TZEROWAIT, 5000 },
+};
+
+#define REG_COUNT       (sizeof(regs) / sizeof(regs[0]))
+
+static int split(char *line, char **fields) {
+    int n = 0;
+    for (char *tok = strtok(line, ",\r\n"); tok && n < COLUMNS_MAX; tok = strtok(NULL, ",\r\n")) {
+        fields[n++] = tok;
+    }
+    return n;
+}
+
+static int find_column(char **fields, int n, const char *name) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(fields[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static struct sample *read_trace(const char *path, size_t *count, bool *has_v) {
+    char line[LINE_MAX_LEN];
+    char *fields[COLUMNS_MAX];
+    FILE *f = fopen(path, "r");
+
+    if (!f || !fgets(line, sizeof(line), f)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        exit(2);
+    }
+
+    int n = split(line, fields);
+    int col_t = find_column(fields, n, "t_trigger_ms");
+    int col_x = find_column(fields, n, "xactual");
+    int col_v = find_column(fields, n, "vactual");
+    if (col_t < 0 || col_x < 0) {
+        fprintf(stderr, "%s: needs the t_trigger_ms and xactual columns\n", path);
+        exit(2);
+    }
+    *has_v = (col_v >= 0);
+
+    size_t capacity = 1024;
+    struct sample *samples = malloc(capacity * sizeof(*samples));
+    *count = 0;
+
+    while (samples && fgets(line, sizeof(line), f)) {
+        if (split(line, fields) != n) {
+            continue;
+        }
+        if (*count == capacity) {
+            capacity *= 2;
+            samples = realloc(samples, capacity * sizeof(*samples));
+            if (!samples) {
+                break;
+            }
+        }
+        struct sample *s = &samples[(*count)++];
+        s->t_ms = strtod(fields[col_t], NULL);
+        s->xactual = (int32_t)strtol(fields[col_x], NULL, 0);
+        s->vactual = *has_v ? (int32_t)strtol(fields[col_v], NULL, 0) : 0;
+    }
+    fclose(f);
+
+    if (!samples || *count == 0) {
+        fprintf(stderr, "%s: no samples\n", path);
+        exit(2);
+    }
+    return samples;
+}
+
+static bool parse_arg(const char *arg, int32_t *xtarget, bool *has_xtarget, double *tol) {
+    const char *eq = strchr(arg, '=');
+    if (!eq) {
+        return false;
+    }
+    size_t len = (size_t)(eq - arg);
+    long value = strtol(eq + 1, NULL, 0);
+
+    if (len == 7 && strncmp(arg, "XTARGET", len) == 0) {
+        *xtarget = (int32_t)value;
+        *has_xtarget = true;
+        return true;
+    }
+    if (len == 3 && strncmp(arg, "TOL", len) == 0) {
+        *tol = (double)value;
+        return true;
+    }
+    for (size_t i = 0; i < REG_COUNT; i++) {
+        if (strlen(regs[i].name) == len && strncmp(arg, regs[i].name, len) == 0) {
+            regs[i].value = (int32_t)value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Time of the first sample from which the position stays on 'target'
+static double settle_time(const double *t_ms, const int32_t *x, size_t n, int32_t target) {
+    double settle = -1.0;
+    for (size_t i = 0; i < n; i++) {
+        if (x[i] != target) {
+            settle = -1.0;
+        } else if (settle < 0) {
+            settle = t_ms[i];
+        }
+    }
+    return settle;
+}
+
+int main(int argc, char **argv) {
+    int32_t xtarget = 0;
+    bool has_xtarget = false;
+    double tol = -1.0;
+    bool has_v;
+    size_t n;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <trace.csv> [REG=value ...] [XTARGET=x] [TOL=usteps]\n", argv[0]);
+        return 2;
+    }
+    for (int i = 2; i < argc; i++) {
+        if (!parse_arg(argv[i], &xtarget, &has_xtarget, &tol)) {
+            fprintf(stderr, "unknown argument '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    struct sample *trace = read_trace(argv[1], &n, &has_v);
+    if (!has_xtarget) {
+        xtarget = trace[n - 1].xactual;
+    }
+
+    // Start from the last sample before the trigger (or the first one)
+    size_t first = 0;
+    for (size_t i = 0; i < n && trace[i].t_ms <= 0.0; i++) {
+        first = i;
+    }
+    int32_t distance = abs(xtarget - trace[first].xactual);
+    if (tol < 0) {
+        tol = fmax(10.0, 0.01 * distance);
+    }
+
+    struct tmc5160_model m;
+    tmc5160_model_reset(&m);
+    for (size_t i = 0; i < REG_COUNT; i++) {
+        tmc5160_model_write(&m, regs[i].address, (uint32_t)regs[i].value);
+    }
+    tmc5160_model_write(&m, TMC5160_XACTUAL, (uint32_t)trace[first].xactual);
+    tmc5160_model_write(&m, TMC5160_XTARGET, (uint32_t)trace[first].xactual);
+
+    double *t_ms = malloc(n * sizeof(double));
+    int32_t *x_trace = malloc(n * sizeof(int32_t));
+    int32_t *x_model = malloc(n * sizeof(int32_t));
+    double now_ms = trace[first].t_ms;
+    bool started = false;
+    double max_dx = 0, sum_dx2 = 0, max_dv = 0;
+    size_t m_count = 0;
+
+    for (size_t i = first; i < n; i++) {
+        if (!started && trace[i].t_ms >= 0.0) {
+            if (now_ms < 0.0) {
+                tmc5160_model_step(&m, (uint32_t)(-now_ms * TMC5160_MODEL_FCLK / 1000.0));
+                now_ms = 0.0;
+            }
+            tmc5160_model_write(&m, TMC5160_XTARGET, (uint32_t)xtarget);
+            started = true;
+        }
+        if (trace[i].t_ms > now_ms) {
+            tmc5160_model_step(&m, (uint32_t)((trace[i].t_ms - now_ms) * TMC5160_MODEL_FCLK / 1000.0));
+            now_ms = trace[i].t_ms;
+        }
+
+        double dx = fabs((double)m.xactual - trace[i].xactual);
+        double dv = fabs((double)tmc5160_model_vactual(&m) - trace[i].vactual);
+        max_dx = fmax(max_dx, dx);
+        sum_dx2 += dx * dx;
+        if (has_v) {
+            max_dv = fmax(max_dv, dv);
+        }
+
+        t_ms[m_count] = trace[i].t_ms;
+        x_trace[m_count] = trace[i].xactual;
+        x_model[m_count] = m.xactual;
+        m_count++;
+    }
+
+    printf("samples            : %zu (move of %d usteps to %d)\n", m_count, distance, xtarget);
+    printf("position error     : max %.0f, rms %.1f usteps (tolerance %.0f)\n",
+           max_dx, sqrt(sum_dx2 / (double)m_count), tol);
+    if (has_v) {
+        printf("velocity error     : max %.0f (VACTUAL units)\n", max_dv);
+    }
+    printf("settle time        : trace %.1f ms, model %.1f ms\n",
+           settle_time(t_ms, x_trace, m_count, xtarget), settle_time(t_ms, x_model, m_count, xtarget));
+
+    free(t_ms);
+    free(x_trace);
+    free(x_model);
+    free(trace);
+    return (max_dx > tol) ? 1 : 0;
+}
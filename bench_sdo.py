@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+SDO throughput benchmark for the TMC5160 CANopen slave.
+
+Measures effective payload throughput of expedited, segmented and block SDO
+transfers against the streaming test domain 0x2102 (see
+Core/Src/Peripheral/Inc/sdo_test.h). Works on a real bus (can0) as well as on
+a virtual one (vcan0) with the host build of the firmware.
+"""
+
+import argparse
+import statistics
+import time
+
+import canopen
+
+NODE_ID = 2
+EDS_FILE = 'slave.dcf'
+INTERFACE = 'socketcan'
+CHANNEL = 'can0'
+
+SDO_TEST_DOMAIN = 0x2102
+SDO_TEST_CONFIG = 0x2103
+EXPEDITED_OBJECT = 0x6081  # Profile velocity, UNSIGNED32 RW
+
+
+def sdo_test_pattern(size):
+    """Pattern produced and checked by the firmware on 0x2102."""
+    return bytes((i * 7 + (i >> 8)) & 0xFF for i in range(size))
+
+
+def run(name, size, repeat, transfer):
+    """Runs 'transfer' 'repeat' times and prints the payload throughput."""
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        transfer()
+        times.append(time.perf_counter() - start)
+    best = min(times)
+    median = statistics.median(times)
+    print(f"{name:<22} {size:>8} B  best {best * 1000:8.1f} ms  "
+          f"median {median * 1000:8.1f} ms  {size / best / 1024:8.2f} KiB/s")
+
+
+def bench_expedited(node, count, repeat):
+    value = node.sdo.upload(EXPEDITED_OBJECT, 0)
+
+    def upload():
+        for _ in range(count):
+            node.sdo.upload(EXPEDITED_OBJECT, 0)
+
+    def download():
+        for _ in range(count):
+            node.sdo.download(EXPEDITED_OBJECT, 0, value)
+
+    run(f"expedited upload x{count}", 4 * count, repeat, upload)
+    run(f"expedited download x{count}", 4 * count, repeat, download)
+
+
+def bench_domain(node, size, repeat):
+    expected = sdo_test_pattern(size)
+    node.sdo[SDO_TEST_CONFIG][1].raw = size
+
+    def check_upload(data):
+        if data != expected:
+            raise RuntimeError(f"upload mismatch ({len(data)} of {size} bytes)")
+
+    def check_download():
+        received = node.sdo[SDO_TEST_CONFIG][2].raw
+        errors = node.sdo[SDO_TEST_CONFIG][3].raw
+        if received != size or errors:
+            raise RuntimeError(f"download received {received} bytes, {errors} errors")
+
+    def segmented_upload():
+        check_upload(node.sdo.upload(SDO_TEST_DOMAIN, 0))
+
+    def segmented_download():
+        node.sdo.download(SDO_TEST_DOMAIN, 0, expected, force_segment=True)
+
+    def block_upload():
+        with node.sdo.open(SDO_TEST_DOMAIN, 0, 'rb', block_transfer=True,
+                           request_crc_support=True) as f:
+            check_upload(f.read())
+
+    def block_download():
+        with node.sdo.open(SDO_TEST_DOMAIN, 0, 'wb', size=size, block_transfer=True,
+                           request_crc_support=True) as f:
+            f.write(expected)
+
+    run("segmented upload", size, repeat, segmented_upload)
+    run("segmented download", size, repeat, segmented_download)
+    check_download()
+    run("block upload", size, repeat, block_upload)
+    run("block download", size, repeat, block_download)
+    check_download()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--interface', default=INTERFACE, help="python-can interface (default: socketcan)")
+    parser.add_argument('--channel', default=CHANNEL, help="CAN channel, e.g. can0 or vcan0")
+    parser.add_argument('--node', type=int, default=NODE_ID, help="slave node-ID")
+    parser.add_argument('--size', type=int, default=16384, help="domain transfer size in bytes")
+    parser.add_argument('--count', type=int, default=100, help="expedited transfers per run")
+    parser.add_argument('--repeat', type=int, default=5, help="runs per measurement")
+    args = parser.parse_args()
+
+    network = canopen.Network()
+    network.connect(bustype=args.interface, channel=args.channel)
+    try:
+        node = network.add_node(args.node, EDS_FILE)
+        print(f"SDO benchmark, node {args.node} on {args.interface}/{args.channel}\n")
+        bench_expedited(node, args.count, args.repeat)
+        bench_domain(node, args.size, args.repeat)
+    finally:
+        network.disconnect()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,174 @@
+"""
+Statusword events from TPDOs, shared by the master scripts.
+
+The node sends its statusword on TPDO1 whenever it changes and on TPDO2
+(with the actual position) every 100 ms. StatuswordMonitor keeps the
+statuswords received since the last command per node, so callers can block
+on any bit pattern across many nodes without polling over SDO.
+
+    monitor = StatuswordMonitor()
+    monitor.attach(node)               # after node.pdo.read(...)
+    monitor.mark_command([node.id])    # just before the move command
+    ... send the command ...
+    result = monitor.wait(SW_TARGET_REACHED, edge=True, timeout=10)
+"""
+
+import collections
+import threading
+import time
+
+HISTORY_LENGTH = 256  # Statuswords kept per node since the last command
+
+# CiA 402 statusword
+SW_FAULT = (1 << 3)
+SW_QUICK_STOP = (1 << 5)        # 0 while a quick stop is active
+SW_TARGET_REACHED = (1 << 10)
+SW_SETPOINT_ACK = (1 << 12)     # PP mode; 'homing attained' in homing mode
+SW_STATE_MASK = 0x6F
+SW_STATE_SWITCH_ON_DISABLED = 0x40
+SW_STATE_READY_TO_SWITCH_ON = 0x21
+SW_STATE_SWITCHED_ON = 0x23
+SW_STATE_OPERATION_ENABLED = 0x27
+SW_STATE_QUICK_STOP_ACTIVE = 0x07
+SW_STATE_FAULT_REACTION_ACTIVE = 0x0F
+SW_STATE_FAULT = 0x08
+
+# CiA 402 controlword
+CW_SHUTDOWN = 0x06
+CW_QUICK_STOP = 0x02
+CW_SWITCH_ON = 0x07
+CW_ENABLE_OPERATION = 0x0F
+CW_FAULT_RESET = 0x80
+CW_NEW_SETPOINT = (1 << 4)
+CW_CHANGE_IMMEDIATELY = (1 << 5)  # PP mode: abort the current set-point
+CW_HALT = (1 << 8)                # Stop with the halt option code (0x605D), resume when cleared
+CW_CHANGE_ON_SETPOINT = (1 << 9)  # PP mode: do not stop at the previous target (blend)
+
+# Enable sequence: (name, controlword, statusword state confirming it)
+ENABLE_SEQUENCE = [
+    ('Shutdown', CW_SHUTDOWN, SW_STATE_READY_TO_SWITCH_ON),
+    ('Switch on', CW_SWITCH_ON, SW_STATE_SWITCHED_ON),
+    ('Enable operation', CW_ENABLE_OPERATION, SW_STATE_OPERATION_ENABLED),
+]
+
+
+class WaitResult(dict):
+    """Maps node id -> latency in seconds from the command to the matching
+    statusword, or None for the nodes that timed out."""
+
+    @property
+    def ok(self):
+        return all(latency is not None for latency in self.values())
+
+    @property
+    def timed_out(self):
+        return [node_id for node_id, latency in self.items() if latency is None]
+
+    @property
+    def max_latency(self):
+        latencies = [latency for latency in self.values() if latency is not None]
+        return max(latencies) if latencies else None
+
+
+class StatuswordMonitor:
+    """Tracks the statusword of any number of nodes from their TPDOs."""
+
+    def __init__(self):
+        self._cond = threading.Condition()
+        self._statusword = {}  # node id -> latest statusword
+        self._position = {}    # node id -> latest actual position (TPDO2)
+        self._history = {}     # node id -> deque of (time, statusword) since the mark
+        self._marked = {}      # node id -> time of the last mark_command()
+
+    def attach(self, node, statusword_tpdos=(1, 2), position_tpdo=2, key=None):
+        """Subscribe to the statusword TPDOs of 'node'. The PDO maps must
+        have been read (node.pdo.read() or read(from_od=True)) first.
+        'key' names the statuswords in this monitor instead of node.id, e.g.
+        (node.id, axis) for the TPDOs of the other axes of a multi-axis node."""
+        key = node.id if key is None else key
+        with self._cond:
+            self._history.setdefault(key, collections.deque(maxlen=HISTORY_LENGTH))
+            self._marked.setdefault(key, time.time())
+
+        for n in statusword_tpdos:
+            with_position = (n == position_tpdo)
+            node.tpdo[n].add_callback(
+                lambda pdo, node_id=key, pos=with_position: self._on_tpdo(node_id, pdo, pos))
+
+    def _on_tpdo(self, node_id, pdo, with_position):
+        data = pdo.data
+        stamp = getattr(pdo, 'timestamp', None) or time.time()
+        statusword = int.from_bytes(data[0:2], byteorder='little')
+
+        with self._cond:
+            self._statusword[node_id] = statusword
+            if with_position and len(data) >= 6:
+                self._position[node_id] = int.from_bytes(data[2:6], byteorder='little', signed=True)
+            self._history[node_id].append((stamp, statusword))
+            self._cond.notify_all()
+
+    def statusword(self, node_id):
+        """Latest statusword of 'node_id', or None before the first TPDO."""
+        with self._cond:
+            return self._statusword.get(node_id)
+
+    def position(self, node_id):
+        """Latest actual position of 'node_id' from TPDO2, or None."""
+        with self._cond:
+            return self._position.get(node_id)
+
+    def mark_command(self, node_ids=None):
+        """Start the latency clock of 'node_ids' (default: all nodes) and drop
+        their history. Call it right before sending the command."""
+        now = time.time()
+        with self._cond:
+            for node_id in (self._history if node_ids is None else node_ids):
+                self._marked[node_id] = now
+                self._history[node_id].clear()
+
+    def _match_time(self, node_id, mask, value, edge):
+        """Time at which the condition became true for 'node_id', or None."""
+        matched = None
+        seen_other = not edge
+
+        for stamp, statusword in self._history[node_id]:
+            if (statusword & mask) == value:
+                if seen_other and matched is None:
+                    matched = stamp
+            else:
+                seen_other = True
+                matched = None
+
+        if matched is None and not edge:
+            # Nothing received since the mark: judge the last known value
+            statusword = self._statusword.get(node_id)
+            if not self._history[node_id] and statusword is not None and (statusword & mask) == value:
+                matched = self._marked[node_id]
+        return matched
+
+    def wait(self, mask, value=None, node_ids=None, timeout=10.0, edge=False):
+        """Block until (statusword & mask) == value on every node in
+        'node_ids' (default: all attached nodes), or 'timeout' seconds pass.
+
+        'value' defaults to 'mask' (all bits set). With edge=True a node only
+        counts once it has reported a statusword that does not match since
+        mark_command(), i.e. the command must have cleared and then
+        re-established the condition (use it for 'target reached').
+
+        Returns a WaitResult with the latency from mark_command() per node.
+        """
+        if value is None:
+            value = mask
+        deadline = time.monotonic() + timeout
+
+        with self._cond:
+            nodes = list(self._history if node_ids is None else node_ids)
+            while True:
+                matched = {n: self._match_time(n, mask, value, edge) for n in nodes}
+                remaining = deadline - time.monotonic()
+                if all(t is not None for t in matched.values()) or remaining <= 0:
+                    break
+                self._cond.wait(remaining)
+
+            return WaitResult(
+                (n, None if t is None else max(0.0, t - self._marked[n])) for n, t in matched.items())
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+Multi-node master for a line of TMC5160 drives.
+
+Manages N nodes from one process: boots and configures them in parallel,
+runs the CiA 402 enable sequence on all of them at once (every transition
+is confirmed by the TPDO1 statusword events, no fixed sleeps) and starts
+coordinated moves with a single SYNC. RPDO3 is synchronous here, so each
+node latches its new set-point on the same SYNC frame.
+
+Usage: python3 line_master.py --nodes 2-17 [--channel can0] [--distance 50000]
+"""
+
+import argparse
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import canopen
+
+from drive_events import (StatuswordMonitor, ENABLE_SEQUENCE, SW_STATE_MASK, SW_FAULT,
+                          SW_TARGET_REACHED, CW_FAULT_RESET, CW_ENABLE_OPERATION, CW_NEW_SETPOINT)
+from script_master import build_concise_dcf, PDO_OVERRIDES
+
+EDS_FILE = 'slave.dcf'
+INTERFACE = 'socketcan'
+CHANNEL = 'can0'
+
+BOOTUP_TIMEOUT = 5.0
+STATE_TIMEOUT = 1.0    # Per state transition, for all nodes together
+MOVE_TIMEOUT = 30.0
+
+# RPDO3 (controlword + target position) is latched on the next SYNC
+LINE_PDO_OVERRIDES = dict(PDO_OVERRIDES)
+LINE_PDO_OVERRIDES[(0x1402, 2)] = 0  # Synchronous (acyclic)
+
+
+def parse_nodes(text):
+    """'2-5,8' -> [2, 3, 4, 5, 8]"""
+    nodes = []
+    for part in text.split(','):
+        lo, _, hi = part.partition('-')
+        nodes.extend(range(int(lo), int(hi or lo) + 1))
+    return nodes
+
+
+def report(title, result, elapsed):
+    """Print per-node latencies of a WaitResult and the aggregate."""
+    print(f"{title}: {elapsed * 1000:.1f} ms for {len(result)} node(s)")
+    for node_id, latency in sorted(result.items()):
+        text = 'TIMEOUT' if latency is None else f"{latency * 1000:8.1f} ms"
+        print(f"    node {node_id:3d}: {text}")
+    if result.ok and result:
+        latencies = list(result.values())
+        print(f"    min {min(latencies) * 1000:.1f} ms, max {max(latencies) * 1000:.1f} ms, "
+              f"spread {(max(latencies) - min(latencies)) * 1000:.1f} ms")
+
+
+class LineController:
+    """Drives any number of nodes concurrently on one network."""
+
+    def __init__(self, network, node_ids, eds=EDS_FILE):
+        self.network = network
+        self.nodes = {node_id: network.add_node(node_id, eds) for node_id in node_ids}
+        self.events = StatuswordMonitor()
+
+    def boot(self):
+        """Reset all nodes with one NMT broadcast and wait for every boot-up.
+        The boot-up listeners are in place before the reset, so none is lost."""
+        booted = {node_id: False for node_id in self.nodes}
+        start = time.time()
+        latency = {}
+
+        def on_bootup(can_id, data, timestamp):
+            if data[:1] == b'\x00':
+                node_id = can_id - 0x700
+                booted[node_id] = True
+                latency.setdefault(node_id, time.time() - start)
+
+        for node_id in self.nodes:
+            self.network.subscribe(0x700 + node_id, on_bootup)
+        try:
+            self.network.nmt.send_command(0x81)  # Reset node, all nodes
+            deadline = time.monotonic() + BOOTUP_TIMEOUT
+            while not all(booted.values()) and time.monotonic() < deadline:
+                time.sleep(0.01)
+        finally:
+            for node_id in self.nodes:
+                self.network.unsubscribe(0x700 + node_id, on_bootup)
+
+        missing = [node_id for node_id, ok in booted.items() if not ok]
+        if missing:
+            raise RuntimeError(f"no boot-up from node(s) {missing}")
+        return latency
+
+    def configure(self):
+        """Download the PDO configuration to all nodes in parallel (one concise
+        DCF per node) and start them."""
+        def configure_node(node):
+            blob = build_concise_dcf(node.object_dictionary, LINE_PDO_OVERRIDES)
+            with node.sdo.open(0x2104, 0, 'wb', size=len(blob), block_transfer=True) as f:
+                f.write(blob)
+            node.pdo.read(from_od=True)
+            self.events.attach(node)
+
+        with ThreadPoolExecutor(max_workers=len(self.nodes)) as pool:
+            list(pool.map(configure_node, self.nodes.values()))
+
+        self.network.nmt.send_command(0x01)  # Start remote node, all nodes
+
+    def _send_controlword(self, node_ids, controlword):
+        for node_id in node_ids:
+            rpdo = self.nodes[node_id].rpdo[1]
+            rpdo['Control word'].raw = controlword
+            rpdo.transmit()
+
+    def enable(self):
+        """Run the enable sequence on all nodes at once. Each step is sent to
+        every node and then confirmed from the TPDO1 statusword events."""
+        node_ids = list(self.nodes)
+        steps = []
+
+        faulted = [n for n in node_ids if (self.events.statusword(n) or 0) & SW_FAULT]
+        if faulted:
+            self.events.mark_command(faulted)
+            self._send_controlword(faulted, CW_FAULT_RESET)
+            self.events.wait(SW_FAULT, 0, faulted, STATE_TIMEOUT)
+
+        for name, controlword, state in ENABLE_SEQUENCE:
+            start = time.time()
+            self.events.mark_command(node_ids)
+            self._send_controlword(node_ids, controlword)
+            result = self.events.wait(SW_STATE_MASK, state, node_ids, STATE_TIMEOUT)
+            steps.append((name, result, time.time() - start))
+            if not result.ok:
+                raise RuntimeError(f"{name}: no confirmation from node(s) {result.timed_out}")
+        return steps
+
+    def disable(self):
+        self.events.mark_command()
+        self._send_controlword(self.nodes, ENABLE_SEQUENCE[0][1])
+        return self.events.wait(SW_STATE_MASK, ENABLE_SEQUENCE[0][2], timeout=STATE_TIMEOUT)
+
+    def move(self, targets, timeout=MOVE_TIMEOUT):
+        """Move every node in 'targets' ({node_id: position}) and start them all
+        on the same SYNC. Returns the WaitResult of 'target reached', timed
+        from that SYNC."""
+        # 1. Set-points with bit 4 clear, latched by the first SYNC
+        for node_id, position in targets.items():
+            rpdo = self.nodes[node_id].rpdo[3]
+            rpdo['Profile target position'].raw = position
+            rpdo['Control word'].raw = CW_ENABLE_OPERATION
+            rpdo.transmit()
+        self.network.sync.transmit()
+
+        # 2. Rising edge of bit 4 on all nodes, executed on the second SYNC
+        for node_id in targets:
+            rpdo = self.nodes[node_id].rpdo[3]
+            rpdo['Control word'].raw = CW_ENABLE_OPERATION | CW_NEW_SETPOINT
+            rpdo.transmit()
+        self.events.mark_command(list(targets))
+        self.network.sync.transmit()
+
+        return self.events.wait(SW_TARGET_REACHED, node_ids=list(targets), timeout=timeout, edge=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--nodes', type=parse_nodes, default=[2], help="node ids, e.g. 2-17 or 2,4,6")
+    parser.add_argument('--channel', default=CHANNEL)
+    parser.add_argument('--distance', type=int, default=50000, help="move out and back by this many steps")
+    args = parser.parse_args()
+
+    network = canopen.Network()
+    network.connect(bustype=INTERFACE, channel=args.channel)
+    line = LineController(network, args.nodes)
+
+    try:
+        start = time.time()
+        boot = line.boot()
+        print(f"Boot-up: {len(boot)} node(s) in {(time.time() - start) * 1000:.1f} ms")
+
+        start = time.time()
+        line.configure()
+        print(f"PDO configuration: {(time.time() - start) * 1000:.1f} ms")
+
+        start = time.time()
+        for name, result, elapsed in line.enable():
+            report(name, result, elapsed)
+        print(f"Enable, total: {(time.time() - start) * 1000:.1f} ms")
+
+        for target in (args.distance, 0):
+            start = time.time()
+            result = line.move({node_id: target for node_id in args.nodes})
+            report(f"Move to {target}", result, time.time() - start)
+    finally:
+        try:
+            line.disable()
+        except Exception:
+            pass
+        network.disconnect()
+
+
+if __name__ == '__main__':
+    main()
@@ -8,8 +8,16 @@ import canopen
 import time
 import cmd
 import sys
+import struct
+import csv
 from colorama import init, Fore, Style
 
+from drive_events import (StatuswordMonitor, ENABLE_SEQUENCE, SW_STATE_MASK, SW_STATE_READY_TO_SWITCH_ON,
+                          SW_STATE_SWITCH_ON_DISABLED, SW_STATE_QUICK_STOP_ACTIVE, SW_STATE_OPERATION_ENABLED,
+                          SW_FAULT,
+                          SW_SETPOINT_ACK, CW_SHUTDOWN, CW_QUICK_STOP, CW_FAULT_RESET, CW_ENABLE_OPERATION,
+                          CW_NEW_SETPOINT, CW_CHANGE_IMMEDIATELY, CW_HALT, CW_CHANGE_ON_SETPOINT)
+
 # Initialize colorama for cross-platform colored output
 init(autoreset=True)
 
@@ -22,6 +30,132 @@ CHANNEL = 'can0'
 # Bitmask for Statusword
 SW_TARGET_REACHED = (1 << 10)
 SW_HOMING_ATTAINED = (1 << 12)
+SW_HOMING_ERROR = (1 << 13)
+
+# Touch probe function (0x60B8), bits of probe 1; probe 2 is shifted by 8
+TP_ENABLE = (1 << 0)
+TP_CONTINUOUS = (1 << 1)
+TP_POSITIVE_EDGE = (1 << 4)
+TP_NEGATIVE_EDGE = (1 << 5)
+# Touch probe status (0x60B9): value stored, per edge (probe 2 shifted by 8)
+TP_POSITIVE_STORED = (1 << 1)
+TP_NEGATIVE_STORED = (1 << 2)
+TP_POSITIVE_TOGGLE = (1 << 6)  # Continuous mode: toggles with every new value
+
+# Homing methods (0x6098) by name
+HOMING_METHODS = {'stall-': -1, 'stall+': -2, 'switch-': 17, 'switch+': 18, 'here': 35}
+HANDSHAKE_TIMEOUT = 1.0  # Per controlword step, until the statusword confirms it
+MOVE_TIMEOUT = 30.0      # A full set-point buffer frees a slot when a move ends
+
+# Motion recorder (scope) objects, see Core/Src/Peripheral/Inc/scope.h
+SCOPE_CONFIG = 0x2100
+SCOPE_CAPTURE = 0x2101
+SCOPE_CHANNELS = ['time_us', 'xactual', 'vactual', 'ramp_stat', 'sg_result', 'cs_actual', 'statusword']
+SCOPE_STATES = {0: 'IDLE', 1: 'ARMED', 2: 'TRIGGERED', 3: 'DONE'}
+SCOPE_HEADER = struct.Struct('<BBHHHI')
+
+# Store / restore parameters (CiA 301 0x1010 / 0x1011)
+PARAM_GROUPS = {'all': 1, 'comm': 2, 'app': 3, 'mfr': 4}
+SIGNATURE_SAVE = 0x65766173  # "save"
+SIGNATURE_LOAD = 0x64616F6C  # "load"
+STORE_TIMEOUT = 3.0          # A store that compacts the log erases a flash sector (~1 s)
+
+# Boot phase durations in microseconds (see Core/Src/Peripheral/Inc/boot_time.h)
+BOOT_TIME = 0x2105
+BOOT_PHASES = ['Clock setup', 'Peripherals', 'Object dictionary', 'Parameter restore',
+               'NMT start', 'Boot-up message', 'Drive configuration']
+
+# Cyclic Synchronous Velocity: SYNC reception to the last TMC5160 write, in us
+SYNC_LATENCY = 0x2106
+
+# Motion tick: period (us), worst command latency (us), longest tick (us), commands executed
+MOTION_TICK = 0x2107
+
+# Heartbeat consumer (0x1016: node-ID << 16 | time in ms) and the reaction to a
+# loss: last and worst reaction time (us), losses, node of the last loss
+CONSUMER_HEARTBEAT = 0x1016
+HEARTBEAT_LOSS = 0x2108
+ABORT_OPTIONS = {0: 'no action', 1: 'fault', 2: 'disable voltage', 3: 'quick stop'}
+
+# Emergency: error register, error history (newest first), inhibit time in
+# 100 us, error code of an axis; the codes of the TMC5160 faults (drive_fault.c)
+ERROR_REGISTER = 0x1001
+ERROR_HISTORY = 0x1003
+EMCY_INHIBIT = 0x1015
+EMCY_CODES = {
+    0x2330: 'short to ground', 0x2340: 'short to supply', 0x3120: 'charge pump undervoltage',
+    0x4300: 'overtemperature pre-warning', 0x4310: 'overtemperature', 0x5400: 'power stage error',
+    0x7120: 'open load', 0x8130: 'heartbeat lost', 0x8611: 'following error',
+}
+
+# Electronic gearing (manufacturer mode -1): the demand position is
+# offset + ratio x master position, the ratio in 1/65536
+MODE_ELECTRONIC_GEARING = -1
+GEAR_RATIO_ONE = 65536
+
+# Concise DCF download (see Core/Src/Peripheral/Inc/concise_dcf.h)
+CONCISE_DCF = 0x2104
+PDO_COMM_RANGES = [(0x1400, 0x1600), (0x1800, 0x1A00)]
+PDO_MAP_RANGES = [(0x1600, 0x1800), (0x1A00, 0x1C00)]
+
+# Axes of the node: axis n has its objects at 0x6000/0x2000 + (n - 1) * 0x800,
+# named "<name> axis n", and the PDOs 4 * (n - 1) + 1..4
+AXIS_COUNT = 4
+AXIS_PDO_COUNT = 4
+
+# Values that differ from slave.dcf, as {(index, subindex): value}
+PDO_OVERRIDES = {
+    (0x1800 + AXIS_PDO_COUNT * axis + pdo, 2): 254  # TPDO1..4 of every axis event-driven
+    for axis in range(AXIS_COUNT) for pdo in range(AXIS_PDO_COUNT)
+}
+
+def build_concise_dcf(od, overrides=None):
+    """Build a concise DCF blob that configures all PDOs of 'od' in one write.
+
+    Values come from the DCF (ParameterValue, else DefaultValue, with $NODEID
+    resolved); 'overrides' replaces single values and may also name objects
+    outside the PDO range, which are appended at the end. Each PDO is disabled
+    before its parameters and mapping are written and enabled again last.
+    """
+    overrides = dict(overrides or {})
+    entries = []
+
+    def value(var):
+        key = (var.index, var.subindex)
+        if key in overrides:
+            return overrides.pop(key)
+        return var.value if var.value is not None else var.default
+
+    def add(var, val):
+        data = var.encode_raw(val)
+        entries.append(struct.pack('<HBI', var.index, var.subindex, len(data)) + data)
+
+    def objects(ranges):
+        return [od[i] for lo, hi in ranges for i in range(lo, hi) if i in od]
+
+    comms = objects(PDO_COMM_RANGES)
+    cob_ids = {comm.index: value(comm[1]) for comm in comms}
+
+    for comm in comms:
+        add(comm[1], cob_ids[comm.index] | 0x80000000)
+    for comm in comms:
+        for subindex in comm:
+            if subindex > 1 and comm[subindex].writable:
+                add(comm[subindex], value(comm[subindex]))
+    for mapping in objects(PDO_MAP_RANGES):
+        count = value(mapping[0])
+        add(mapping[0], 0)
+        for subindex in range(1, count + 1):
+            add(mapping[subindex], value(mapping[subindex]))
+        add(mapping[0], count)
+    for comm in comms:
+        add(comm[1], cob_ids[comm.index])
+
+    for (index, subindex), val in overrides.items():
+        obj = od[index]
+        add(obj if isinstance(obj, canopen.objectdictionary.ODVariable) else obj[subindex], val)
+
+    return struct.pack('<I', len(entries)) + b''.join(entries)
 
 class CANopenCLI(cmd.Cmd):
     """Interactive CLI for TMC5160 motor control via CANopen"""
@@ -43,6 +177,7 @@ class CANopenCLI(cmd.Cmd):
         self.is_enabled = False
         self.current_mode = None
         self.use_pdo = False  # Toggle between SDO and PDO
+        self.axis = 1         # Axis the motion commands act on
         
     # ==================== SETUP & CONNECTION ====================
     
@@ -108,52 +243,128 @@ class CANopenCLI(cmd.Cmd):
             print(f"{Fore.RED}Disconnect error: {e}{Style.RESET_ALL}")
     
     def _configure_pdos(self):
-        """Internal PDO configuration"""
-        # Disable PDO for configuration
-        for i in range(1, 4):
-            cob_id = self.node.sdo[0x1400 + i - 1][1].raw
-            self.node.sdo[0x1400 + i - 1][1].raw = cob_id | 0x80000000
-        
-        for i in range(1, 3):
-            cob_id = self.node.sdo[0x1800 + i - 1][1].raw
-            self.node.sdo[0x1800 + i - 1][1].raw = cob_id | 0x80000000
-        
-        # Set transmission type to event-driven
-        self.node.sdo[0x1800][2].raw = 254
-        self.node.sdo[0x1801][2].raw = 254
-        
-        # Re-enable
-        for i in range(1, 4):
-            cob_id = self.node.sdo[0x1400 + i - 1][1].raw
-            self.node.sdo[0x1400 + i - 1][1].raw = cob_id & 0x7FFFFFFF
-        
-        for i in range(1, 3):
-            cob_id = self.node.sdo[0x1800 + i - 1][1].raw
-            self.node.sdo[0x1800 + i - 1][1].raw = cob_id & 0x7FFFFFFF
-        
-        self.node.pdo.read()
+        """Internal PDO configuration: one concise DCF block download to 0x2104.
+        The node applies it as a whole (or not at all), so the PDO layout equals
+        slave.dcf + PDO_OVERRIDES and does not need to be read back."""
+        blob = build_concise_dcf(self.node.object_dictionary, {**PDO_OVERRIDES, **self._axis_cob_ids()})
+        with self.node.sdo.open(CONCISE_DCF, 0, 'wb', size=len(blob), block_transfer=True) as f:
+            f.write(blob)
+        self.node.pdo.read(from_od=True)
+    
+    def _axis_cob_ids(self):
+        """COB-ID overrides that enable the PDOs of axes 2-4. slave.dcf leaves
+        them disabled: they use the COB-IDs of node ids NODE_ID + 1..3 (axis 2
+        sends TPDO1 on 0x180 + NODE_ID + 1), which must then be free. This
+        includes the synchronous TPDOs 18-20 after the four per axis."""
+        od = self.node.object_dictionary
+        return {(index, 1): od[index][1].default & 0x7FFFFFFF
+                for lo, hi in PDO_COMM_RANGES
+                for index in range(lo + AXIS_PDO_COUNT, hi)
+                if index in od and od[index][1].default & 0x80000000}
     
     def _setup_pdo_callbacks(self):
-        """Setup callbacks for TPDO monitoring (silent mode)"""
-        # These callbacks don't print to avoid cluttering CLI
-        # But can be accessed for monitoring
-        self.last_statusword = None
-        self.last_position = None
-        
-        def on_tpdo1(message):
-            self.last_statusword = int.from_bytes(message.data[0:2], byteorder='little')
-        
-        def on_tpdo2(message):
-            self.last_statusword = int.from_bytes(message.data[0:2], byteorder='little')
-            self.last_position = int.from_bytes(message.data[2:6], byteorder='little', signed=True)
-        
-        self.node.tpdo[1].add_callback(on_tpdo1)
-        self.node.tpdo[2].add_callback(on_tpdo2)
+        """Setup TPDO monitoring (silent mode): statusword on TPDO1/TPDO2,
+        actual position on TPDO2 of each axis, kept by self.events for the
+        wait commands"""
+        self.events = StatuswordMonitor()
+        self._probe_status = {}
+        for axis in range(1, AXIS_COUNT + 1):
+            base = AXIS_PDO_COUNT * (axis - 1)
+            self.events.attach(self.node, (base + 1, base + 2), base + 2, key=self._axis_key(axis))
+            self._probe_status[axis] = 0
+            self.node.tpdo[base + 3].add_callback(lambda pdo, axis=axis: self._on_touch_probe(axis, pdo))
+        self.node.emcy.add_callback(self._on_emcy)
+    
+    def _on_emcy(self, error):
+        """EMCY: print every error as it occurs; the first byte of the
+        manufacturer field is the axis, the next four its DRV_STATUS"""
+        if error.code == 0:
+            print(f"\n{Fore.GREEN}EMCY: error reset (error register 0x{error.register:02X}){Style.RESET_ALL}")
+            return
+        text = EMCY_CODES.get(error.code, 'error')
+        axis = f"axis {error.data[0]} " if error.data and 1 <= error.data[0] <= AXIS_COUNT else ""
+        print(f"\n{Fore.RED}EMCY: {axis}0x{error.code:04X} {text}"
+              f" (error register 0x{error.register:02X}){Style.RESET_ALL}")
+    
+    def _on_touch_probe(self, axis, pdo):
+        """TPDO3 (touch probe status + probe 1 positive edge): print every
+        new latched position. TPDO4 carries the other edges, read by 'probe'."""
+        status = int.from_bytes(pdo.data[0:2], byteorder='little')
+        changed = status ^ self._probe_status[axis]
+        self._probe_status[axis] = status
+        if changed & (TP_POSITIVE_STORED | TP_POSITIVE_TOGGLE) and status & TP_POSITIVE_STORED:
+            position = int.from_bytes(pdo.data[2:6], byteorder='little', signed=True)
+            print(f"\n{Fore.MAGENTA}Axis {axis} touch probe 1 (REFL) rising edge at {position}{Style.RESET_ALL}")
+    
+    # ==================== AXIS SELECTION ====================
+    
+    @staticmethod
+    def _axis_key(axis):
+        """Key of an axis in self.events: the node id for axis 1, as for a
+        single-axis node, else (node id, axis)"""
+        return NODE_ID if axis == 1 else (NODE_ID, axis)
+    
+    @property
+    def _key(self):
+        return self._axis_key(self.axis)
+    
+    def _name(self, name):
+        """Object name of the selected axis (slave.dcf suffixes " axis n")"""
+        return name if self.axis == 1 else f"{name} axis {self.axis}"
+    
+    def _sdo(self, name):
+        return self.node.sdo[self._name(name)]
+    
+    def _rpdo(self, n):
+        """RPDO n (1..3) of the selected axis"""
+        return self.node.rpdo[AXIS_PDO_COUNT * (self.axis - 1) + n]
+    
+    def do_axis(self, arg):
+        """Select the axis (TMC5160 on SPI1 chip select 1-4) the drive
+        commands act on, or show the selected one
+        Usage: axis [1-4]"""
+        if arg.strip():
+            try:
+                axis = int(arg)
+            except ValueError:
+                axis = 0
+            if not 1 <= axis <= AXIS_COUNT:
+                print(f"{Fore.RED}Axis must be 1 to {AXIS_COUNT}{Style.RESET_ALL}")
+                return
+            if axis != self.axis:
+                if self.is_enabled:
+                    print(f"{Fore.YELLOW}Axis {self.axis} stays enabled{Style.RESET_ALL}")
+                self.axis = axis
+                self.current_mode = None
+                sw = self.events.statusword(self._key) if self.is_connected else None
+                self.is_enabled = sw is not None and (sw & SW_STATE_MASK) == SW_STATE_OPERATION_ENABLED
+        print(f"Axis: {self.axis}")
     
     # ==================== STATE MACHINE ====================
     
+    def _write_controlword(self, controlword):
+        """Send a controlword on RPDO1 or over SDO"""
+        if self.use_pdo:
+            self._rpdo(1)[self._name('Control word')].raw = controlword
+            self._rpdo(1).transmit()
+        else:
+            self._sdo('Control word').raw = controlword
+    
+    def _handshake(self, send, mask, value=None, timeout=HANDSHAKE_TIMEOUT):
+        """Run 'send' and wait until the statusword confirms it
+        ((statusword & mask) == value, from the TPDOs). Returns the latency."""
+        self.events.mark_command([self._key])
+        send()
+        result = self.events.wait(mask, value, [self._key], timeout)
+        if not result.ok:
+            sw = self.events.statusword(self._key)
+            last = 'none' if sw is None else f"0x{sw:04X}"
+            raise TimeoutError(f"no confirmation within {timeout}s (statusword {last})")
+        return result[self._key]
+    
     def do_enable(self, arg):
         """Enable drive (State Machine: Shutdown -> Switch On -> Enable)
+        Each step is sent as soon as the statusword confirms the previous one.
         Usage: enable"""
         if not self._check_connected():
             return
@@ -164,32 +375,28 @@ class CANopenCLI(cmd.Cmd):
         
         try:
             print(f"{Fore.CYAN}Enabling drive...{Style.RESET_ALL}")
+            total = 0.0
             
-            if self.use_pdo:
-                # Use RPDO1
-                self.node.rpdo[1]['Control word'].raw = 0x06
-                self.node.rpdo[1].transmit()
-                time.sleep(0.3)
-                
-                self.node.rpdo[1]['Control word'].raw = 0x07
-                self.node.rpdo[1].transmit()
-                time.sleep(0.3)
-                
-                self.node.rpdo[1]['Control word'].raw = 0x0F
-                self.node.rpdo[1].transmit()
-                time.sleep(0.5)
-            else:
-                # Use SDO
-                self.node.sdo['Control word'].raw = 0x06
-                time.sleep(0.3)
-                self.node.sdo['Control word'].raw = 0x07
-                time.sleep(0.3)
-                self.node.sdo['Control word'].raw = 0x0F
-                time.sleep(0.5)
+            sw = self.events.statusword(self._key) or 0
+            if sw & SW_FAULT:
+                total += self._fault_reset()
+                print(f"  {'Fault reset':<17} (CW 0x{CW_FAULT_RESET:02X}) confirmed in {total * 1000:6.1f} ms")
+            elif (sw & SW_STATE_MASK) == SW_STATE_QUICK_STOP_ACTIVE:
+                # Quick stop option 5/6: straight back to OPERATION ENABLED
+                total = self._handshake(lambda: self._write_controlword(CW_ENABLE_OPERATION),
+                                        SW_STATE_MASK, SW_STATE_OPERATION_ENABLED)
+                self.is_enabled = True
+                print(f"{Fore.GREEN}Drive enabled from quick stop in {total * 1000:.1f} ms{Style.RESET_ALL}")
+                return
+            
+            for name, controlword, state in ENABLE_SEQUENCE:
+                latency = self._handshake(lambda: self._write_controlword(controlword), SW_STATE_MASK, state)
+                total += latency
+                print(f"  {name:<17} (CW 0x{controlword:02X}) confirmed in {latency * 1000:6.1f} ms")
             
             self.is_enabled = True
-            sw = self.node.sdo['Status word'].raw
-            print(f"{Fore.GREEN}Drive enabled! Statusword: 0x{sw:04X}{Style.RESET_ALL}")
+            sw = self.events.statusword(self._key)
+            print(f"{Fore.GREEN}Drive enabled in {total * 1000:.1f} ms! Statusword: 0x{sw:04X}{Style.RESET_ALL}")
             
         except Exception as e:
             print(f"{Fore.RED}Enable failed: {e}{Style.RESET_ALL}")
@@ -202,14 +409,7 @@ class CANopenCLI(cmd.Cmd):
         
         try:
             print(f"{Fore.CYAN}Disabling drive...{Style.RESET_ALL}")
-            
-            if self.use_pdo:
-                self.node.rpdo[1]['Control word'].raw = 0x06
-                self.node.rpdo[1].transmit()
-            else:
-                self.node.sdo['Control word'].raw = 0x06
-            
-            time.sleep(0.3)
+            self._handshake(lambda: self._write_controlword(CW_SHUTDOWN), SW_STATE_MASK, SW_STATE_READY_TO_SWITCH_ON)
             self.is_enabled = False
             print(f"{Fore.GREEN}Drive disabled{Style.RESET_ALL}")
             
@@ -218,124 +418,395 @@ class CANopenCLI(cmd.Cmd):
     
     # ==================== HOMING ====================
     
-    def do_home(self, arg):
-        """Perform homing operation (Method 35: Current Position)
-        Usage: home"""
+    def _write_mode(self, mode, controlword):
+        """Send mode of operation and controlword on RPDO2 or over SDO"""
+        if self.use_pdo:
+            self._rpdo(2)[self._name('Control word')].raw = controlword
+            self._rpdo(2)[self._name('Modes of operation')].raw = mode
+            self._rpdo(2).transmit()
+        else:
+            self._sdo('Modes of operation').raw = mode
+            self._sdo('Control word').raw = controlword
+    
+    def _fault_reset(self):
+        """Rising edge of bit 7 until the fault bit drops. Returns the latency."""
+        self._write_controlword(0)
+        return self._handshake(lambda: self._write_controlword(CW_FAULT_RESET), SW_FAULT, 0)
+    
+    def do_halt(self, arg):
+        """Stop the current move with the halt ramp (controlword bit 8)
+        Usage: halt [off]
+        
+        'halt' stops with the halt option code (0x605D, default: quick stop
+        deceleration 0x6085) and waits until the motor stands still (bit 10).
+        'halt off' continues to the same target."""
         if not self._check_enabled():
             return
         
         try:
-            print(f"{Fore.CYAN}Starting homing operation...{Style.RESET_ALL}")
+            if arg.strip().lower() == 'off':
+                self._write_controlword(CW_ENABLE_OPERATION)
+                print(f"{Fore.GREEN}Halt released{Style.RESET_ALL}")
+                return
             
-            if self.use_pdo:
-                # Set mode to Homing (6)
-                self.node.rpdo[2]['Control word'].raw = 0x0F
-                self.node.rpdo[2]['Modes of operation'].raw = 6
-                self.node.rpdo[2].transmit()
-                time.sleep(0.2)
-                
-                # Start homing (bit 4 = 1)
-                self.node.rpdo[2]['Control word'].raw = 0x1F
-                self.node.rpdo[2]['Modes of operation'].raw = 6
-                self.node.rpdo[2].transmit()
-                time.sleep(0.5)
-            else:
-                # Use SDO
-                self.node.sdo['Modes of operation'].raw = 6
-                time.sleep(0.1)
-                self.node.sdo['Control word'].raw = 0x1F
-                time.sleep(0.5)
-            
-            # Verify
-            sw = self.node.sdo['Status word'].raw
-            homing_ok = (sw >> 12) & 1
-            target_ok = (sw >> 10) & 1
-            
-            if homing_ok and target_ok:
-                print(f"{Fore.GREEN}Homing completed successfully! Position zeroed.{Style.RESET_ALL}")
-            else:
-                print(f"{Fore.YELLOW}Homing may have failed. Statusword: 0x{sw:04X}{Style.RESET_ALL}")
+            latency = self._handshake(lambda: self._write_controlword(CW_ENABLE_OPERATION | CW_HALT),
+                                      SW_TARGET_REACHED, timeout=MOVE_TIMEOUT)
+            pos = self._sdo('Actual motor position').raw
+            print(f"{Fore.GREEN}Halted in {latency * 1000:.1f} ms at position {pos}{Style.RESET_ALL}")
             
-            # Return to Profile Position Mode
-            if self.use_pdo:
-                self.node.rpdo[2]['Control word'].raw = 0x0F
-                self.node.rpdo[2]['Modes of operation'].raw = 1
-                self.node.rpdo[2].transmit()
+        except Exception as e:
+            print(f"{Fore.RED}Halt failed: {e}{Style.RESET_ALL}")
+    
+    def do_quickstop(self, arg):
+        """Quick stop: ramp down with the quick stop option code (0x605A)
+        Usage: quickstop
+        
+        Option 1/2 (default 2: quick stop deceleration 0x6085) end in SWITCH ON
+        DISABLED; 5/6 stay in QUICK STOP ACTIVE with bit 10 set, 'enable'
+        continues from there. Option 0 switches the power stage off at once."""
+        if not self._check_enabled():
+            return
+        
+        try:
+            option = self._sdo('Quick stop option code').raw
+            if option >= 5:
+                mask, state = SW_STATE_MASK | SW_TARGET_REACHED, SW_STATE_QUICK_STOP_ACTIVE | SW_TARGET_REACHED
             else:
-                self.node.sdo['Control word'].raw = 0x0F
-                self.node.sdo['Modes of operation'].raw = 1
+                mask, state = SW_STATE_MASK, SW_STATE_SWITCH_ON_DISABLED
+            
+            latency = self._handshake(lambda: self._write_controlword(CW_QUICK_STOP), mask, state,
+                                      timeout=MOVE_TIMEOUT)
+            self.is_enabled = False
+            pos = self._sdo('Actual motor position').raw
+            print(f"{Fore.GREEN}Stopped in {latency * 1000:.1f} ms at position {pos} "
+                  f"(option {option}){Style.RESET_ALL}")
             
+        except Exception as e:
+            print(f"{Fore.RED}Quick stop failed: {e}{Style.RESET_ALL}")
+    
+    def do_faultreset(self, arg):
+        """Reset a fault (controlword bit 7), back to SWITCH ON DISABLED
+        Usage: faultreset"""
+        if not self._check_connected():
+            return
+        
+        try:
+            latency = self._fault_reset()
+            self.is_enabled = False
+            print(f"{Fore.GREEN}Fault reset in {latency * 1000:.1f} ms{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Fault reset failed: {e}{Style.RESET_ALL}")
+    
+    def do_home(self, arg):
+        """Perform homing with the method in 0x6098, or the one given
+        Usage: home [method]
+        
+        Methods: stall- / stall+ (-1/-2, hard stop found by StallGuard2),
+                 switch- / switch+ (17/18, REFL/REFR release edge),
+                 here (35, current position). Numbers are accepted too.
+        Ctrl+C interrupts a running homing (bit 4 cleared).
+        Example: home stall-"""
+        if not self._check_enabled():
+            return
+        
+        try:
+            if arg.strip():
+                name = arg.strip().lower()
+                method = HOMING_METHODS[name] if name in HOMING_METHODS else int(name)
+                self._sdo('Homing method').raw = method
+            method = self._sdo('Homing method').raw
+            print(f"{Fore.CYAN}Starting homing operation (method {method})...{Style.RESET_ALL}")
+            
+            # Mode 6 with bit 4 clear, then start homing (bit 4 = 1). Frames to
+            # one node are processed in order, so nothing has to wait in between.
+            self._write_mode(6, CW_ENABLE_OPERATION)
+            homed = SW_HOMING_ATTAINED | SW_TARGET_REACHED
+            self.events.mark_command([self._key])
+            self._write_mode(6, CW_ENABLE_OPERATION | CW_NEW_SETPOINT)
+            deadline = time.monotonic() + MOVE_TIMEOUT
+            try:
+                while True:
+                    result = self.events.wait(homed, node_ids=[self._key], timeout=0.05)
+                    if result.ok:
+                        print(f"{Fore.GREEN}Homing completed in {result[self._key] * 1000:.1f} ms, "
+                              f"position {self._sdo('Actual motor position').raw}{Style.RESET_ALL}")
+                        if method in (-1, -2):
+                            sg = self._sdo('Homing configuration')['StallGuard result'].raw
+                            print(f"  Lowest StallGuard value at search speed: {sg}")
+                        break
+                    if (self.events.statusword(self._key) or 0) & SW_HOMING_ERROR:
+                        print(f"{Fore.RED}Homing error: method {method} not supported{Style.RESET_ALL}")
+                        break
+                    if time.monotonic() > deadline:
+                        print(f"{Fore.YELLOW}Homing not completed within {MOVE_TIMEOUT}s{Style.RESET_ALL}")
+                        break
+            except KeyboardInterrupt:
+                print(f"{Fore.YELLOW}Homing interrupted{Style.RESET_ALL}")
+            
+            # Bit 4 clear (interrupts a homing still running), then back to
+            # Profile Position Mode; bit 12 becomes set-point acknowledge again
+            self._write_mode(6, CW_ENABLE_OPERATION)
+            self._handshake(lambda: self._write_mode(1, CW_ENABLE_OPERATION), SW_SETPOINT_ACK, 0)
             self.current_mode = 1
-            time.sleep(0.2)
             
+        except (KeyError, ValueError):
+            print(f"{Fore.RED}Unknown homing method! Use: {', '.join(HOMING_METHODS)} or a number{Style.RESET_ALL}")
         except Exception as e:
             print(f"{Fore.RED}Homing failed: {e}{Style.RESET_ALL}")
     
+    def do_sethoming(self, arg):
+        """Set homing speeds (0x6099), acceleration (0x609A), home offset
+        (0x607C) and the StallGuard2 threshold (0x2001:01)
+        Usage: sethoming <fast> <slow> <accel> [offset] [sgt]
+        
+        fast searches the switch or hard stop, slow leaves the switch.
+        sgt: -64..63, higher is less sensitive. Tune it until 'home stall-'
+        stops at the hard stop only; the lowest StallGuard value it reports
+        at search speed should stay well above 0.
+        Example: sethoming 150000 4000 260000 0 8"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        if len(args) < 3:
+            print("Usage: sethoming <fast> <slow> <accel> [offset] [sgt]")
+            return
+        try:
+            fast, slow, accel = (int(a) for a in args[:3])
+            self._sdo('Homing speeds')[1].raw = fast
+            self._sdo('Homing speeds')[2].raw = slow
+            self._sdo('Homing acceleration').raw = accel
+            if len(args) > 3:
+                self._sdo('Home offset').raw = int(args[3])
+            if len(args) > 4:
+                self._sdo('Homing configuration')['StallGuard threshold'].raw = int(args[4])
+            print(f"{Fore.GREEN}Homing: fast {fast}, slow {slow}, acceleration {accel}{Style.RESET_ALL}")
+        except ValueError:
+            print(f"{Fore.RED}Invalid format! Use numbers{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Failed to set homing parameters: {e}{Style.RESET_ALL}")
+    
     # ==================== MOTION CONTROL ====================
     
+    def _write_setpoint(self, target, controlword):
+        """Send target position and controlword on RPDO3 or over SDO"""
+        if self.use_pdo:
+            self._rpdo(3)[self._name('Profile target position')].raw = target
+            self._rpdo(3)[self._name('Control word')].raw = controlword
+            self._rpdo(3).transmit()
+        else:
+            self._sdo('Profile target position').raw = target
+            self._sdo('Control word').raw = controlword
+    
+    def _send_setpoint(self, target, flags=0):
+        """Set-point handshake; 'flags' are extra controlword bits (5, 9).
+        Returns the time from the new set-point edge to its acknowledge."""
+        controlword = CW_ENABLE_OPERATION | flags
+        
+        # 1. Target with bit 4 clear; the drive can take a set-point once bit 12
+        #    is clear (it stays set while its set-point buffer is full)
+        self._handshake(lambda: self._write_setpoint(target, controlword), SW_SETPOINT_ACK, 0,
+                        timeout=MOVE_TIMEOUT)
+        
+        # 2. Rising edge of bit 4 (new set-point) until bit 12 acknowledges it.
+        #    The latency of the move starts here.
+        latency = self._handshake(
+            lambda: self._write_setpoint(target, controlword | CW_NEW_SETPOINT), SW_SETPOINT_ACK)
+        
+        # 3. Clear bit 4 again, so the drive drops bit 12 for the next set-point
+        self._write_setpoint(target, controlword)
+        return latency
+    
     def do_move(self, arg):
-        """Move motor to absolute position (CiA 402 Compliant)
-        Usage: move <target_position> [wait]
+        """Move motor to absolute position (CiA 402 set-point handshake)
+        Usage: move <target_position> [wait] [now] [blend]
         
         Parameters:
             target_position : Target position in encoder counts
-            wait            : 'wait' to block until motion complete (optional)
+            wait            : block until motion complete (optional)
+            now             : change set immediately (bit 5), drop the current
+                              move and any buffered set-points
+            blend           : queue behind the current move and run through
+                              its target without stopping (bit 9)
+        
+        Without 'now' a set-point sent during a move is buffered (up to 8) and
+        started when the current target is reached.
         
         Example: move 50000
-                 move 50000 wait"""
+                 move 50000 wait
+                 move 0 now"""
         if not self._check_enabled():
             return
         
         args = arg.split()
         if len(args) < 1:
             print(f"{Fore.RED}Error: Position required{Style.RESET_ALL}")
-            print("Usage: move <position> [wait]")
+            print("Usage: move <position> [wait] [now] [blend]")
             return
         
         try:
             target = int(args[0])
-            wait = len(args) > 1 and args[1].lower() == 'wait'
+            options = {a.lower() for a in args[1:]}
         except ValueError:
             print(f"{Fore.RED}Error: Invalid position value{Style.RESET_ALL}")
             return
         
+        flags = 0
+        if 'now' in options:
+            flags |= CW_CHANGE_IMMEDIATELY
+        if 'blend' in options:
+            flags |= CW_CHANGE_ON_SETPOINT
+        
         try:
             print(f"{Fore.CYAN}Moving to position {target}...{Style.RESET_ALL}")
+            latency = self._send_setpoint(target, flags)
+            print(f"{Fore.GREEN}Set-point acknowledged in {latency * 1000:.1f} ms{Style.RESET_ALL}")
             
-            if self.use_pdo:
-                # CiA 402 Compliant: 3-step process
-                # Step 1: Write target (motor not moving yet)
-                self.node.rpdo[3]['Profile target position'].raw = target
-                self.node.rpdo[3]['Control word'].raw = 0x0F
-                self.node.rpdo[3].transmit()
-                time.sleep(0.05)
-                
-                # Step 2: Clear bit 4
-                self.node.rpdo[3]['Control word'].raw = 0x0F
-                self.node.rpdo[3].transmit()
-                time.sleep(0.05)
-                
-                # Step 3: Set bit 4 (RISING EDGE -> TRIGGER!)
-                self.node.rpdo[3]['Control word'].raw = 0x1F
-                self.node.rpdo[3].transmit()
-            else:
-                # Use SDO
-                self.node.sdo['Profile target position'].raw = target
-                time.sleep(0.05)
-                self.node.sdo['Control word'].raw = 0x0F
-                time.sleep(0.05)
-                self.node.sdo['Control word'].raw = 0x1F
+            if 'wait' in options:
+                self._wait_motion_complete()
             
-            print(f"{Fore.GREEN}Motion command sent!{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Move failed: {e}{Style.RESET_ALL}")
+    
+    def do_path(self, arg):
+        """Run through several positions without stopping in between
+        Usage: path <pos1> <pos2> ... [wait]
+        
+        The first position starts at once, the others are buffered as blended
+        set-points (bit 9): the drive only stops where the direction reverses
+        and at the last position.
+        
+        Example: path 10000 20000 30000 0 wait"""
+        if not self._check_enabled():
+            return
+        
+        args = arg.split()
+        wait = bool(args) and args[-1].lower() == 'wait'
+        try:
+            targets = [int(a) for a in (args[:-1] if wait else args)]
+        except ValueError:
+            print(f"{Fore.RED}Error: Invalid position value{Style.RESET_ALL}")
+            return
+        if not targets:
+            print("Usage: path <pos1> <pos2> ... [wait]")
+            return
+        
+        try:
+            start_time = time.time()
+            for i, target in enumerate(targets):
+                self._send_setpoint(target, CW_CHANGE_ON_SETPOINT if i else 0)
+            print(f"{Fore.GREEN}{len(targets)} set-points sent in "
+                  f"{(time.time() - start_time) * 1000:.1f} ms{Style.RESET_ALL}")
             
             if wait:
-                self._wait_motion_complete()
+                self._wait_motion_complete(timeout=MOVE_TIMEOUT)
             
         except Exception as e:
-            print(f"{Fore.RED}Move failed: {e}{Style.RESET_ALL}")
+            print(f"{Fore.RED}Path failed: {e}{Style.RESET_ALL}")
+    
+    def do_ip(self, arg):
+        """Interpolated Position: run through positions at a fixed period
+        Usage: ip <period_ms> <pos1> <pos2> ... [wait]
+               ip status        Show buffered points and underruns
+        
+        The positions are sent in one SDO burst (0x2004), then bit 4 starts
+        the interpolation in mode 7: one point per period, the motor moving
+        in a straight line from one to the next.
+        
+        Example: ip 10 1000 3000 6000 8000 9000 wait"""
+        if not self._check_enabled():
+            return
+        
+        args = arg.split()
+        if args and args[0].lower() == 'status':
+            try:
+                status = self._sdo('Interpolation buffer status')
+                print(f"Buffered points : {status['Interpolation buffer fill level'].raw}")
+                print(f"Underruns       : {status['Interpolation buffer underruns'].raw}")
+            except Exception as e:
+                print(f"{Fore.RED}Failed to read interpolation status: {e}{Style.RESET_ALL}")
+            return
+        
+        wait = bool(args) and args[-1].lower() == 'wait'
+        try:
+            period = int(args[0])
+            points = [int(a) for a in (args[1:-1] if wait else args[1:])]
+        except (IndexError, ValueError):
+            print("Usage: ip <period_ms> <pos1> <pos2> ... [wait]")
+            return
+        if not points or not 1 <= period <= 255:
+            print("Usage: ip <period_ms> <pos1> <pos2> ... [wait] (period 1-255 ms)")
+            return
+        
+        try:
+            period_obj = self._sdo('Interpolation time period')
+            period_obj['Interpolation time period value'].raw = period
+            period_obj['Interpolation time index'].raw = -3
+            
+            # Mode 7 with bit 4 clear, the points, then bit 4 starts them
+            self._write_mode(7, CW_ENABLE_OPERATION)
+            self.current_mode = 7
+            self._sdo('Interpolation data burst').raw = b''.join(
+                p.to_bytes(4, 'little', signed=True) for p in points)
+            self.events.mark_command([self._key])
+            self._write_controlword(CW_ENABLE_OPERATION | CW_NEW_SETPOINT)
+            print(f"{Fore.GREEN}{len(points)} points at {period} ms started{Style.RESET_ALL}")
+            
+            if wait:
+                self._wait_motion_complete(timeout=MOVE_TIMEOUT + len(points) * period / 1000)
+                self._write_mode(7, CW_ENABLE_OPERATION)
+                self._handshake(lambda: self._write_mode(1, CW_ENABLE_OPERATION), SW_SETPOINT_ACK, 0)
+                self.current_mode = 1
+            
+        except Exception as e:
+            print(f"{Fore.RED}Interpolation failed: {e}{Style.RESET_ALL}")
+    
+    def do_gearing(self, arg):
+        """Electronic gearing: follow the position of another node
+        Usage: gearing <ratio> [offset]   Gear ratio and offset, then mode -1
+               gearing master <pos>       Write the master position over SDO
+               gearing status             Master position, gearing error
+               gearing off                Back to Profile Position mode
+        
+        The leader sends its position (0x6064) in a TPDO; an RPDO of this axis
+        maps it to 0x2005:01 (sync transmission type: taken on the SYNC, 255:
+        on every reception). The motor follows offset + ratio x master.
+        
+        Example: gearing 0.5 1000"""
+        if not self._check_enabled():
+            return
+        
+        args = arg.split()
+        try:
+            gearing = self._sdo('Electronic gearing')
+            if args and args[0] == 'status':
+                print(f"Master position : {gearing['Master position'].raw}")
+                print(f"Gear ratio      : {gearing['Gear ratio'].raw / GEAR_RATIO_ONE:g}")
+                print(f"Gear offset     : {gearing['Gear offset'].raw}")
+                print(f"Gearing error   : {gearing['Gearing error'].raw} "
+                      f"(max {gearing['Maximum gearing error'].raw}) usteps")
+            elif args and args[0] == 'master':
+                gearing['Master position'].raw = int(args[1])
+            elif args and args[0] == 'off':
+                self._handshake(lambda: self._write_mode(1, CW_ENABLE_OPERATION), SW_SETPOINT_ACK, 0)
+                self.current_mode = 1
+            elif args:
+                ratio = round(float(args[0]) * GEAR_RATIO_ONE)
+                gearing['Gear ratio'].raw = ratio
+                gearing['Gear offset'].raw = int(args[1]) if len(args) > 1 else 0
+                gearing['Maximum gearing error'].raw = 0
+                self._write_mode(MODE_ELECTRONIC_GEARING, CW_ENABLE_OPERATION)
+                self.current_mode = MODE_ELECTRONIC_GEARING
+                print(f"{Fore.GREEN}Following the master at {ratio / GEAR_RATIO_ONE:g}{Style.RESET_ALL}")
+            else:
+                raise ValueError()
+        except (IndexError, ValueError):
+            print("Usage: gearing <ratio> [offset] | master <pos> | status | off")
+        except Exception as e:
+            print(f"{Fore.RED}Gearing failed: {e}{Style.RESET_ALL}")
     
     def do_wait(self, arg):
-        """Wait until motion completes (polling Target Reached bit)
+        """Wait until motion completes (Target Reached bit from the TPDOs)
         Usage: wait [timeout]
         
         Parameters:
@@ -355,25 +826,21 @@ class CANopenCLI(cmd.Cmd):
         self._wait_motion_complete(timeout)
     
     def _wait_motion_complete(self, timeout=10.0):
-        """Internal method to wait for motion completion"""
+        """Internal method to wait for motion completion. Waits for the TPDO
+        that sets 'Target reached' after the last move command; the latency
+        is measured from that command."""
         print(f"{Fore.CYAN}Waiting for motion to complete...{Style.RESET_ALL}")
-        start_time = time.time()
         
         try:
-            while True:
-                sw = self.node.sdo['Status word'].raw
-                if sw & SW_TARGET_REACHED:
-                    pos = self.node.sdo['Actual motor position'].raw
-                    elapsed = time.time() - start_time
-                    print(f"{Fore.GREEN}Target reached ({elapsed:.2f}s){Style.RESET_ALL}")
-                    print(f"{Fore.GREEN}Actual position: {pos}{Style.RESET_ALL}")
-                    return True
-                
-                if time.time() - start_time > timeout:
-                    print(f"{Fore.YELLOW}Motion timeout after {timeout}s{Style.RESET_ALL}")
-                    return False
-                
-                time.sleep(0.1)
+            result = self.events.wait(SW_TARGET_REACHED, node_ids=[self._key], timeout=timeout, edge=True)
+            if not result.ok:
+                print(f"{Fore.YELLOW}Motion timeout after {timeout}s{Style.RESET_ALL}")
+                return False
+            
+            pos = self._sdo('Actual motor position').raw
+            print(f"{Fore.GREEN}Target reached ({result[self._key]:.3f}s after the command){Style.RESET_ALL}")
+            print(f"{Fore.GREEN}Actual position: {pos}{Style.RESET_ALL}")
+            return True
                 
         except Exception as e:
             print(f"{Fore.RED}Wait error: {e}{Style.RESET_ALL}")
@@ -388,15 +855,17 @@ class CANopenCLI(cmd.Cmd):
             return
         
         try:
-            sw = self.node.sdo['Status word'].raw
-            pos = self.node.sdo['Actual motor position'].raw
-            mode = self.node.sdo['Modes of operation'].raw
+            sw = self._sdo('Status word').raw
+            pos = self._sdo('Actual motor position').raw
+            mode = self._sdo('Modes of operation').raw
             
             print(f"\n{Fore.CYAN}=== Motor Status ==={Style.RESET_ALL}")
             print(f"Statusword      : 0x{sw:04X}")
             print(f"  - Ready       : {'Yes' if sw & 0x01 else 'No'}")
             print(f"  - Switched On : {'Yes' if sw & 0x02 else 'No'}")
             print(f"  - Enabled     : {'Yes' if sw & 0x04 else 'No'}")
+            print(f"  - Fault       : {'Yes' if sw & SW_FAULT else 'No'}")
+            print(f"  - Quick stop  : {'Active' if (sw & SW_STATE_MASK) == SW_STATE_QUICK_STOP_ACTIVE else 'No'}")
             print(f"  - Target OK   : {'Yes' if sw & SW_TARGET_REACHED else 'No'}")
             print(f"Position        : {pos}")
             print(f"Mode            : {mode} ({self._mode_name(mode)})")
@@ -413,23 +882,70 @@ class CANopenCLI(cmd.Cmd):
             return
         
         try:
-            pos = self.node.sdo['Actual motor position'].raw
+            pos = self._sdo('Actual motor position').raw
             print(f"{Fore.GREEN}Current position: {pos}{Style.RESET_ALL}")
         except Exception as e:
             print(f"{Fore.RED}Failed to read position: {e}{Style.RESET_ALL}")
     
+    def do_probe(self, arg):
+        """Touch probe: position latched by the TMC5160 on REFL (probe 1)
+        or REFR (probe 2), captured in hardware (XLATCH)
+        Usage: probe <1|2> [rise] [fall] [cont]   enable (default: rise, first edge only)
+               probe <1|2> off
+               probe                              show status and positions
+        
+        Probe 1 rising edges are printed as they arrive on TPDO3.
+        Example: probe 1 rise cont"""
+        if not self._check_connected():
+            return
+        
+        args = arg.lower().split()
+        try:
+            if args:
+                probe = int(args[0])
+                if probe not in (1, 2):
+                    raise ValueError
+                shift = 8 * (probe - 1)
+                function = self._sdo('Touch probe function').raw & ~(0xFF << shift)
+                if 'off' not in args[1:]:
+                    bits = TP_ENABLE
+                    bits |= TP_CONTINUOUS if 'cont' in args[1:] else 0
+                    bits |= TP_NEGATIVE_EDGE if 'fall' in args[1:] else 0
+                    bits |= TP_POSITIVE_EDGE if 'rise' in args[1:] or 'fall' not in args[1:] else 0
+                    function |= bits << shift
+                self._sdo('Touch probe function').raw = function
+            
+            function = self._sdo('Touch probe function').raw
+            status = self._sdo('Touch probe status').raw
+            print(f"{Fore.CYAN}Touch probe function 0x{function:04X}, status 0x{status:04X}{Style.RESET_ALL}")
+            for probe, name in ((1, 'REFL'), (2, 'REFR')):
+                shift = 8 * (probe - 1)
+                if not (function >> shift) & TP_ENABLE:
+                    print(f"  Probe {probe} ({name}): off")
+                    continue
+                edges = []
+                for edge, stored in (('positive', TP_POSITIVE_STORED), ('negative', TP_NEGATIVE_STORED)):
+                    if (status >> shift) & stored:
+                        edges.append(f"{edge} {self._sdo(f'Touch probe {probe} {edge} edge').raw}")
+                mode = 'continuous' if (function >> shift) & TP_CONTINUOUS else 'first edge'
+                print(f"  Probe {probe} ({name}, {mode}): {', '.join(edges) or 'waiting'}")
+        except ValueError:
+            print("Usage: probe <1|2> [rise] [fall] [cont] | probe <1|2> off | probe")
+        except Exception as e:
+            print(f"{Fore.RED}Touch probe failed: {e}{Style.RESET_ALL}")
+    
     # ==================== PARAMETER SETTING (SDO) ====================
     
     def do_setvel(self, arg):
         """Set Profile Velocity (0x6081)
-        Usage: setvel <value>
+        Usage: setvel <value>   user units/s
         Example: setvel 100000"""
         if not self._check_connected():
             return
         
         try:
             vel = int(arg)
-            self.node.sdo['Profile target velocity'].raw = vel
+            self._sdo('Profile target velocity').raw = vel
             print(f"{Fore.GREEN}Velocity set to {vel}{Style.RESET_ALL}")
         except ValueError:
             print(f"{Fore.RED}Invalid format! Use: setvel <number>{Style.RESET_ALL}")
@@ -438,14 +954,14 @@ class CANopenCLI(cmd.Cmd):
     
     def do_setaccel(self, arg):
         """Set Profile Acceleration (0x6083)
-        Usage: setaccel <value>
-        Example: setaccel 5000"""
+        Usage: setaccel <value>   user units/s^2
+        Example: setaccel 300000"""
         if not self._check_connected():
             return
         
         try:
             accel = int(arg)
-            self.node.sdo['Profile target acceleration'].raw = accel
+            self._sdo('Profile target acceleration').raw = accel
             print(f"{Fore.GREEN}Acceleration set to {accel}{Style.RESET_ALL}")
         except ValueError:
             print(f"{Fore.RED}Invalid format! Use: setaccel <number>{Style.RESET_ALL}")
@@ -454,20 +970,149 @@ class CANopenCLI(cmd.Cmd):
     
     def do_setdecel(self, arg):
         """Set Profile Deceleration (0x6084)
-        Usage: setdecel <value>
-        Example: setdecel 5000"""
+        Usage: setdecel <value>   user units/s^2
+        Example: setdecel 300000"""
         if not self._check_connected():
             return
         
         try:
             decel = int(arg)
-            self.node.sdo['Profile target deceleration'].raw = decel
+            self._sdo('Profile target deceleration').raw = decel
             print(f"{Fore.GREEN}Deceleration set to {decel}{Style.RESET_ALL}")
         except ValueError:
             print(f"{Fore.RED}Invalid format! Use: setdecel <number>{Style.RESET_ALL}")
         except Exception as e:
             print(f"{Fore.RED}Failed to set deceleration: {e}{Style.RESET_ALL}")
     
+    def do_setprofile(self, arg):
+        """Set Motion Profile Type (0x6086) and jerk limit (0x60A4:01)
+        Usage: setprofile linear
+               setprofile scurve <jerk>
+        
+        jerk is in user units/s^3 (usteps by default). The S-curve starts and ends every ramp with
+        half the acceleration up to V1 = accel^2 / (2 * jerk), which halves
+        the acceleration steps; 'linear' is the plain trapezoid.
+        Example: setprofile scurve 1000000"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        try:
+            if args and args[0].lower() == 'linear':
+                self._sdo('Motion profile type').raw = 0
+                print(f"{Fore.GREEN}Linear ramp{Style.RESET_ALL}")
+            elif len(args) == 2 and args[0].lower() == 'scurve':
+                jerk = int(args[1])
+                self._sdo('Profile jerk')[1].raw = jerk
+                self._sdo('Motion profile type').raw = 3
+                print(f"{Fore.GREEN}S-curve ramp, jerk {jerk} units/s^3{Style.RESET_ALL}")
+            else:
+                print("Usage: setprofile linear | setprofile scurve <jerk>")
+        except ValueError:
+            print(f"{Fore.RED}Invalid format! Use: setprofile scurve <number>{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Failed to set profile: {e}{Style.RESET_ALL}")
+    
+    def do_encoder(self, arg):
+        """Encoder on the motor shaft (0x2002) and following error monitoring
+        (0x6065 window, 0x6066 time out)
+        Usage: encoder                                 show settings and following error
+               encoder <counts> [usteps] [inv]         counts per revolution (quadrature),
+                                                       usteps per revolution (default 51200)
+               encoder off
+               encoder window <usteps> <ms>            fault after <ms> outside +/-<usteps>
+        
+        With an encoder the actual position (0x6064) is the encoder position
+        in usteps, and a following error (0x60F4) outside the window for
+        longer than the time out is a fault. XACTUAL takes the encoder
+        position when the drive is enabled.
+        Example: encoder 4000
+                 encoder window 512 10"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        config = self._sdo('Encoder configuration')
+        try:
+            if not args:
+                counts = config['Encoder resolution'].raw
+                print(f"\n{Fore.CYAN}=== Encoder ==={Style.RESET_ALL}")
+                if counts:
+                    inverted = ', inverted' if config['Encoder direction inverted'].raw else ''
+                    print(f"Resolution      : {counts} counts / {config['Motor resolution'].raw} usteps{inverted}")
+                else:
+                    print("Resolution      : none (position from XACTUAL)")
+                print(f"Window          : {self._sdo('Following error window').raw} usteps")
+                print(f"Time out        : {self._sdo('Following error time out').raw} ms")
+                print(f"Following error : {self._sdo('Following error actual value').raw} usteps")
+                print()
+            elif args[0].lower() == 'off':
+                config['Encoder resolution'].raw = 0
+                print(f"{Fore.GREEN}Encoder off{Style.RESET_ALL}")
+            elif args[0].lower() == 'window' and len(args) == 3:
+                self._sdo('Following error window').raw = int(args[1])
+                self._sdo('Following error time out').raw = int(args[2])
+                print(f"{Fore.GREEN}Following error: {args[1]} usteps for {args[2]} ms{Style.RESET_ALL}")
+            else:
+                counts = int(args[0])
+                options = [a.lower() for a in args[1:]]
+                usteps = [int(a) for a in options if a != 'inv']
+                if usteps:
+                    config['Motor resolution'].raw = usteps[0]
+                config['Encoder direction inverted'].raw = 1 if 'inv' in options else 0
+                config['Encoder resolution'].raw = counts
+                print(f"{Fore.GREEN}Encoder: {counts} counts per revolution{Style.RESET_ALL}")
+        except ValueError:
+            print("Usage: encoder [<counts> [usteps] [inv] | off | window <usteps> <ms>]")
+        except Exception as e:
+            print(f"{Fore.RED}Encoder configuration failed: {e}{Style.RESET_ALL}")
+    
+    def do_units(self, arg):
+        """User units of the factor group: position encoder resolution
+        (0x608F), gear ratio (0x6091) and feed constant (0x6092)
+        Usage: units                                     show the factors
+               units <usteps> <feed> [<motor> <shaft>]   usteps per motor revolution,
+                                                         user units per shaft revolution,
+                                                         gear motor:shaft revolutions
+               units off                                 usteps (all factors 1)
+        
+        Positions, velocities (per s) and accelerations (per s^2) on the bus
+        are in user units; the drive converts them exactly. A combination
+        the drive cannot represent is refused.
+        Example: units 51200 5000 7 3    (5 mm per shaft revolution in um, 7:3 gear)"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        resolution = self._sdo('Position encoder resolution')
+        gear = self._sdo('Gear ratio')
+        feed = self._sdo('Feed constant')
+        try:
+            if not args:
+                print(f"\n{Fore.CYAN}=== User Units ==={Style.RESET_ALL}")
+                print(f"Encoder resolution : {resolution[1].raw} usteps / {resolution[2].raw} motor revolutions")
+                print(f"Gear ratio         : {gear[1].raw} motor / {gear[2].raw} shaft revolutions")
+                print(f"Feed constant      : {feed[1].raw} units / {feed[2].raw} shaft revolutions")
+                print()
+                return
+            values = [1, 1, 1, 1, 1, 1] if args[0].lower() == 'off' else None
+            if values is None:
+                usteps, units = int(args[0]), int(args[1])
+                motor, shaft = (int(args[2]), int(args[3])) if len(args) > 3 else (1, 1)
+                values = [usteps, 1, motor, shaft, units, 1]
+            # Each write is checked against the others: set the factors to 1 first
+            for obj in (resolution, gear, feed):
+                obj[1].raw = 1
+                obj[2].raw = 1
+            resolution[1].raw, resolution[2].raw = values[0], values[1]
+            gear[1].raw, gear[2].raw = values[2], values[3]
+            feed[1].raw, feed[2].raw = values[4], values[5]
+            print(f"{Fore.GREEN}User units set{Style.RESET_ALL}")
+        except (ValueError, IndexError):
+            print("Usage: units [<usteps> <feed> [<motor> <shaft>] | off]")
+        except Exception as e:
+            print(f"{Fore.RED}Factor group refused: {e}{Style.RESET_ALL}")
+    
     def do_getparams(self, arg):
         """Display current motion profile parameters
         Usage: getparams"""
@@ -475,19 +1120,280 @@ class CANopenCLI(cmd.Cmd):
             return
         
         try:
-            vel = self.node.sdo['Profile target velocity'].raw
-            accel = self.node.sdo['Profile target acceleration'].raw
-            decel = self.node.sdo['Profile target deceleration'].raw
+            vel = self._sdo('Profile target velocity').raw
+            accel = self._sdo('Profile target acceleration').raw
+            decel = self._sdo('Profile target deceleration').raw
+            profile = self._sdo('Motion profile type').raw
+            jerk = self._sdo('Profile jerk')[1].raw
             
             print(f"\n{Fore.CYAN}=== Motion Profile Parameters ==={Style.RESET_ALL}")
-            print(f"Velocity     : {vel}")
-            print(f"Acceleration : {accel}")
-            print(f"Deceleration : {decel}")
+            print(f"Velocity     : {vel} units/s")
+            print(f"Acceleration : {accel} units/s^2")
+            print(f"Deceleration : {decel} units/s^2")
+            print(f"Profile      : {'linear' if profile == 0 else f'S-curve, jerk {jerk} units/s^3'}")
             print()
             
         except Exception as e:
             print(f"{Fore.RED}Failed to read parameters: {e}{Style.RESET_ALL}")
     
+    def do_store(self, arg):
+        """Store parameters in the node's flash (0x1010)
+        Usage: store [all|comm|app|mfr]
+        They are restored at every boot; 'all' is the default. Refused while
+        an axis is enabled: writing the flash stalls the node."""
+        self._store_or_restore(0x1010, SIGNATURE_SAVE, arg, "stored")
+    
+    def do_restore(self, arg):
+        """Restore default parameters (0x1011), effective after the next reset
+        Usage: restore [all|comm|app|mfr]"""
+        self._store_or_restore(0x1011, SIGNATURE_LOAD, arg, "reset to defaults (after next reset)")
+    
+    def _store_or_restore(self, index, signature, arg, done):
+        if not self._check_connected():
+            return
+        
+        group = arg.strip().lower() or 'all'
+        if group not in PARAM_GROUPS:
+            print(f"{Fore.RED}Unknown group '{group}'. Use: all, comm, app, mfr{Style.RESET_ALL}")
+            return
+        
+        timeout = self.node.sdo.RESPONSE_TIMEOUT
+        try:
+            self.node.sdo.RESPONSE_TIMEOUT = STORE_TIMEOUT
+            self.node.sdo[index][PARAM_GROUPS[group]].raw = signature
+            print(f"{Fore.GREEN}Parameters ({group}) {done}{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Failed: {e}{Style.RESET_ALL}")
+        finally:
+            self.node.sdo.RESPONSE_TIMEOUT = timeout
+    
+    def do_boottime(self, arg):
+        """Display how long the node took to boot, per phase (0x2105)
+        Usage: boottime"""
+        if not self._check_connected():
+            return
+        
+        try:
+            print(f"\n{Fore.CYAN}=== Boot Time ==={Style.RESET_ALL}")
+            for sub, name in enumerate(BOOT_PHASES, start=1):
+                us = self.node.sdo[BOOT_TIME][sub].raw
+                print(f"{name:<20}: {us / 1000:8.3f} ms")
+            print()
+        except Exception as e:
+            print(f"{Fore.RED}Failed to read boot time: {e}{Style.RESET_ALL}")
+    
+    def do_synclatency(self, arg):
+        """Display the Cyclic Synchronous Velocity latency from SYNC reception
+        to the last TMC5160 write (0x2106), or restart the statistics
+        Usage: synclatency [reset]"""
+        if not self._check_connected():
+            return
+        
+        try:
+            if arg.strip() == 'reset':
+                self.node.sdo[SYNC_LATENCY][4].raw = 0
+                print(f"{Fore.GREEN}SYNC latency statistics restarted{Style.RESET_ALL}")
+                return
+            count = self.node.sdo[SYNC_LATENCY][4].raw
+            print(f"\n{Fore.CYAN}=== SYNC Latency ==={Style.RESET_ALL}")
+            print(f"SYNCs served    : {count}")
+            if count:
+                for sub, name in ((1, 'Last'), (2, 'Minimum'), (3, 'Maximum')):
+                    print(f"{name:<16}: {self.node.sdo[SYNC_LATENCY][sub].raw} us")
+            print()
+        except Exception as e:
+            print(f"{Fore.RED}Failed to read SYNC latency: {e}{Style.RESET_ALL}")
+    
+    def do_motiontick(self, arg):
+        """Display the motion tick period and its statistics (0x2107), set
+        the period, or restart the statistics
+        Usage: motiontick [<period_us> | reset]"""
+        if not self._check_connected():
+            return
+        
+        try:
+            arg = arg.strip()
+            if arg == 'reset':
+                self.node.sdo[MOTION_TICK][4].raw = 0
+                print(f"{Fore.GREEN}Motion tick statistics restarted{Style.RESET_ALL}")
+                return
+            if arg:
+                self.node.sdo[MOTION_TICK][1].raw = int(arg)
+            print(f"\n{Fore.CYAN}=== Motion Tick ==={Style.RESET_ALL}")
+            print(f"Period          : {self.node.sdo[MOTION_TICK][1].raw} us")
+            print(f"Worst latency   : {self.node.sdo[MOTION_TICK][2].raw} us")
+            print(f"Longest tick    : {self.node.sdo[MOTION_TICK][3].raw} us")
+            print(f"Commands        : {self.node.sdo[MOTION_TICK][4].raw}")
+            print()
+        except ValueError:
+            print(f"{Fore.RED}Error: period must be a number of microseconds (250-2000){Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Motion tick access failed: {e}{Style.RESET_ALL}")
+    
+    def do_heartbeat(self, arg):
+        """Heartbeat consumer (0x1016) and the reaction to a lost heartbeat
+        Usage: heartbeat                     Show the consumed nodes and losses
+               heartbeat <node> <ms> [1-4]   Consume a heartbeat (entry 1 by default, 0 ms = off)
+               heartbeat abort <0-3>         Abort connection option code (0x6007) of the axis:
+                                             0=no action 1=fault 2=disable voltage 3=quick stop
+               heartbeat reset               Restart the loss statistics (0x2108)
+        
+        Example: heartbeat 1 50     Stop the axes 50 ms after the master's
+                                    last heartbeat (master producing 0x1017 = 20)"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        try:
+            if args and args[0] == 'reset':
+                self.node.sdo[HEARTBEAT_LOSS][3].raw = 0
+                print(f"{Fore.GREEN}Heartbeat loss statistics restarted{Style.RESET_ALL}")
+                return
+            if args and args[0] == 'abort':
+                self._sdo('Abort connection option code').raw = int(args[1])
+            elif args:
+                node, ms = int(args[0]), int(args[1])
+                entry = int(args[2]) if len(args) > 2 else 1
+                self.node.sdo[CONSUMER_HEARTBEAT][entry].raw = (node << 16) | ms if ms else 0
+            
+            print(f"\n{Fore.CYAN}=== Heartbeat Consumer ==={Style.RESET_ALL}")
+            for entry in range(1, 5):
+                value = self.node.sdo[CONSUMER_HEARTBEAT][entry].raw
+                if (value >> 16) & 0xFF and value & 0xFFFF:
+                    print(f"Entry {entry}         : node {(value >> 16) & 0xFF}, {value & 0xFFFF} ms")
+            option = self._sdo('Abort connection option code').raw
+            print(f"Reaction (axis {self.axis}): {ABORT_OPTIONS.get(option, option)}")
+            print(f"Losses          : {self.node.sdo[HEARTBEAT_LOSS][3].raw}"
+                  f" (last node {self.node.sdo[HEARTBEAT_LOSS][4].raw})")
+            print(f"Reaction time   : {self.node.sdo[HEARTBEAT_LOSS][1].raw} us"
+                  f" (worst {self.node.sdo[HEARTBEAT_LOSS][2].raw} us)")
+            print()
+        except (IndexError, ValueError):
+            print("Usage: heartbeat [<node> <ms> [1-4] | abort <0-3> | reset]")
+        except Exception as e:
+            print(f"{Fore.RED}Heartbeat access failed: {e}{Style.RESET_ALL}")
+    
+    def do_errors(self, arg):
+        """Emergency errors: error register (0x1001), error history (0x1003)
+        and the error code of the axis (0x603F). EMCYs are printed as they come.
+        Usage: errors                 Show the errors
+               errors clear           Clear the error history
+               errors inhibit <ms>    Minimum time between two EMCYs (0x1015)"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        try:
+            if args and args[0] == 'clear':
+                self.node.sdo[ERROR_HISTORY][0].raw = 0
+            elif args and args[0] == 'inhibit':
+                self.node.sdo[EMCY_INHIBIT].raw = round(float(args[1]) * 10)
+            elif args:
+                raise ValueError(args[0])
+            
+            print(f"\n{Fore.CYAN}=== Errors ==={Style.RESET_ALL}")
+            print(f"Error register  : 0x{self.node.sdo[ERROR_REGISTER].raw:02X}")
+            code = self._sdo('Error code').raw
+            print(f"Axis {self.axis} error code: 0x{code:04X} {EMCY_CODES.get(code, '') if code else 'none'}")
+            count = self.node.sdo[ERROR_HISTORY][0].raw
+            for n in range(1, count + 1):
+                code = self.node.sdo[ERROR_HISTORY][n].raw & 0xFFFF
+                print(f"History {n:<8}: 0x{code:04X} {EMCY_CODES.get(code, '')}")
+            print(f"Inhibit time    : {self.node.sdo[EMCY_INHIBIT].raw / 10:g} ms")
+            print()
+        except (IndexError, ValueError):
+            print("Usage: errors [clear | inhibit <ms>]")
+        except Exception as e:
+            print(f"{Fore.RED}Error access failed: {e}{Style.RESET_ALL}")
+    
+    # ==================== MOTION RECORDER (SCOPE) ====================
+    
+    def do_scope(self, arg):
+        """On-target motion recorder
+        Usage: scope config <channel_mask> <period_ms> [pre_trigger]
+               scope arm        Record, start capture on the next move
+               scope trigger    Start capture now
+               scope stop       Stop recording
+               scope status     Show recorder state
+               scope fetch <file.csv>
+        
+        Channel mask bits: 0=time_us (always) 1=xactual 2=vactual 3=ramp_stat
+                           4=sg_result 5=cs_actual 6=statusword
+        
+        Example: scope config 0x4F 1 100
+                 scope arm
+                 move 50000 wait
+                 scope fetch ramp.csv"""
+        if not self._check_connected():
+            return
+        
+        args = arg.split()
+        if not args:
+            print(f"{Fore.RED}Error: Sub-command required{Style.RESET_ALL}")
+            print("Usage: scope config|arm|trigger|stop|status|fetch")
+            return
+        
+        try:
+            sub = args[0].lower()
+            if sub == 'config':
+                if len(args) < 3:
+                    print("Usage: scope config <channel_mask> <period_ms> [pre_trigger]")
+                    return
+                self.node.sdo[SCOPE_CONFIG][1].raw = int(args[1], 0)
+                self.node.sdo[SCOPE_CONFIG][2].raw = int(args[2], 0)
+                if len(args) > 3:
+                    self.node.sdo[SCOPE_CONFIG][3].raw = int(args[3], 0)
+                print(f"{Fore.GREEN}Scope configured{Style.RESET_ALL}")
+            elif sub in ('arm', 'trigger', 'stop'):
+                command = {'stop': 0, 'arm': 1, 'trigger': 2}[sub]
+                self.node.sdo[SCOPE_CONFIG][4].raw = command
+                print(f"{Fore.GREEN}Scope {sub} sent{Style.RESET_ALL}")
+            elif sub == 'status':
+                state = self.node.sdo[SCOPE_CONFIG][5].raw
+                count = self.node.sdo[SCOPE_CONFIG][6].raw
+                print(f"Scope state     : {SCOPE_STATES.get(state, state)}")
+                print(f"Captured samples: {count}")
+            elif sub == 'fetch':
+                if len(args) < 2:
+                    print("Usage: scope fetch <file.csv>")
+                    return
+                self._scope_fetch(args[1])
+            else:
+                print(f"{Fore.RED}Unknown scope command: '{sub}'{Style.RESET_ALL}")
+        except ValueError:
+            print(f"{Fore.RED}Invalid number format{Style.RESET_ALL}")
+        except Exception as e:
+            print(f"{Fore.RED}Scope command failed: {e}{Style.RESET_ALL}")
+    
+    def _scope_fetch(self, filename):
+        """Upload the capture (SDO block transfer) and write it as CSV"""
+        start_time = time.time()
+        with self.node.sdo.open(SCOPE_CAPTURE, 0, 'rb', block_transfer=True) as f:
+            data = f.read()
+        elapsed = time.time() - start_time
+        
+        version, mask, period, samples, pre_trigger, period_us = SCOPE_HEADER.unpack_from(data)
+        if version != 2:
+            raise ValueError(f"unsupported capture format {version}")
+        
+        columns = [name for bit, name in enumerate(SCOPE_CHANNELS) if mask & (1 << bit)]
+        width = len(columns)
+        values = struct.unpack_from(f'<{samples * width}i', data, SCOPE_HEADER.size)
+        
+        # Every sample carries its time (column 0), so the trigger time comes
+        # from the samples rather than from the configured period.
+        t_trigger = values[min(pre_trigger, samples - 1) * width] if samples else 0
+        with open(filename, 'w', newline='') as out:
+            writer = csv.writer(out)
+            writer.writerow(['sample', 't_trigger_ms'] + columns)
+            for i in range(samples):
+                row = values[i * width:(i + 1) * width]
+                t = (row[0] - t_trigger + 2**31) % 2**32 - 2**31  # The us clock wraps after 71 min
+                writer.writerow([i, f"{t / 1000:.3f}"] + list(row))
+        
+        print(f"{Fore.GREEN}{samples} samples ({len(data)} bytes, {elapsed:.2f}s), "
+              f"{period_us} us measured for {period} ms, written to {filename}{Style.RESET_ALL}")
+    
     # ==================== MODE SWITCHING ====================
     
     def do_usepdo(self, arg):
@@ -522,7 +1428,8 @@ class CANopenCLI(cmd.Cmd):
     
     def _mode_name(self, mode):
         """Convert mode number to name"""
-        modes = {1: "Profile Position", 6: "Homing", 3: "Profile Velocity"}
+        modes = {1: "Profile Position", 6: "Homing", 3: "Profile Velocity",
+                 7: "Interpolated Position", 9: "Cyclic Synchronous Velocity"}
         return modes.get(mode, "Unknown")
     
     # ==================== CMD OVERRIDES ====================
@@ -3,6 +3,8 @@ import canopen.nmt
 import time
 import os
 
+from drive_events import StatuswordMonitor
+
 NODE_ID = 2
 EDS_FILE = 'slave.dcf'
 INTERFACE = 'socketcan'
@@ -11,25 +13,24 @@ CHANNEL = 'can0'
 # Bitmask untuk Statusword CiA 402
 SW_TARGET_REACHED = (1 << 10)
 
-def wait_for_move_complete(node, timeout=10):
-    """Polls the Statusword until the 'Target reached' bit is set."""
-    print("  -> Menunggu gerakan selesai (polling Statusword bit 10)...")
-    start_time = time.time()
-    while True:
-        try:
-            sw = node.sdo['Status word'].raw
-            if sw & SW_TARGET_REACHED:
-                print("  -> 'Target reached' terdeteksi!")
-                return True
-        except canopen.sdo.SdoCommunicationError:
-            # Abaikan timeout SDO sesekali, coba lagi
-            pass
-        
-        if time.time() - start_time > timeout:
-            print("  -> GAGAL: Timeout menunggu gerakan selesai.")
-            return False
-        
-        time.sleep(0.1) # Jeda polling
+# Objek tes SDO streaming (lihat Core/Src/Peripheral/Inc/sdo_test.h)
+SDO_TEST_DOMAIN = 0x2102
+SDO_TEST_CONFIG = 0x2103
+
+def sdo_test_pattern(size):
+    """Pola data yang dihasilkan/diperiksa firmware pada objek 0x2102."""
+    return bytes((i * 7 + (i >> 8)) & 0xFF for i in range(size))
+
+def wait_for_move_complete(monitor, node, timeout=10):
+    """Waits for the TPDO that sets 'Target reached' after the last
+    monitor.mark_command() (no SDO polling)."""
+    print("  -> Menunggu gerakan selesai (Statusword bit 10 dari TPDO)...")
+    result = monitor.wait(SW_TARGET_REACHED, node_ids=[node.id], timeout=timeout, edge=True)
+    if not result.ok:
+        print("  -> GAGAL: Timeout menunggu gerakan selesai.")
+        return False
+    print(f"  -> 'Target reached' terdeteksi, {result[node.id] * 1000:.1f} ms setelah perintah.")
+    return True
 
 def test_homing(node):
     print("\n--- Memulai Tes Homing Method 35 ---")
@@ -74,6 +75,32 @@ def test_homing(node):
     node.sdo['Modes of operation'].raw = 1
     time.sleep(0.1)
 
+def test_block_transfer(node, size=4096):
+    """Tes SDO block upload/download (dengan CRC) ke domain 0x2102."""
+    print(f"\n--- Memulai Tes SDO Block Transfer ({size} byte, CRC) ---")
+    expected = sdo_test_pattern(size)
+    node.sdo[SDO_TEST_CONFIG][1].raw = size
+
+    # 1. Block upload: firmware menghasilkan pola per chunk
+    with node.sdo.open(SDO_TEST_DOMAIN, 0, 'rb', block_transfer=True,
+                       request_crc_support=True) as f:
+        data = f.read()
+    if data == expected:
+        print(f"1. Block upload OK ({len(data)} byte)")
+    else:
+        print(f"1. GAGAL: block upload berbeda ({len(data)} byte diterima)")
+
+    # 2. Block download: firmware memeriksa pola per chunk tanpa menyimpan
+    with node.sdo.open(SDO_TEST_DOMAIN, 0, 'wb', size=size, block_transfer=True,
+                       request_crc_support=True) as f:
+        f.write(expected)
+    received = node.sdo[SDO_TEST_CONFIG][2].raw
+    errors = node.sdo[SDO_TEST_CONFIG][3].raw
+    if received == size and errors == 0:
+        print(f"2. Block download OK ({received} byte, 0 error)")
+    else:
+        print(f"2. GAGAL: block download {received} byte, {errors} error")
+
 def main():
     network = canopen.Network()
     network.connect(bustype=INTERFACE, channel=CHANNEL)
@@ -85,12 +112,20 @@ def main():
         node = network.add_node(NODE_ID, EDS_FILE)
         node.nmt.wait_for_bootup(5)
         print(f"Node {NODE_ID} berhasil boot.")
+
+        # Statusword datang lewat TPDO1/TPDO2 (hanya di OPERATIONAL)
+        node.tpdo.read(from_od=True)
+        monitor = StatuswordMonitor()
+        monitor.attach(node)
+        node.nmt.state = 'OPERATIONAL'
     except Exception as e:
         print(f"Gagal menemukan node. Error: {e}")
         network.disconnect()
         return
 
     try:
+        test_block_transfer(node)
+
         print("\n--- Memulai Tes Gerakan dengan State Machine ---")
         # 1. Lakukan Enable dulu (seperti kode Anda sebelumnya)
         print("Mengaktifkan drive...")
@@ -106,9 +141,10 @@ def main():
         print("\n--- Tes Gerakan setelah Homing ---")
         # Gerak ke 50000 (karena posisi sekarang sudah dianggap 0)
         node.sdo['Profile target position'].raw = 50000
+        monitor.mark_command([node.id])
         node.sdo['Control word'].raw = 0x1F # New Setpoint (Bit 4)
         
-        wait_for_move_complete(node) # Fungsi yang sudah ada di kode lama Anda
+        wait_for_move_complete(monitor, node)
         
         posisi_akhir = node.sdo['Actual motor position'].raw
         print(f"Posisi Akhir: {posisi_akhir}")